@@ -51,6 +51,10 @@ class DecisionStep(NamedTuple):
      Each array corresponds to an action branch. Each array contains a mask
      for each action of the branch. If true, the action is not available for
      the agent during this simulation step.
+     - stale_actions is a bool. Is true if the Agent kept acting on its previous
+     actions because the actions of its last decision arrived late.
+     - consumed_steps is an int. The number of steps of the last sequence of
+     actions the Agent played, 0 if its last actions were for a single step.
     """
 
     obs: List[np.ndarray]
@@ -59,6 +63,8 @@ class DecisionStep(NamedTuple):
     action_mask: Optional[List[np.ndarray]]
     group_id: int
     group_reward: float
+    stale_actions: bool = False
+    consumed_steps: int = 0
 
 
 class DecisionSteps(Mapping):
@@ -82,15 +88,33 @@ class DecisionSteps(Mapping):
      array is the batch size and the second contains a mask for each action of
      the branch. If true, the action is not available for the agent during
      this simulation step.
+     - stale_actions is an optional array of booleans of length batch size. Is
+     true if the associated Agent kept acting on its previous actions because
+     the actions of its last decision arrived late.
+     - consumed_steps is an optional int vector of length batch size. The number
+     of steps of the last sequence of actions each Agent played, 0 if its last
+     actions were for a single step.
     """
 
-    def __init__(self, obs, reward, agent_id, action_mask, group_id, group_reward):
+    def __init__(
+        self,
+        obs,
+        reward,
+        agent_id,
+        action_mask,
+        group_id,
+        group_reward,
+        stale_actions=None,
+        consumed_steps=None,
+    ):
         self.obs: List[np.ndarray] = obs
         self.reward: np.ndarray = reward
         self.agent_id: np.ndarray = agent_id
         self.action_mask: Optional[List[np.ndarray]] = action_mask
         self.group_id: np.ndarray = group_id
         self.group_reward: np.ndarray = group_reward
+        self.stale_actions: Optional[np.ndarray] = stale_actions
+        self.consumed_steps: Optional[np.ndarray] = consumed_steps
         self._agent_id_to_index: Optional[Dict[AgentId, int]] = None
 
     @property
@@ -108,6 +132,16 @@ class DecisionSteps(Mapping):
     def __len__(self) -> int:
         return len(self.agent_id)
 
+    def _is_stale(self, agent_index: int) -> bool:
+        return self.stale_actions is not None and bool(
+            self.stale_actions[agent_index]
+        )
+
+    def _consumed_steps(self, agent_index: int) -> int:
+        if self.consumed_steps is None:
+            return 0
+        return int(self.consumed_steps[agent_index])
+
     def __getitem__(self, agent_id: AgentId) -> DecisionStep:
         """
         returns the DecisionStep for a specific agent.
@@ -133,6 +167,8 @@ class DecisionSteps(Mapping):
             action_mask=agent_mask,
             group_id=group_id,
             group_reward=self.group_reward[agent_index],
+            stale_actions=self._is_stale(agent_index),
+            consumed_steps=self._consumed_steps(agent_index),
         )
 
     def __iter__(self) -> Iterator[Any]:
@@ -167,6 +203,10 @@ class TerminalStep(NamedTuple):
      decision step. For example, if the Agent reached the maximum number of steps for
      the episode.
      - agent_id is an int and an unique identifier for the corresponding Agent.
+     - stale_actions is a bool. Is true if the Agent kept acting on its previous
+     actions because the actions of its last decision arrived late.
+     - consumed_steps is an int. The number of steps of the last sequence of
+     actions the Agent played, 0 if its last actions were for a single step.
     """
 
     obs: List[np.ndarray]
@@ -175,6 +215,8 @@ class TerminalStep(NamedTuple):
     agent_id: AgentId
     group_id: GroupId
     group_reward: float
+    stale_actions: bool = False
+    consumed_steps: int = 0
 
 
 class TerminalSteps(Mapping):
@@ -193,15 +235,33 @@ class TerminalSteps(Mapping):
      - agent_id is an int vector of length batch size containing unique
      identifier for the corresponding Agent. This is used to track Agents
      across simulation steps.
+     - stale_actions is an optional array of booleans of length batch size. Is
+     true if the associated Agent kept acting on its previous actions because
+     the actions of its last decision arrived late.
+     - consumed_steps is an optional int vector of length batch size. The number
+     of steps of the last sequence of actions each Agent played, 0 if its last
+     actions were for a single step.
     """
 
-    def __init__(self, obs, reward, interrupted, agent_id, group_id, group_reward):
+    def __init__(
+        self,
+        obs,
+        reward,
+        interrupted,
+        agent_id,
+        group_id,
+        group_reward,
+        stale_actions=None,
+        consumed_steps=None,
+    ):
         self.obs: List[np.ndarray] = obs
         self.reward: np.ndarray = reward
         self.interrupted: np.ndarray = interrupted
         self.agent_id: np.ndarray = agent_id
         self.group_id: np.ndarray = group_id
         self.group_reward: np.ndarray = group_reward
+        self.stale_actions: Optional[np.ndarray] = stale_actions
+        self.consumed_steps: Optional[np.ndarray] = consumed_steps
         self._agent_id_to_index: Optional[Dict[AgentId, int]] = None
 
     @property
@@ -219,6 +279,16 @@ class TerminalSteps(Mapping):
     def __len__(self) -> int:
         return len(self.agent_id)
 
+    def _is_stale(self, agent_index: int) -> bool:
+        return self.stale_actions is not None and bool(
+            self.stale_actions[agent_index]
+        )
+
+    def _consumed_steps(self, agent_index: int) -> int:
+        if self.consumed_steps is None:
+            return 0
+        return int(self.consumed_steps[agent_index])
+
     def __getitem__(self, agent_id: AgentId) -> TerminalStep:
         """
         returns the TerminalStep for a specific agent.
@@ -240,6 +310,8 @@ class TerminalSteps(Mapping):
             agent_id=agent_id,
             group_id=group_id,
             group_reward=self.group_reward[agent_index],
+            stale_actions=self._is_stale(agent_index),
+            consumed_steps=self._consumed_steps(agent_index),
         )
 
     def __iter__(self) -> Iterator[Any]:
@@ -432,6 +504,40 @@ class ActionSpec(NamedTuple):
             )
         return actions
 
+    def _validate_action_sequence(
+        self, actions: ActionTuple, n_agents: int, name: str
+    ) -> Tuple[ActionTuple, int]:
+        """
+        Validates that a sequence of actions has the correct action dim for the
+        correct number of agents, and flattens the steps of each agent one after
+        the other. Returns the flattened actions and the number of steps.
+        """
+        sequences = [a for a in (actions.continuous, actions.discrete) if a.ndim == 3]
+        if not sequences:
+            raise UnrealActionException(
+                f"The behavior {name} needs a sequence of actions of dimension "
+                f"(<number of agents>, <number of steps>, <action size>)"
+            )
+        num_steps = sequences[0].shape[1]
+        flattened = []
+        for kind, values, size in (
+            ("continuous", actions.continuous, self.continuous_size),
+            ("discrete", actions.discrete, self.discrete_size),
+        ):
+            _expected_shape = (n_agents, num_steps, size)
+            if size > 0 and values.shape != _expected_shape:
+                raise UnrealActionException(
+                    f"The behavior {name} needs a {kind} input of dimension "
+                    f"{_expected_shape} for (<number of agents>, <number of steps>, "
+                    f"<action size>) but received input of dimension {values.shape}"
+                )
+            flattened.append(
+                values.reshape(n_agents, num_steps * size)
+                if size > 0
+                else np.zeros((n_agents, 0), dtype=values.dtype)
+            )
+        return ActionTuple(continuous=flattened[0], discrete=flattened[1]), num_steps
+
     @staticmethod
     def create_continuous(continuous_size: int) -> "ActionSpec":
         """
@@ -1,9 +1,12 @@
 import grpc
-from typing import Optional, Callable
+from typing import Optional, Callable, List, Tuple
 
 from multiprocessing import Pipe
+from multiprocessing import shared_memory
 from sys import platform
+import os
 import socket
+import struct
 import time
 from concurrent.futures import ThreadPoolExecutor
 
@@ -14,28 +17,87 @@ from ueagents_envs.communicator_objects.unreal_to_external_pb2_grpc import (
 from ueagents_envs.communicator_objects.unreal_message_pb2 import UnrealMessageProto
 from ueagents_envs.communicator_objects.unreal_input_pb2 import UnrealInputProto
 from ueagents_envs.communicator_objects.unreal_output_pb2 import UnrealOutputProto
-from ueagents_envs.exception import UnrealTimeOutException, UnrealWorkerInUseException
+from ueagents_envs.exception import (
+    UnrealCommunicationException,
+    UnrealTimeOutException,
+    UnrealWorkerInUseException,
+)
 
 # Function to call while waiting for a connection timeout.
 # This should raise an exception if it needs to break from waiting for the timeout.
 PollCallback = Callable[[], None]
 
+TIMEOUT_MESSAGE = (
+    "The Unreal environment took too long to respond. Make sure that :\n"
+    "\t The environment does not need user interaction to launch\n"
+    '\t The Agents\' Behavior Parameters > Behavior Type is set to "Default"\n'
+    "\t The environment and the Python interface have compatible versions.\n"
+    "\t If you're running on a headless server without graphics support, turn off display "
+    "by either passing --no-graphics option or build your Unreal executable as server build."
+)
+
 
 class UnrealToExternalServicerImplementation(UnrealToExternalProtoServicer):
     def __init__(self):
         self.parent_conn, self.child_conn = Pipe()
+        # Slices of the step message being received in chunks
+        self.chunks: List[bytes] = []
+        self.chunk_ack = UnrealMessageProto()
+        self.chunk_ack.header.status = 200
+
+    def reassemble(self, request: UnrealMessageProto) -> Optional[UnrealMessageProto]:
+        """
+        Returns the message completed by a request, or None while the chunks of a step message are arriving.
+        Unreal splits the step messages larger than max_message_size into slices of their serialized bytes.
+        """
+        if not request.chunk and not request.more_chunks:
+            return request
+        self.chunks.append(request.chunk)
+        if request.more_chunks:
+            return None
+        message = UnrealMessageProto.FromString(b"".join(self.chunks))
+        self.chunks = []
+        return message
 
     def Initialize(self, request, context):
+        # A new environment never resumes the chunks of the previous one
+        self.chunks = []
         self.child_conn.send(request)
         return self.child_conn.recv()
 
     def Exchange(self, request, context):
-        self.child_conn.send(request)
+        message = self.reassemble(request)
+        if message is None:
+            return self.chunk_ack
+        self.child_conn.send(message)
         return self.child_conn.recv()
 
+    def ExchangeStream(self, request_iterator, context):
+        # Every step travels on this one call, the replies go through the same pipe as the unary exchanges.
+        # The chunks before the last one of a step message are not answered.
+        for request in request_iterator:
+            message = self.reassemble(request)
+            if message is None:
+                continue
+            self.child_conn.send(message)
+            yield self.child_conn.recv()
+
 
 class RpcCommunicator:
-    def __init__(self, worker_id=0, base_port=5005, timeout_wait=30):
+    # The Unreal environment may exchange the steps over one long-lived ExchangeStream call
+    supports_streaming_exchange = True
+
+    # The default message size limit of gRPC
+    DEFAULT_MAX_MESSAGE_SIZE = 4 * 1024 * 1024
+
+    def __init__(
+        self,
+        worker_id=0,
+        base_port=5005,
+        timeout_wait=30,
+        socket_path: Optional[str] = None,
+        max_message_size: int = DEFAULT_MAX_MESSAGE_SIZE,
+    ):
         """
         Python side of the grpc communication. Python is the server and Unreal the client
 
@@ -43,8 +105,12 @@ class RpcCommunicator:
         :int base_port: Baseline port number to connect to Unreal environment over. worker_id increments over this.
         :int worker_id: Offset from base_port. Used for training multiple environments simultaneously.
         :int timeout_wait: Timeout (in seconds) to wait for a response before exiting.
+        :str socket_path: Unix domain socket to listen on instead of the TCP port, for an environment on the same host.
+        :int max_message_size: Largest message sent or received, in bytes. Unreal sends larger step messages in chunks.
         """
         self.port = base_port + worker_id
+        self.socket_path = socket_path
+        self.max_message_size = max_message_size
         self.worker_id = worker_id
         self.timeout_wait = timeout_wait
         self.server = None
@@ -56,21 +122,31 @@ class RpcCommunicator:
         """
         Creates the GRPC server.
         """
-        self.check_port(self.port)
+        if self.socket_path is None:
+            self.check_port(self.port)
+        else:
+            self.remove_stale_socket(self.socket_path)
 
         try:
             # Establish communication grpc
             self.server = grpc.server(
                 thread_pool=ThreadPoolExecutor(max_workers=10),
-                options=(("grpc.so_reuseport", 1),),
+                options=(
+                    ("grpc.so_reuseport", 1),
+                    ("grpc.max_send_message_length", self.max_message_size),
+                    ("grpc.max_receive_message_length", self.max_message_size),
+                ),
             )
             self.unreal_to_external = UnrealToExternalServicerImplementation()
             add_UnrealToExternalProtoServicer_to_server(
                 self.unreal_to_external, self.server
             )
-            # Using unspecified address, which means that grpc is communicating on all IPs
-            # This is so that the docker container can connect.
-            self.server.add_insecure_port("[::]:" + str(self.port))
+            if self.socket_path is None:
+                # Using unspecified address, which means that grpc is communicating on all IPs
+                # This is so that the docker container can connect.
+                self.server.add_insecure_port("[::]:" + str(self.port))
+            else:
+                self.server.add_insecure_port("unix:" + self.socket_path)
             self.server.start()
             self.is_open = True
         except Exception:
@@ -92,6 +168,22 @@ class RpcCommunicator:
         finally:
             s.close()
 
+    def remove_stale_socket(self, socket_path):
+        """
+        Removes a socket file left behind by a previous run, failing if a server is still listening on it.
+        """
+        if not os.path.exists(socket_path):
+            return
+        s = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+        try:
+            s.connect(socket_path)
+        except OSError:
+            os.remove(socket_path)
+            return
+        finally:
+            s.close()
+        raise UnrealWorkerInUseException(self.worker_id)
+
     def poll_for_timeout(self, poll_callback: Optional[PollCallback] = None) -> None:
         """
         Polls the GRPC parent connection for data, to be used before calling recv.  This prevents
@@ -113,14 +205,7 @@ class RpcCommunicator:
                 poll_callback()
 
         # Got this far without reading any data from the connection, so it must be dead.
-        raise UnrealTimeOutException(
-            "The Unreal environment took too long to respond. Make sure that :\n"
-            "\t The environment does not need user interaction to launch\n"
-            '\t The Agents\' Behavior Parameters > Behavior Type is set to "Default"\n'
-            "\t The environment and the Python interface have compatible versions.\n"
-            "\t If you're running on a headless server without graphics support, turn off display "
-            "by either passing --no-graphics option or build your Unreal executable as server build."
-        )
+        raise UnrealTimeOutException(TIMEOUT_MESSAGE)
 
     def initialize(
         self, inputs: UnrealInputProto, poll_callback: Optional[PollCallback] = None
@@ -157,4 +242,187 @@ class RpcCommunicator:
             self.unreal_to_external.parent_conn.send(message_input)
             self.unreal_to_external.parent_conn.close()
             self.server.stop(False)
+            if self.socket_path is not None and os.path.exists(self.socket_path):
+                os.remove(self.socket_path)
+            self.is_open = False
+
+
+class SharedMemoryCommunicator:
+    supports_streaming_exchange = False
+    # The region holds whole messages, the step messages are never sent in chunks
+    max_message_size = 0
+
+    # Layout of the region header, mirrored by FSharedMemoryHeader on the Unreal side.
+    # Every field is little-endian and each direction's counters sit on their own cache line.
+    MAGIC = 0x53414555  # "UEAS"
+    VERSION = 1
+    HEADER_SIZE = 192
+    _HEADER_FORMAT = "<IIQI"
+    _REQUEST_SEQUENCE_OFFSET = 64
+    _RESPONSE_SEQUENCE_OFFSET = 128
+    # Each direction holds its sequence number followed by the size of its message.
+    _COUNTERS_FORMAT = "<qq"
+    _COUNTER_FORMAT = "<q"
+    _SIZE_OFFSET = 8
+
+    # Number of polls spent spinning before the wait for a request starts sleeping.
+    SPIN_COUNT = 4096
+    SLEEP_INTERVAL = 0.0001
+
+    DEFAULT_CAPACITY = 64 * 1024 * 1024
+
+    def __init__(
+        self,
+        worker_id=0,
+        base_port=5005,
+        timeout_wait=30,
+        capacity=DEFAULT_CAPACITY,
+    ):
+        """
+        Python side of the shared memory communication, for an Unreal environment running on the same host.
+        Python creates a named region, Unreal maps it and both sides exchange serialized messages through it,
+        signaling each new message by incrementing a sequence counter in the region header.
+
+        :int base_port: Baseline port number of the Unreal environment. worker_id increments over this.
+        :int worker_id: Offset from base_port. Used for training multiple environments simultaneously.
+        :int timeout_wait: Timeout (in seconds) to wait for a response before exiting.
+        :int capacity: Size in bytes of each of the request and response areas.
+        """
+        self.port = base_port + worker_id
+        self.worker_id = worker_id
+        self.timeout_wait = timeout_wait
+        self.capacity = capacity
+        self.shm: Optional[shared_memory.SharedMemory] = None
+        self.last_request_sequence = 0
+        self.response_sequence = 0
+        self.is_open = False
+        self.create_region()
+
+    @staticmethod
+    def region_name(port: int) -> str:
+        """
+        Name of the shared memory region of a port, identical to the one computed by Unreal.
+        """
+        return f"ueagents_{port}"
+
+    def create_region(self):
+        """
+        Creates the shared memory region and writes its header.
+        """
+        try:
+            self.shm = shared_memory.SharedMemory(
+                name=self.region_name(self.port),
+                create=True,
+                size=self.HEADER_SIZE + 2 * self.capacity,
+            )
+        except FileExistsError:
+            raise UnrealWorkerInUseException(self.worker_id)
+        self.shm.buf[: self.HEADER_SIZE] = bytes(self.HEADER_SIZE)
+        struct.pack_into(
+            self._HEADER_FORMAT,
+            self.shm.buf,
+            0,
+            self.MAGIC,
+            self.VERSION,
+            self.capacity,
+            os.getpid(),
+        )
+        self.is_open = True
+
+    def _read_counters(self, offset: int) -> Tuple[int, int]:
+        return struct.unpack_from(self._COUNTERS_FORMAT, self.shm.buf, offset)
+
+    def wait_for_request(self, poll_callback: Optional[PollCallback] = None) -> None:
+        """
+        Waits until Unreal has written a new request, spinning first and then sleeping between polls. As with the
+        grpc communicator, the callback is fired periodically to detect an environment that died.
+        """
+        deadline = time.monotonic() + self.timeout_wait
+        callback_interval = self.timeout_wait // 10
+        next_callback = time.monotonic() + callback_interval
+        polls = 0
+        while True:
+            sequence, _ = self._read_counters(self._REQUEST_SEQUENCE_OFFSET)
+            if sequence > self.last_request_sequence:
+                return
+            polls += 1
+            if polls < self.SPIN_COUNT:
+                continue
+            time.sleep(self.SLEEP_INTERVAL)
+            now = time.monotonic()
+            if now >= deadline:
+                raise UnrealTimeOutException(TIMEOUT_MESSAGE)
+            if poll_callback and now >= next_callback:
+                # Fire the callback - if it detects something wrong, it should raise an exception.
+                poll_callback()
+                next_callback = now + callback_interval
+
+    def read_request(self) -> UnrealMessageProto:
+        sequence, size = self._read_counters(self._REQUEST_SEQUENCE_OFFSET)
+        self.last_request_sequence = sequence
+        message = UnrealMessageProto()
+        start = self.HEADER_SIZE
+        message.ParseFromString(bytes(self.shm.buf[start : start + size]))
+        return message
+
+    def write_response(self, message: UnrealMessageProto) -> None:
+        data = message.SerializeToString()
+        if len(data) > self.capacity:
+            raise UnrealCommunicationException(
+                f"Message of {len(data)} bytes exceeds the shared memory capacity of {self.capacity} bytes"
+            )
+        start = self.HEADER_SIZE + self.capacity
+        self.shm.buf[start : start + len(data)] = data
+        # The size is published before the sequence number, Unreal only reads the response once the sequence
+        # changes and must find the size of that response already in place
+        struct.pack_into(
+            self._COUNTER_FORMAT,
+            self.shm.buf,
+            self._RESPONSE_SEQUENCE_OFFSET + self._SIZE_OFFSET,
+            len(data),
+        )
+        self.response_sequence += 1
+        struct.pack_into(
+            self._COUNTER_FORMAT,
+            self.shm.buf,
+            self._RESPONSE_SEQUENCE_OFFSET,
+            self.response_sequence,
+        )
+
+    def initialize(
+        self, inputs: UnrealInputProto, poll_callback: Optional[PollCallback] = None
+    ) -> UnrealOutputProto:
+        self.wait_for_request(poll_callback)
+        aca_param = self.read_request().unreal_output
+        message = UnrealMessageProto()
+        message.header.status = 200
+        message.unreal_input.CopyFrom(inputs)
+        self.write_response(message)
+        self.wait_for_request(poll_callback)
+        self.read_request()
+        return aca_param
+
+    def exchange(
+        self, inputs: UnrealInputProto, poll_callback: Optional[PollCallback] = None
+    ) -> Optional[UnrealOutputProto]:
+        message = UnrealMessageProto()
+        message.header.status = 200
+        message.unreal_input.CopyFrom(inputs)
+        self.write_response(message)
+        self.wait_for_request(poll_callback)
+        output = self.read_request()
+        if output.header.status != 200:
+            return None
+        return output.unreal_output
+
+    def close(self):
+        """
+        Sends a shutdown signal to the unreal environment, and releases the shared memory region.
+        """
+        if self.is_open:
+            message_input = UnrealMessageProto()
+            message_input.header.status = 400
+            self.write_response(message_input)
+            self.shm.close()
+            self.shm.unlink()
             self.is_open = False
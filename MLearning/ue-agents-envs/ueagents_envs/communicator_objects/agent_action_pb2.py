@@ -13,7 +13,7 @@ _sym_db = _symbol_database.Default()
 
 
 
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n5ueagents_envs/communicator_objects/agent_action.proto\x12\x14\x63ommunicator_objects\"W\n\x10\x41gentActionProto\x12\r\n\x05value\x18\x01 \x01(\x02\x12\x1a\n\x12\x63ontinuous_actions\x18\x02 \x03(\x02\x12\x18\n\x10\x64iscrete_actions\x18\x03 \x03(\x05\x62\x06proto3')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n5ueagents_envs/communicator_objects/agent_action.proto\x12\x14\x63ommunicator_objects\"j\n\x10\x41gentActionProto\x12\r\n\x05value\x18\x01 \x01(\x02\x12\x1a\n\x12\x63ontinuous_actions\x18\x02 \x03(\x02\x12\x18\n\x10\x64iscrete_actions\x18\x03 \x03(\x05\x12\x11\n\tnum_steps\x18\x04 \x01(\x05\x62\x06proto3')
 
 _globals = globals()
 _builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, _globals)
@@ -22,5 +22,5 @@ if _descriptor._USE_C_DESCRIPTORS == False:
 
   DESCRIPTOR._options = None
   _globals['_AGENTACTIONPROTO']._serialized_start=79
-  _globals['_AGENTACTIONPROTO']._serialized_end=166
+  _globals['_AGENTACTIONPROTO']._serialized_end=185
 # @@protoc_insertion_point(module_scope)
@@ -14,7 +14,7 @@ _sym_db = _symbol_database.Default()
 from ueagents_envs.communicator_objects import observation_pb2 as ueagents__envs_dot_communicator__objects_dot_observation__pb2
 
 
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n3ueagents_envs/communicator_objects/agent_info.proto\x12\x14\x63ommunicator_objects\x1a\x34ueagents_envs/communicator_objects/observation.proto\"\xcf\x01\n\x0e\x41gentInfoProto\x12\x0e\n\x06reward\x18\x01 \x01(\x02\x12\x0c\n\x04\x64one\x18\x02 \x01(\x08\x12\x18\n\x10max_step_reached\x18\x03 \x01(\x08\x12\n\n\x02id\x18\x04 \x01(\x05\x12\x13\n\x0b\x61\x63tion_mask\x18\x05 \x03(\x08\x12<\n\x0cobservations\x18\x06 \x03(\x0b\x32&.communicator_objects.ObservationProto\x12\x10\n\x08group_id\x18\x07 \x01(\x05\x12\x14\n\x0cgroup_reward\x18\x08 \x01(\x02\x62\x06proto3')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n3ueagents_envs/communicator_objects/agent_info.proto\x12\x14\x63ommunicator_objects\x1a\x34ueagents_envs/communicator_objects/observation.proto\"\xfe\x01\n\x0e\x41gentInfoProto\x12\x0e\n\x06reward\x18\x01 \x01(\x02\x12\x0c\n\x04\x64one\x18\x02 \x01(\x08\x12\x18\n\x10max_step_reached\x18\x03 \x01(\x08\x12\n\n\x02id\x18\x04 \x01(\x05\x12\x13\n\x0b\x61\x63tion_mask\x18\x05 \x03(\x08\x12<\n\x0cobservations\x18\x06 \x03(\x0b\x32&.communicator_objects.ObservationProto\x12\x10\n\x08group_id\x18\x07 \x01(\x05\x12\x14\n\x0cgroup_reward\x18\x08 \x01(\x02\x12\x15\n\rstale_actions\x18\t \x01(\x08\x12\x16\n\x0e\x63onsumed_steps\x18\n \x01(\x05\x62\x06proto3')
 
 _globals = globals()
 _builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, _globals)
@@ -23,5 +23,5 @@ if _descriptor._USE_C_DESCRIPTORS == False:
 
   DESCRIPTOR._options = None
   _globals['_AGENTINFOPROTO']._serialized_start=132
-  _globals['_AGENTINFOPROTO']._serialized_end=339
+  _globals['_AGENTINFOPROTO']._serialized_end=386
 # @@protoc_insertion_point(module_scope)
@@ -13,7 +13,7 @@ _sym_db = _symbol_database.Default()
 
 
 
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n4ueagents_envs/communicator_objects/observation.proto\x12\x14\x63ommunicator_objects\"\xc4\x01\n\x10ObservationProto\x12\r\n\x05shape\x18\x01 \x03(\x05\x12\x46\n\nfloat_data\x18\x02 \x01(\x0b\x32\x30.communicator_objects.ObservationProto.FloatDataH\x00\x12\x1c\n\x14\x64imension_properties\x18\x03 \x03(\x05\x12\x0c\n\x04name\x18\x04 \x01(\t\x1a\x19\n\tFloatData\x12\x0c\n\x04\x64\x61ta\x18\x01 \x03(\x02\x42\x12\n\x10observation_data*4\n\x14ObservationTypeProto\x12\x0b\n\x07\x44\x45\x46\x41ULT\x10\x00\x12\x0f\n\x0bGOAL_SIGNAL\x10\x01\x62\x06proto3')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n4ueagents_envs/communicator_objects/observation.proto\x12\x14\x63ommunicator_objects\"\x8d\x04\n\x10ObservationProto\x12\r\n\x05shape\x18\x01 \x03(\x05\x12\x46\n\nfloat_data\x18\x02 \x01(\x0b\x32\x30.communicator_objects.ObservationProto.FloatDataH\x00\x12\x19\n\x0f\x63ompressed_data\x18\x05 \x01(\x0cH\x00\x12\x18\n\x0equantized_data\x18\x07 \x01(\x0cH\x00\x12\x1c\n\x14\x64imension_properties\x18\x03 \x03(\x05\x12\x0c\n\x04name\x18\x04 \x01(\t\x12\x44\n\x10\x63ompression_type\x18\x06 \x01(\x0e\x32*.communicator_objects.CompressionTypeProto\x12@\n\x08\x65ncoding\x18\x08 \x01(\x0e\x32..communicator_objects.ObservationEncodingProto\x12\x1a\n\x12quantization_scale\x18\t \x01(\x02\x12\x1b\n\x13quantization_offset\x18\n \x01(\x02\x12\x15\n\rdelta_indices\x18\x0b \x03(\x05\x12\x10\n\x08is_delta\x18\x0c \x01(\x08\x12\x13\n\x0bshared_with\x18\r \x01(\x05\x12\x13\n\x0bshared_rows\x18\x0e \x01(\x0c\x1a\x19\n\tFloatData\x12\x0c\n\x04\x64\x61ta\x18\x01 \x03(\x02\x42\x12\n\x10observation_data*4\n\x14ObservationTypeProto\x12\x0b\n\x07\x44\x45\x46\x41ULT\x10\x00\x12\x0f\n\x0bGOAL_SIGNAL\x10\x01**\n\x14\x43ompressionTypeProto\x12\x08\n\x04NONE\x10\x00\x12\x08\n\x04ZLIB\x10\x01*?\n\x18ObservationEncodingProto\x12\x0b\n\x07\x46LOAT32\x10\x00\x12\x0b\n\x07\x46LOAT16\x10\x01\x12\t\n\x05UINT8\x10\x02\x62\x06proto3')
 
 _globals = globals()
 _builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, _globals)
@@ -21,10 +21,14 @@ _builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'ueagents_envs.communicator_
 if _descriptor._USE_C_DESCRIPTORS == False:
 
   DESCRIPTOR._options = None
-  _globals['_OBSERVATIONTYPEPROTO']._serialized_start=277
-  _globals['_OBSERVATIONTYPEPROTO']._serialized_end=329
+  _globals['_OBSERVATIONTYPEPROTO']._serialized_start=606
+  _globals['_OBSERVATIONTYPEPROTO']._serialized_end=658
+  _globals['_COMPRESSIONTYPEPROTO']._serialized_start=660
+  _globals['_COMPRESSIONTYPEPROTO']._serialized_end=702
+  _globals['_OBSERVATIONENCODINGPROTO']._serialized_start=704
+  _globals['_OBSERVATIONENCODINGPROTO']._serialized_end=767
   _globals['_OBSERVATIONPROTO']._serialized_start=79
-  _globals['_OBSERVATIONPROTO']._serialized_end=275
-  _globals['_OBSERVATIONPROTO_FLOATDATA']._serialized_start=230
-  _globals['_OBSERVATIONPROTO_FLOATDATA']._serialized_end=255
+  _globals['_OBSERVATIONPROTO']._serialized_end=604
+  _globals['_OBSERVATIONPROTO_FLOATDATA']._serialized_start=559
+  _globals['_OBSERVATIONPROTO_FLOATDATA']._serialized_end=584
 # @@protoc_insertion_point(module_scope)
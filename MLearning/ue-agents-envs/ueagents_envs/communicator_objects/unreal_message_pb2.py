@@ -16,7 +16,7 @@ from ueagents_envs.communicator_objects import unreal_input_pb2 as ueagents__env
 from ueagents_envs.communicator_objects import header_pb2 as ueagents__envs_dot_communicator__objects_dot_header__pb2
 
 
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n7ueagents_envs/communicator_objects/unreal_message.proto\x12\x14\x63ommunicator_objects\x1a\x36ueagents_envs/communicator_objects/unreal_output.proto\x1a\x35ueagents_envs/communicator_objects/unreal_input.proto\x1a/ueagents_envs/communicator_objects/header.proto\"\xc5\x01\n\x12UnrealMessageProto\x12\x31\n\x06header\x18\x01 \x01(\x0b\x32!.communicator_objects.HeaderProto\x12>\n\runreal_output\x18\x02 \x01(\x0b\x32\'.communicator_objects.UnrealOutputProto\x12<\n\x0cunreal_input\x18\x03 \x01(\x0b\x32&.communicator_objects.UnrealInputProtob\x06proto3')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n7ueagents_envs/communicator_objects/unreal_message.proto\x12\x14\x63ommunicator_objects\x1a\x36ueagents_envs/communicator_objects/unreal_output.proto\x1a\x35ueagents_envs/communicator_objects/unreal_input.proto\x1a/ueagents_envs/communicator_objects/header.proto\"\xe9\x01\n\x12UnrealMessageProto\x12\x31\n\x06header\x18\x01 \x01(\x0b\x32!.communicator_objects.HeaderProto\x12>\n\runreal_output\x18\x02 \x01(\x0b\x32\'.communicator_objects.UnrealOutputProto\x12<\n\x0cunreal_input\x18\x03 \x01(\x0b\x32&.communicator_objects.UnrealInputProto\x12\r\n\x05\x63hunk\x18\x04 \x01(\x0c\x12\x13\n\x0bmore_chunks\x18\x05 \x01(\x08\x62\x06proto3')
 
 _globals = globals()
 _builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, _globals)
@@ -25,5 +25,5 @@ if _descriptor._USE_C_DESCRIPTORS == False:
 
   DESCRIPTOR._options = None
   _globals['_UNREALMESSAGEPROTO']._serialized_start=242
-  _globals['_UNREALMESSAGEPROTO']._serialized_end=439
+  _globals['_UNREALMESSAGEPROTO']._serialized_end=475
 # @@protoc_insertion_point(module_scope)
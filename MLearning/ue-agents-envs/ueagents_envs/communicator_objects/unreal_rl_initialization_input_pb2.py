@@ -13,7 +13,7 @@ _sym_db = _symbol_database.Default()
 
 
 
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\nGueagents_envs/communicator_objects/unreal_rl_initialization_input.proto\x12\x14\x63ommunicator_objects\"{\n UnrealRLInitializationInputProto\x12\x0c\n\x04seed\x18\x01 \x01(\x05\x12\x1d\n\x15\x63ommunication_version\x18\x02 \x01(\t\x12\x17\n\x0fpackage_version\x18\x03 \x01(\t\x12\x11\n\tnum_areas\x18\x04 \x01(\x05\x62\x06proto3')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\nGueagents_envs/communicator_objects/unreal_rl_initialization_input.proto\x12\x14\x63ommunicator_objects\"\x88\x03\n UnrealRLInitializationInputProto\x12\x0c\n\x04seed\x18\x01 \x01(\x05\x12\x1d\n\x15\x63ommunication_version\x18\x02 \x01(\t\x12\x17\n\x0fpackage_version\x18\x03 \x01(\t\x12\x11\n\tnum_areas\x18\x04 \x01(\x05\x12\x1f\n\x17\x63ompressed_observations\x18\x05 \x01(\x08\x12\x1e\n\x16quantized_observations\x18\x06 \x01(\x08\x12\x1a\n\x12\x64\x65lta_observations\x18\x07 \x01(\x08\x12\x1b\n\x13packed_observations\x18\x08 \x01(\x08\x12\x1a\n\x12streaming_exchange\x18\t \x01(\x08\x12\x18\n\x10max_message_size\x18\n \x01(\x05\x12$\n\x1cregistered_observation_specs\x18\x0b \x01(\x08\x12\x18\n\x10\x61\x63tion_sequences\x18\x0c \x01(\x08\x12\x1b\n\x13shared_observations\x18\r \x01(\x08\x62\x06proto3')
 
 _globals = globals()
 _builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, _globals)
@@ -21,6 +21,6 @@ _builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'ueagents_envs.communicator_
 if _descriptor._USE_C_DESCRIPTORS == False:
 
   DESCRIPTOR._options = None
-  _globals['_UNREALRLINITIALIZATIONINPUTPROTO']._serialized_start=97
-  _globals['_UNREALRLINITIALIZATIONINPUTPROTO']._serialized_end=220
+  _globals['_UNREALRLINITIALIZATIONINPUTPROTO']._serialized_start=98
+  _globals['_UNREALRLINITIALIZATIONINPUTPROTO']._serialized_end=490
 # @@protoc_insertion_point(module_scope)
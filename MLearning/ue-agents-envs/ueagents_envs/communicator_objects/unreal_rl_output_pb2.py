@@ -12,9 +12,10 @@ _sym_db = _symbol_database.Default()
 
 
 from ueagents_envs.communicator_objects import agent_info_pb2 as ueagents__envs_dot_communicator__objects_dot_agent__info__pb2
+from ueagents_envs.communicator_objects import observation_pb2 as ueagents__envs_dot_communicator__objects_dot_observation__pb2
 
 
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n9ueagents_envs/communicator_objects/unreal_rl_output.proto\x12\x14\x63ommunicator_objects\x1a\x33ueagents_envs/communicator_objects/agent_info.proto\"\xb6\x02\n\x13UnrealRLOutputProto\x12M\n\nagentInfos\x18\x01 \x03(\x0b\x32\x39.communicator_objects.UnrealRLOutputProto.AgentInfosEntry\x12\x14\n\x0cside_channel\x18\x02 \x01(\x0c\x1aI\n\x12ListAgentInfoProto\x12\x33\n\x05value\x18\x01 \x03(\x0b\x32$.communicator_objects.AgentInfoProto\x1ao\n\x0f\x41gentInfosEntry\x12\x0b\n\x03key\x18\x01 \x01(\t\x12K\n\x05value\x18\x02 \x01(\x0b\x32<.communicator_objects.UnrealRLOutputProto.ListAgentInfoProto:\x02\x38\x01\x62\x06proto3')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n9ueagents_envs/communicator_objects/unreal_rl_output.proto\x12\x14\x63ommunicator_objects\x1a\x33ueagents_envs/communicator_objects/agent_info.proto\x1a\x34ueagents_envs/communicator_objects/observation.proto\"\x94\x06\n\x13UnrealRLOutputProto\x12M\n\nagentInfos\x18\x01 \x03(\x0b\x32\x39.communicator_objects.UnrealRLOutputProto.AgentInfosEntry\x12\x14\n\x0cside_channel\x18\x02 \x01(\x0c\x12Y\n\x10packedAgentInfos\x18\x03 \x03(\x0b\x32?.communicator_objects.UnrealRLOutputProto.PackedAgentInfosEntry\x1aI\n\x12ListAgentInfoProto\x12\x33\n\x05value\x18\x01 \x03(\x0b\x32$.communicator_objects.AgentInfoProto\x1a\x87\x02\n\x14PackedAgentInfoProto\x12\x12\n\nnum_agents\x18\x01 \x01(\x05\x12\x0b\n\x03ids\x18\x02 \x01(\x0c\x12\x0f\n\x07rewards\x18\x03 \x01(\x0c\x12\r\n\x05\x64ones\x18\x04 \x01(\x0c\x12\x18\n\x10max_step_reached\x18\x05 \x01(\x0c\x12\x11\n\tgroup_ids\x18\x06 \x01(\x0c\x12\x15\n\rgroup_rewards\x18\x07 \x01(\x0c\x12\x14\n\x0c\x61\x63tion_masks\x18\x08 \x01(\x0c\x12<\n\x0cobservations\x18\t \x03(\x0b\x32&.communicator_objects.ObservationProto\x12\x16\n\x0e\x63onsumed_steps\x18\n \x01(\x0c\x1ao\n\x0f\x41gentInfosEntry\x12\x0b\n\x03key\x18\x01 \x01(\t\x12K\n\x05value\x18\x02 \x01(\x0b\x32<.communicator_objects.UnrealRLOutputProto.ListAgentInfoProto:\x02\x38\x01\x1aw\n\x15PackedAgentInfosEntry\x12\x0b\n\x03key\x18\x01 \x01(\t\x12M\n\x05value\x18\x02 \x01(\x0b\x32>.communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto:\x02\x38\x01\x62\x06proto3')
 
 _globals = globals()
 _builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, _globals)
@@ -22,12 +23,18 @@ _builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'ueagents_envs.communicator_
 if _descriptor._USE_C_DESCRIPTORS == False:
 
   DESCRIPTOR._options = None
-  _UNREALRLOUTPUTPROTO_AGENTINFOSENTRY._options = None
-  _UNREALRLOUTPUTPROTO_AGENTINFOSENTRY._serialized_options = b'8\001'
-  _globals['_UNREALRLOUTPUTPROTO']._serialized_start=137
-  _globals['_UNREALRLOUTPUTPROTO']._serialized_end=447
-  _globals['_UNREALRLOUTPUTPROTO_LISTAGENTINFOPROTO']._serialized_start=261
-  _globals['_UNREALRLOUTPUTPROTO_LISTAGENTINFOPROTO']._serialized_end=334
-  _globals['_UNREALRLOUTPUTPROTO_AGENTINFOSENTRY']._serialized_start=336
-  _globals['_UNREALRLOUTPUTPROTO_AGENTINFOSENTRY']._serialized_end=447
+  _globals['_UNREALRLOUTPUTPROTO_AGENTINFOSENTRY']._options = None
+  _globals['_UNREALRLOUTPUTPROTO_AGENTINFOSENTRY']._serialized_options = b'8\001'
+  _globals['_UNREALRLOUTPUTPROTO_PACKEDAGENTINFOSENTRY']._options = None
+  _globals['_UNREALRLOUTPUTPROTO_PACKEDAGENTINFOSENTRY']._serialized_options = b'8\001'
+  _globals['_UNREALRLOUTPUTPROTO']._serialized_start=191
+  _globals['_UNREALRLOUTPUTPROTO']._serialized_end=979
+  _globals['_UNREALRLOUTPUTPROTO_LISTAGENTINFOPROTO']._serialized_start=406
+  _globals['_UNREALRLOUTPUTPROTO_LISTAGENTINFOPROTO']._serialized_end=479
+  _globals['_UNREALRLOUTPUTPROTO_PACKEDAGENTINFOPROTO']._serialized_start=482
+  _globals['_UNREALRLOUTPUTPROTO_PACKEDAGENTINFOPROTO']._serialized_end=745
+  _globals['_UNREALRLOUTPUTPROTO_AGENTINFOSENTRY']._serialized_start=747
+  _globals['_UNREALRLOUTPUTPROTO_AGENTINFOSENTRY']._serialized_end=858
+  _globals['_UNREALRLOUTPUTPROTO_PACKEDAGENTINFOSENTRY']._serialized_start=860
+  _globals['_UNREALRLOUTPUTPROTO_PACKEDAGENTINFOSENTRY']._serialized_end=979
 # @@protoc_insertion_point(module_scope)
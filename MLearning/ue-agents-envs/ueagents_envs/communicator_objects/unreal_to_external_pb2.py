@@ -4,9 +4,8 @@
 """Generated protocol buffer code."""
 from google.protobuf import descriptor as _descriptor
 from google.protobuf import descriptor_pool as _descriptor_pool
-from google.protobuf import message as _message
-from google.protobuf import reflection as _reflection
 from google.protobuf import symbol_database as _symbol_database
+from google.protobuf.internal import builder as _builder
 # @@protoc_insertion_point(imports)
 
 _sym_db = _symbol_database.Default()
@@ -15,14 +14,14 @@ _sym_db = _symbol_database.Default()
 from ueagents_envs.communicator_objects import unreal_message_pb2 as ueagents__envs_dot_communicator__objects_dot_unreal__message__pb2
 
 
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n;ueagents_envs/communicator_objects/unreal_to_external.proto\x12\x14\x63ommunicator_objects\x1a\x37ueagents_envs/communicator_objects/unreal_message.proto2y\n\x15UnrealToExternalProto\x12`\n\x08\x45xchange\x12(.communicator_objects.UnrealMessageProto\x1a(.communicator_objects.UnrealMessageProto\"\x00\x62\x06proto3')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n;ueagents_envs/communicator_objects/unreal_to_external.proto\x12\x14\x63ommunicator_objects\x1a\x37ueagents_envs/communicator_objects/unreal_message.proto2\xe5\x01\n\x15UnrealToExternalProto\x12`\n\x08\x45xchange\x12(.communicator_objects.UnrealMessageProto\x1a(.communicator_objects.UnrealMessageProto\"\x00\x12j\n\x0e\x45xchangeStream\x12(.communicator_objects.UnrealMessageProto\x1a(.communicator_objects.UnrealMessageProto\"\x00(\x01\x30\x01\x62\x06proto3')
 
-
-
-_UNREALTOEXTERNALPROTO = DESCRIPTOR.services_by_name['UnrealToExternalProto']
+_globals = globals()
+_builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, _globals)
+_builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'ueagents_envs.communicator_objects.unreal_to_external_pb2', _globals)
 if _descriptor._USE_C_DESCRIPTORS == False:
 
   DESCRIPTOR._options = None
-  _UNREALTOEXTERNALPROTO._serialized_start=142
-  _UNREALTOEXTERNALPROTO._serialized_end=263
+  _globals['_UNREALTOEXTERNALPROTO']._serialized_start=143
+  _globals['_UNREALTOEXTERNALPROTO']._serialized_end=372
 # @@protoc_insertion_point(module_scope)
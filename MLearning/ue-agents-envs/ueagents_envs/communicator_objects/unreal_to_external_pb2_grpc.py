@@ -19,6 +19,11 @@ class UnrealToExternalProtoStub(object):
                 request_serializer=ueagents__envs_dot_communicator__objects_dot_unreal__message__pb2.UnrealMessageProto.SerializeToString,
                 response_deserializer=ueagents__envs_dot_communicator__objects_dot_unreal__message__pb2.UnrealMessageProto.FromString,
                 )
+        self.ExchangeStream = channel.stream_stream(
+                '/communicator_objects.UnrealToExternalProto/ExchangeStream',
+                request_serializer=ueagents__envs_dot_communicator__objects_dot_unreal__message__pb2.UnrealMessageProto.SerializeToString,
+                response_deserializer=ueagents__envs_dot_communicator__objects_dot_unreal__message__pb2.UnrealMessageProto.FromString,
+                )
 
 
 class UnrealToExternalProtoServicer(object):
@@ -31,6 +36,13 @@ class UnrealToExternalProtoServicer(object):
         context.set_details('Method not implemented!')
         raise NotImplementedError('Method not implemented!')
 
+    def ExchangeStream(self, request_iterator, context):
+        """Exchanges the step messages over one stream kept open for the whole session
+        """
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
 
 def add_UnrealToExternalProtoServicer_to_server(servicer, server):
     rpc_method_handlers = {
@@ -39,6 +51,11 @@ def add_UnrealToExternalProtoServicer_to_server(servicer, server):
                     request_deserializer=ueagents__envs_dot_communicator__objects_dot_unreal__message__pb2.UnrealMessageProto.FromString,
                     response_serializer=ueagents__envs_dot_communicator__objects_dot_unreal__message__pb2.UnrealMessageProto.SerializeToString,
             ),
+            'ExchangeStream': grpc.stream_stream_rpc_method_handler(
+                    servicer.ExchangeStream,
+                    request_deserializer=ueagents__envs_dot_communicator__objects_dot_unreal__message__pb2.UnrealMessageProto.FromString,
+                    response_serializer=ueagents__envs_dot_communicator__objects_dot_unreal__message__pb2.UnrealMessageProto.SerializeToString,
+            ),
     }
     generic_handler = grpc.method_handlers_generic_handler(
             'communicator_objects.UnrealToExternalProto', rpc_method_handlers)
@@ -65,3 +82,20 @@ class UnrealToExternalProto(object):
             ueagents__envs_dot_communicator__objects_dot_unreal__message__pb2.UnrealMessageProto.FromString,
             options, channel_credentials,
             insecure, call_credentials, compression, wait_for_ready, timeout, metadata)
+
+    @staticmethod
+    def ExchangeStream(request_iterator,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.stream_stream(request_iterator, target, '/communicator_objects.UnrealToExternalProto/ExchangeStream',
+            ueagents__envs_dot_communicator__objects_dot_unreal__message__pb2.UnrealMessageProto.SerializeToString,
+            ueagents__envs_dot_communicator__objects_dot_unreal__message__pb2.UnrealMessageProto.FromString,
+            options, channel_credentials,
+            insecure, call_credentials, compression, wait_for_ready, timeout, metadata)
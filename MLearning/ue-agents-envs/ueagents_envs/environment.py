@@ -1,5 +1,7 @@
 import atexit
+import os
 import signal
+import tempfile
 
 import numpy as np
 import subprocess
@@ -7,6 +9,7 @@ from typing import Dict, List, Optional, Tuple, Mapping as MappingType
 from distutils.version import StrictVersion
 
 from ueagents_envs.logging_util import get_logger
+from ueagents_envs.timers import hierarchical_timer, timed
 from ueagents_envs import utils
 from ueagents_envs import __version__
 
@@ -28,7 +31,12 @@ from ueagents_envs.exception import (
 )
 
 from ueagents_envs.communicator_objects.command_pb2 import STEP, RESET
-from ueagents_envs.rpc_utils import behavior_spec_from_proto, steps_from_proto
+from ueagents_envs.rpc_utils import (
+    ObservationDeltaDecoder,
+    behavior_spec_from_proto,
+    steps_from_proto,
+    steps_from_packed_proto,
+)
 
 from ueagents_envs.communicator_objects.unreal_rl_input_pb2 import UnrealRLInputProto
 from ueagents_envs.communicator_objects.unreal_rl_output_pb2 import UnrealRLOutputProto
@@ -38,7 +46,7 @@ from ueagents_envs.communicator_objects.unreal_rl_initialization_input_pb2 impor
     UnrealRLInitializationInputProto,
 )
 from ueagents_envs.communicator_objects.unreal_input_pb2 import UnrealInputProto
-from ueagents_envs.communicator import RpcCommunicator
+from ueagents_envs.communicator import RpcCommunicator, SharedMemoryCommunicator
 from ueagents_envs.side_channel.side_channel import SideChannel
 from ueagents_envs.side_channel import DefaultTrainingAnalyticsSideChannel
 from ueagents_envs.side_channel.side_channel_manager import SideChannelManager
@@ -67,6 +75,15 @@ class UnrealEnvironment(BaseEnv):
     # Command line argument used to pass the port to the executable environment.
     _PORT_COMMAND_LINE_ARG = "-mlAgentPort"
 
+    # Command line switch making the executable environment use the shared memory transport.
+    _SHARED_MEMORY_COMMAND_LINE_ARG = "-mlAgentSharedMemory"
+
+    # Command line argument used to pass the Unix domain socket path to the executable environment.
+    _SOCKET_COMMAND_LINE_ARG = "-mlAgentSocket"
+
+    # Command line argument used to pass the largest gRPC message to the executable environment.
+    _MAX_MESSAGE_SIZE_COMMAND_LINE_ARG = "-mlAgentMaxMessageSize"
+
     def __init__(
         self,
         file_name: Optional[str] = None,
@@ -80,6 +97,9 @@ class UnrealEnvironment(BaseEnv):
         side_channels: Optional[List[SideChannel]] = None,
         log_folder: Optional[str] = None,
         num_areas: int = 1,
+        use_shared_memory: bool = False,
+        use_unix_socket: bool = False,
+        max_message_size: int = RpcCommunicator.DEFAULT_MAX_MESSAGE_SIZE,
     ):
         """
         Starts a new unity environment and establishes a connection with the environment.
@@ -93,7 +113,11 @@ class UnrealEnvironment(BaseEnv):
         no_graphics_monitor: Whether to run the main worker in graphics mode, with the remaining in no-graphics mode
         :int timeout_wait: Time (in seconds) to wait for connection from environment. :list args: Addition Unreal
         command line arguments :list side_channels: Additional side channel for no-rl communication with Unreal :str
-        log_folder: Optional folder to write the Unreal Player log file into.  Requires absolute path.
+        log_folder: Optional folder to write the Unreal Player log file into.  Requires absolute path. :bool
+        use_shared_memory: Whether to exchange messages with an environment on the same host through shared memory
+        instead of gRPC. :bool use_unix_socket: Whether gRPC listens on a per-worker Unix domain socket instead of
+        the TCP port, for an environment on the same host. :int max_message_size: Largest gRPC message exchanged
+        with the environment, in bytes. The environment sends larger step messages in chunks.
         """
         atexit.register(self._close)
         self._additional_args = additional_args or []
@@ -111,7 +135,19 @@ class UnrealEnvironment(BaseEnv):
         # The process that is started. If None, no process was started
         self._process: Optional[subprocess.Popen] = None
         self._timeout_wait: int = timeout_wait
-        self._communicator = self._get_communicator(worker_id, base_port, timeout_wait)
+        self._use_shared_memory = use_shared_memory
+        self._max_message_size = max_message_size
+        self._socket_path: Optional[str] = (
+            self._get_socket_path(self._port) if use_unix_socket else None
+        )
+        self._communicator = self._get_communicator(
+            worker_id,
+            base_port,
+            timeout_wait,
+            use_shared_memory,
+            self._socket_path,
+            max_message_size,
+        )
         self._worker_id = worker_id
         if side_channels is None:
             side_channels = []
@@ -143,8 +179,9 @@ class UnrealEnvironment(BaseEnv):
                 self._close(0)
                 raise
         else:
+            endpoint = self._socket_path or f"port {self._port}"
             logger.info(
-                f"Listening on port {self._port}. "
+                f"Listening on {endpoint}. "
                 f"Start training by pressing the Play button in the Unreal Editor."
             )
         self._loaded = True
@@ -154,6 +191,15 @@ class UnrealEnvironment(BaseEnv):
             communication_version=self.API_VERSION,
             package_version=__version__,
             num_areas=num_areas,
+            compressed_observations=True,
+            quantized_observations=True,
+            delta_observations=True,
+            packed_observations=True,
+            registered_observation_specs=True,
+            action_sequences=True,
+            shared_observations=True,
+            streaming_exchange=self._communicator.supports_streaming_exchange,
+            max_message_size=self._communicator.max_message_size,
         )
         try:
             aca_output = self._send_academy_parameters(rl_init_parameters_in)
@@ -173,6 +219,8 @@ class UnrealEnvironment(BaseEnv):
         self._env_state: Dict[str, Tuple[DecisionSteps, TerminalSteps]] = {}
         self._env_specs: Dict[str, BehaviorSpec] = {}
         self._env_actions: Dict[str, ActionTuple] = {}
+        self._env_action_steps: Dict[str, int] = {}
+        self._delta_decoder = ObservationDeltaDecoder()
         self._is_first_message = True
         self._update_behavior_specs(aca_output)
         if default_training_side_channel is not None:
@@ -215,14 +263,38 @@ class UnrealEnvironment(BaseEnv):
         return True
 
     @staticmethod
-    def _get_communicator(worker_id, base_port, timeout_wait):
-        return RpcCommunicator(worker_id, base_port, timeout_wait)
+    def _get_communicator(
+        worker_id,
+        base_port,
+        timeout_wait,
+        use_shared_memory=False,
+        socket_path=None,
+        max_message_size=RpcCommunicator.DEFAULT_MAX_MESSAGE_SIZE,
+    ):
+        if use_shared_memory:
+            return SharedMemoryCommunicator(worker_id, base_port, timeout_wait)
+        return RpcCommunicator(
+            worker_id, base_port, timeout_wait, socket_path, max_message_size
+        )
+
+    @staticmethod
+    def _get_socket_path(port: int) -> str:
+        return os.path.join(tempfile.gettempdir(), f"ueagents_{port}.sock")
 
     def _executable_args(self) -> List[str]:
         args: List[str] = []
         if self._no_graphics:
             args += ["-nullrhi"]
-        args += [UnrealEnvironment._PORT_COMMAND_LINE_ARG, str(self._port)]
+        # Unreal parses the port as a key=value pair
+        args += [f"{UnrealEnvironment._PORT_COMMAND_LINE_ARG}={self._port}"]
+        if self._use_shared_memory:
+            args += [UnrealEnvironment._SHARED_MEMORY_COMMAND_LINE_ARG]
+        else:
+            args += [
+                f"{UnrealEnvironment._MAX_MESSAGE_SIZE_COMMAND_LINE_ARG}={self._max_message_size}"
+            ]
+        if self._socket_path is not None:
+            args += [f"{UnrealEnvironment._SOCKET_COMMAND_LINE_ARG}={self._socket_path}"]
         args += self._additional_args
         return args
 
@@ -231,9 +303,11 @@ class UnrealEnvironment(BaseEnv):
         for brain_param in init_output.brain_parameters:
             # Each BrainParameter in the rl_initialization_output should have at least one AgentInfo
             # Get that agent, because we need some of its observations.
+            # Packed agents describe their observations once for the whole behavior.
             agent_infos = output.rl_output.agentInfos[brain_param.brain_name]
-            if agent_infos.value:
-                agent = agent_infos.value[0]
+            packed = output.rl_output.packedAgentInfos[brain_param.brain_name]
+            if agent_infos.value or packed.num_agents > 0:
+                agent = agent_infos.value[0] if agent_infos.value else packed
                 new_spec = behavior_spec_from_proto(brain_param, agent)
                 self._env_specs[brain_param.brain_name] = new_spec
                 logger.info(f"Connected new brain: {brain_param.brain_name}")
@@ -243,8 +317,13 @@ class UnrealEnvironment(BaseEnv):
         Collects experience information from all external brains in environment at current step.
         """
         for brain_name in self._env_specs.keys():
-            if brain_name in output.agentInfos:
+            if brain_name in output.packedAgentInfos:
+                self._env_state[brain_name] = steps_from_packed_proto(
+                    output.packedAgentInfos[brain_name], self._env_specs[brain_name]
+                )
+            elif brain_name in output.agentInfos:
                 agent_info_list = output.agentInfos[brain_name].value
+                self._delta_decoder.decode(brain_name, agent_info_list)
                 self._env_state[brain_name] = steps_from_proto(
                     agent_info_list, self._env_specs[brain_name]
                 )
@@ -257,6 +336,7 @@ class UnrealEnvironment(BaseEnv):
 
     def reset(self) -> None:
         if self._loaded:
+            self._delta_decoder.clear()
             outputs = self._communicator.exchange(
                 self._generate_reset_input(), self._poll_process
             )
@@ -267,9 +347,11 @@ class UnrealEnvironment(BaseEnv):
             self._update_state(rl_output)
             self._is_first_message = False
             self._env_actions.clear()
+            self._env_action_steps.clear()
         else:
             raise UnrealEnvironmentException("No Unreal environment is loaded.")
 
+    @timed
     def step(self) -> None:
         if self._is_first_message:
             return self.reset()
@@ -285,13 +367,15 @@ class UnrealEnvironment(BaseEnv):
                     group_name
                 ].action_spec.empty_action(n_agents)
         step_input = self._generate_step_input(self._env_actions)
-        outputs = self._communicator.exchange(step_input, self._poll_process)
+        with hierarchical_timer("communicator.exchange"):
+            outputs = self._communicator.exchange(step_input, self._poll_process)
         if outputs is None:
             raise UnrealCommunicatorStoppedException("Communicator has exited.")
         self._update_behavior_specs(outputs)
         rl_output = outputs.rl_output
         self._update_state(rl_output)
         self._env_actions.clear()
+        self._env_action_steps.clear()
 
     @property
     def behavior_specs(self) -> MappingType[str, BehaviorSpec]:
@@ -312,6 +396,29 @@ class UnrealEnvironment(BaseEnv):
         num_agents = len(self._env_state[behavior_name][0])
         action = action_spec._validate_action(action, num_agents, behavior_name)
         self._env_actions[behavior_name] = action
+        self._env_action_steps.pop(behavior_name, None)
+
+    def set_action_sequence(
+        self, behavior_name: BehaviorName, actions: ActionTuple
+    ) -> None:
+        """
+        Sets a sequence of actions for all of the agents of a behavior, the agents
+        play one action of the sequence per step until their next decision, and
+        report the number of steps they played with their next observations.
+        :param behavior_name: The name of the behavior the agents are part of
+        :param actions: ActionTuple of np.arrays with dimensions
+        (n_agents, num_steps, continuous_size) and (n_agents, num_steps, discrete_size).
+        """
+        self._assert_behavior_exists(behavior_name)
+        if behavior_name not in self._env_state:
+            return
+        action_spec = self._env_specs[behavior_name].action_spec
+        num_agents = len(self._env_state[behavior_name][0])
+        actions, num_steps = action_spec._validate_action_sequence(
+            actions, num_agents, behavior_name
+        )
+        self._env_actions[behavior_name] = actions
+        self._env_action_steps[behavior_name] = num_steps
 
     def set_action_for_agent(
         self, behavior_name: BehaviorName, agent_id: AgentId, action: ActionTuple
@@ -321,6 +428,11 @@ class UnrealEnvironment(BaseEnv):
             return
         action_spec = self._env_specs[behavior_name].action_spec
         action = action_spec._validate_action(action, 1, behavior_name)
+        if behavior_name in self._env_action_steps:
+            raise UnrealActionException(
+                f"The behavior {behavior_name} was given a sequence of actions, "
+                f"its agents cannot be given single actions in the same step"
+            )
         if behavior_name not in self._env_actions:
             num_agents = len(self._env_state[behavior_name][0])
             self._env_actions[behavior_name] = action_spec.empty_action(num_agents)
@@ -396,8 +508,9 @@ class UnrealEnvironment(BaseEnv):
             n_agents = len(self._env_state[b][0])
             if n_agents == 0:
                 continue
+            num_steps = self._env_action_steps.get(b, 0)
             for i in range(n_agents):
-                action = AgentActionProto()
+                action = AgentActionProto(num_steps=num_steps)
                 if vector_action[b].continuous is not None:
                     action.continuous_actions.extend(vector_action[b].continuous[i])
                 if vector_action[b].discrete is not None:
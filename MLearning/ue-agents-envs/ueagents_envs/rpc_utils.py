@@ -9,11 +9,21 @@ from ueagents_envs.base_env import (
 )
 from ueagents_envs.communicator_objects.agent_info_pb2 import AgentInfoProto
 from ueagents_envs.communicator_objects.brain_parameters_pb2 import BrainParametersProto
-from ueagents_envs.communicator_objects.observation_pb2 import ObservationProto
+from ueagents_envs.communicator_objects.observation_pb2 import (
+    ObservationProto,
+    ZLIB,
+    FLOAT32,
+    FLOAT16,
+    UINT8,
+)
+from ueagents_envs.communicator_objects.unreal_rl_output_pb2 import (
+    UnrealRLOutputProto,
+)
 from ueagents_envs.exception import UnrealObservationException
 
 import numpy as np
-from typing import cast, List, Tuple, Collection, Iterable, Optional
+import zlib
+from typing import cast, Dict, List, Tuple, Collection, Iterable, Optional
 
 
 def behavior_spec_from_proto(
@@ -21,12 +31,15 @@ def behavior_spec_from_proto(
 ) -> BehaviorSpec:
     """
     Converts brain parameter and agent info proto to BehaviorSpec object.
+    The observation specs registered in the brain parameters are used when the
+    environment sent them, the observations of the agent otherwise.
     :param brain_param_proto: protobuf object.
     :param agent_info: protobuf object.
     :return: BehaviorSpec object.
     """
+    observations = brain_param_proto.observation_specs or agent_info.observations
     observation_specs = []
-    for obs in agent_info.observations:
+    for obs in observations:
         observation_specs.append(
             ObservationSpec(
                 name=obs.name,
@@ -80,7 +93,8 @@ def _check_observations_match_spec(
     expected_obs_shape = tuple(observation_spec.shape)
     for agent_info in agent_info_list:
         agent_obs_shape = tuple(agent_info.observations[obs_index].shape)
-        if expected_obs_shape != agent_obs_shape:
+        # Observations matching their registered spec are sent without a shape
+        if agent_obs_shape and expected_obs_shape != agent_obs_shape:
             raise UnrealObservationException(
                 f"Observation at index={obs_index} for agent with "
                 f"id={agent_info.id} didn't match the ObservationSpec. "
@@ -88,6 +102,49 @@ def _check_observations_match_spec(
             )
 
 
+def _has_encoded_data(obs: ObservationProto) -> bool:
+    return obs.WhichOneof("observation_data") != "float_data"
+
+
+def _decode_observation_bytes(obs: ObservationProto, data: bytes) -> np.ndarray:
+    """
+    Converts encoded observation bytes back to float32 values.
+    :param obs: observation proto declaring the encoding of the data
+    :param data: the uncompressed observation bytes
+    :return: 1D float32 array of the observation data
+    """
+    if obs.encoding == FLOAT32:
+        return np.frombuffer(data, dtype="<f4")
+    if obs.encoding == FLOAT16:
+        return np.frombuffer(data, dtype="<f2").astype(np.float32)
+    if obs.encoding == UINT8:
+        quantized = np.frombuffer(data, dtype=np.uint8).astype(np.float32)
+        return quantized * np.float32(obs.quantization_scale) + np.float32(
+            obs.quantization_offset
+        )
+    raise UnrealObservationException(
+        f"Unsupported observation encoding {obs.encoding}."
+    )
+
+
+def _observation_data(obs: ObservationProto) -> np.ndarray:
+    """
+    Returns the flat observation data, decompressing and dequantizing it if the environment sent it encoded.
+    :param obs: observation proto to read the data from
+    :return: 1D float32 array of the observation data
+    """
+    payload = obs.WhichOneof("observation_data")
+    if payload == "compressed_data":
+        if obs.compression_type != ZLIB:
+            raise UnrealObservationException(
+                f"Unsupported observation compression type {obs.compression_type}."
+            )
+        return _decode_observation_bytes(obs, zlib.decompress(obs.compressed_data))
+    if payload == "quantized_data":
+        return _decode_observation_bytes(obs, obs.quantized_data)
+    return np.array(obs.float_data.data, dtype=np.float32)
+
+
 def _process_rank_one_or_two_observation(
     obs_index: int,
     observation_spec: ObservationSpec,
@@ -96,13 +153,25 @@ def _process_rank_one_or_two_observation(
     if len(agent_info_list) == 0:
         return np.zeros((0,) + observation_spec.shape, dtype=np.float32)
     try:
-        np_obs = np.array(
-            [
-                agent_obs.observations[obs_index].float_data.data
-                for agent_obs in agent_info_list
-            ],
-            dtype=np.float32,
-        ).reshape((len(agent_info_list),) + observation_spec.shape)
+        if any(
+            _has_encoded_data(agent_obs.observations[obs_index])
+            for agent_obs in agent_info_list
+        ):
+            np_obs = np.array(
+                [
+                    _observation_data(agent_obs.observations[obs_index])
+                    for agent_obs in agent_info_list
+                ],
+                dtype=np.float32,
+            ).reshape((len(agent_info_list),) + observation_spec.shape)
+        else:
+            np_obs = np.array(
+                [
+                    agent_obs.observations[obs_index].float_data.data
+                    for agent_obs in agent_info_list
+                ],
+                dtype=np.float32,
+            ).reshape((len(agent_info_list),) + observation_spec.shape)
     except ValueError:
         # Try to get a more useful error message
         _check_observations_match_spec(obs_index, observation_spec, agent_info_list)
@@ -118,16 +187,20 @@ def _observation_to_np_array(
     """
     Converts observation proto into numpy array of the appropriate size.
     :param obs: observation proto to be converted
-    :param expected_shape: optional shape information, used for sanity checks.
+    :param expected_shape: optional shape information, used for sanity checks
+    and as the shape of observations sent without one.
     :return: processed numpy array of observation from environment
     """
+    shape = obs.shape
     if expected_shape is not None:
-        if list(obs.shape) != list(expected_shape):
+        if not shape:
+            shape = expected_shape
+        elif list(shape) != list(expected_shape):
             raise UnrealObservationException(
                 f"Observation did not have the expected shape - got {obs.shape} but expected {expected_shape}"
             )
-    obs_data = np.array(obs.float_data.data, dtype=np.float32)
-    obs_data = np.reshape(obs_data, obs.shape)
+    obs_data = _observation_data(obs)
+    obs_data = np.reshape(obs_data, shape)
     return obs_data
 
 
@@ -153,6 +226,53 @@ def _process_maybe_compressed_observation(
     return np.array(batched_visual, dtype=np.float32)
 
 
+def _process_shared_observation(
+    obs_index: int,
+    observation_spec: ObservationSpec,
+    agent_info_list: Collection[AgentInfoProto],
+) -> np.ndarray:
+    """
+    Converts the observations of a shared sensor for every agent of the behavior.
+    Only the first agent sharing an observation sent its data, the agents that
+    refer to it get a copy of its row.
+    :param obs_index: index of the observation among the observations of the agents
+    :param observation_spec: the ObservationSpec of the observation
+    :param agent_info_list: every agent of the behavior in the message, in order
+    :return: the observations of every agent, in the order of agent_info_list
+    """
+    agent_info_list = list(agent_info_list)
+    shared_with = np.array(
+        [
+            agent_info.observations[obs_index].shared_with
+            for agent_info in agent_info_list
+        ],
+        dtype=np.int64,
+    )
+    owners = np.flatnonzero(shared_with == 0)
+    owner_info_list = [agent_info_list[i] for i in owners]
+    if len(observation_spec.shape) == 3:
+        owner_obs = _process_maybe_compressed_observation(
+            obs_index, observation_spec, owner_info_list
+        )
+    else:
+        owner_obs = _process_rank_one_or_two_observation(
+            obs_index, observation_spec, owner_info_list
+        )
+    rows = np.zeros(len(agent_info_list), dtype=np.int64)
+    rows[owners] = np.arange(len(owners))
+    sharing = shared_with != 0
+    referenced = shared_with[sharing] - 1
+    if np.any(referenced >= len(agent_info_list)) or np.any(
+        shared_with[referenced] != 0
+    ):
+        raise UnrealObservationException(
+            f"Shared observation at index={obs_index} referred to an agent "
+            f"that did not send it."
+        )
+    rows[sharing] = rows[referenced]
+    return owner_obs[rows]
+
+
 def steps_from_proto(
     agent_info_list: Collection[AgentInfoProto], behavior_spec: BehaviorSpec
 ) -> Tuple[DecisionSteps, TerminalSteps]:
@@ -162,11 +282,22 @@ def steps_from_proto(
     terminal_agent_info_list = [
         agent_info for agent_info in agent_info_list if agent_info.done
     ]
+    done = np.array([agent_info.done for agent_info in agent_info_list], dtype=bool)
     decision_obs_list: List[np.ndarray] = []
     terminal_obs_list: List[np.ndarray] = []
     for obs_index, observation_spec in enumerate(behavior_spec.observation_specs):
         is_visual = len(observation_spec.shape) == 3
-        if is_visual:
+        if any(
+            agent_info.observations[obs_index].shared_with
+            for agent_info in agent_info_list
+        ):
+            # Agents may refer to the observation of an agent of the other list
+            np_obs = _process_shared_observation(
+                obs_index, observation_spec, agent_info_list
+            )
+            decision_obs_list.append(np_obs[~done])
+            terminal_obs_list.append(np_obs[done])
+        elif is_visual:
             decision_obs_list.append(
                 _process_maybe_compressed_observation(
                     obs_index, observation_spec, decision_agent_info_list
@@ -212,6 +343,26 @@ def steps_from_proto(
     decision_group_id = [agent_info.group_id for agent_info in decision_agent_info_list]
     terminal_group_id = [agent_info.group_id for agent_info in terminal_agent_info_list]
 
+    # Only environments with an exchange deadline flag the agents that acted on stale actions
+    decision_stale = np.array(
+        [agent_info.stale_actions for agent_info in decision_agent_info_list],
+        dtype=bool,
+    )
+    terminal_stale = np.array(
+        [agent_info.stale_actions for agent_info in terminal_agent_info_list],
+        dtype=bool,
+    )
+
+    # Only agents that played a sequence of actions report the steps they consumed
+    decision_consumed = np.array(
+        [agent_info.consumed_steps for agent_info in decision_agent_info_list],
+        dtype=np.int32,
+    )
+    terminal_consumed = np.array(
+        [agent_info.consumed_steps for agent_info in terminal_agent_info_list],
+        dtype=np.int32,
+    )
+
     max_step = np.array(
         [agent_info.max_step_reached for agent_info in terminal_agent_info_list],
         dtype=bool,
@@ -251,6 +402,8 @@ def steps_from_proto(
             action_mask,
             decision_group_id,
             decision_group_rewards,
+            decision_stale if decision_stale.any() else None,
+            decision_consumed if decision_consumed.any() else None,
         ),
         TerminalSteps(
             terminal_obs_list,
@@ -259,10 +412,159 @@ def steps_from_proto(
             terminal_agent_id,
             terminal_group_id,
             terminal_group_rewards,
+            terminal_stale if terminal_stale.any() else None,
+            terminal_consumed if terminal_consumed.any() else None,
+        ),
+    )
+
+
+def steps_from_packed_proto(
+    packed: UnrealRLOutputProto.PackedAgentInfoProto, behavior_spec: BehaviorSpec
+) -> Tuple[DecisionSteps, TerminalSteps]:
+    """
+    Converts the agents of a behavior sent packed into contiguous arrays to
+    DecisionSteps and TerminalSteps, without going through the agents one by one.
+    :param packed: the packed agents of the behavior.
+    :param behavior_spec: the BehaviorSpec of the behavior.
+    :return: the DecisionSteps and TerminalSteps of the behavior.
+    """
+    n_agents = packed.num_agents
+    if n_agents == 0:
+        return DecisionSteps.empty(behavior_spec), TerminalSteps.empty(behavior_spec)
+    agent_id = np.frombuffer(packed.ids, dtype="<i4").astype(np.int32)
+    rewards = np.frombuffer(packed.rewards, dtype="<f4").astype(np.float32)
+    done = np.frombuffer(packed.dones, dtype=np.uint8).astype(bool)
+    max_step = np.frombuffer(packed.max_step_reached, dtype=np.uint8).astype(bool)
+    group_id = np.frombuffer(packed.group_ids, dtype="<i4").astype(np.int32)
+    group_rewards = np.frombuffer(packed.group_rewards, dtype="<f4").astype(
+        np.float32
+    )
+    _raise_on_nan_and_inf(rewards, "rewards")
+    _raise_on_nan_and_inf(group_rewards, "group_rewards")
+    decision = ~done
+    # Only sent once an agent of the step played a sequence of actions
+    consumed_steps = None
+    if packed.consumed_steps:
+        consumed_steps = np.frombuffer(packed.consumed_steps, dtype="<i4").astype(
+            np.int32
+        )
+
+    decision_obs_list: List[np.ndarray] = []
+    terminal_obs_list: List[np.ndarray] = []
+    for obs_index, observation_spec in enumerate(behavior_spec.observation_specs):
+        obs = packed.observations[obs_index]
+        expected_obs_shape = tuple(observation_spec.shape)
+        if expected_obs_shape != tuple(obs.shape):
+            raise UnrealObservationException(
+                f"Packed observation at index={obs_index} didn't match the "
+                f"ObservationSpec. Expected shape {expected_obs_shape} but got "
+                f"{tuple(obs.shape)}."
+            )
+        if obs.shared_rows:
+            # Shared sensors only send their distinct observations, one row each
+            rows = np.frombuffer(obs.shared_rows, dtype="<i4")
+            np_obs = _observation_data(obs).reshape((-1,) + expected_obs_shape)
+            if len(rows) != n_agents or np.any(rows >= len(np_obs)):
+                raise UnrealObservationException(
+                    f"Shared packed observation at index={obs_index} had rows "
+                    f"that did not match its data."
+                )
+            np_obs = np_obs[rows]
+        else:
+            np_obs = _observation_data(obs).reshape((n_agents,) + expected_obs_shape)
+        _raise_on_nan_and_inf(np_obs, "observations")
+        decision_obs_list.append(np_obs[decision])
+        terminal_obs_list.append(np_obs[done])
+
+    action_mask = None
+    if behavior_spec.action_spec.discrete_size > 0 and np.any(decision):
+        a_size = np.sum(behavior_spec.action_spec.discrete_branches)
+        if len(packed.action_masks) == n_agents * a_size:
+            mask_matrix = np.frombuffer(packed.action_masks, dtype=np.uint8)
+            mask_matrix = mask_matrix.reshape((n_agents, a_size))[decision].astype(bool)
+        else:
+            mask_matrix = np.zeros((np.count_nonzero(decision), a_size), dtype=bool)
+        indices = _generate_split_indices(behavior_spec.action_spec.discrete_branches)
+        action_mask = np.split(mask_matrix, indices, axis=1)
+    return (
+        DecisionSteps(
+            decision_obs_list,
+            rewards[decision],
+            agent_id[decision],
+            action_mask,
+            group_id[decision],
+            group_rewards[decision],
+            # Packed steps never have a deadline, no agent acted on stale actions
+            None,
+            consumed_steps=None if consumed_steps is None else consumed_steps[decision],
+        ),
+        TerminalSteps(
+            terminal_obs_list,
+            rewards[done],
+            max_step[done],
+            agent_id[done],
+            group_id[done],
+            group_rewards[done],
+            None,
+            consumed_steps=None if consumed_steps is None else consumed_steps[done],
         ),
     )
 
 
+class ObservationDeltaDecoder:
+    """
+    Rebuilds the observations the environment sent as changes from the previous
+    step of the agent's episode. The last full observation of every agent and
+    sensor is kept, and delta observations are rewritten in place as full float
+    observations so they can be read like any other.
+    """
+
+    def __init__(self) -> None:
+        self._last_observations: Dict[Tuple[str, int, int], np.ndarray] = {}
+
+    def decode(
+        self, behavior_name: str, agent_info_list: Collection[AgentInfoProto]
+    ) -> None:
+        """
+        Replaces the delta observations of the agents with their full values.
+        :param behavior_name: name of the behavior the agents belong to
+        :param agent_info_list: agent infos received for the behavior, modified in place
+        """
+        for agent_info in agent_info_list:
+            for obs_index, obs in enumerate(agent_info.observations):
+                # Shared observations are never sent as deltas
+                if _has_encoded_data(obs) or obs.shared_with:
+                    continue
+                key = (behavior_name, agent_info.id, obs_index)
+                if obs.is_delta:
+                    base = self._last_observations.get(key)
+                    if base is None:
+                        raise UnrealObservationException(
+                            f"Received a delta observation for agent {agent_info.id} "
+                            f"of {behavior_name} without a previous observation."
+                        )
+                    base[np.array(obs.delta_indices, dtype=np.int64)] = np.array(
+                        obs.float_data.data, dtype=np.float32
+                    )
+                    obs.float_data.data[:] = base
+                    obs.ClearField("delta_indices")
+                    obs.is_delta = False
+                    data = base
+                else:
+                    data = np.array(obs.float_data.data, dtype=np.float32)
+                if agent_info.done:
+                    self._last_observations.pop(key, None)
+                else:
+                    self._last_observations[key] = data
+
+    def clear(self) -> None:
+        """
+        Forgets every stored observation, the environment sends full
+        observations after a reset.
+        """
+        self._last_observations.clear()
+
+
 def _generate_split_indices(dims):
     if len(dims) <= 1:
         return ()
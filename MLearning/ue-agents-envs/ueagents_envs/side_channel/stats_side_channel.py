@@ -21,7 +21,8 @@ class StatsAggregationMethod(Enum):
     HISTOGRAM = 3
 
 
-StatList = List[Tuple[float, StatsAggregationMethod]]
+# A value, how it is aggregated, and the number of values it stands for.
+StatList = List[Tuple[float, StatsAggregationMethod, int]]
 EnvironmentStats = Mapping[str, StatList]
 
 
@@ -41,15 +42,19 @@ class StatsSideChannel(SideChannel):
     def on_message_received(self, msg: IncomingMessage) -> None:
         """
         Receive the message from the environment, and save it for later retrieval.
+        The environment aggregates its stats and sends one message per summary period,
+        holding an entry per stat. Each entry ends with the number of values it covers,
+        kept as the weight of the value when averages are reduced.
 
         :param msg:
         :return:
         """
-        key = msg.read_string()
-        val = msg.read_float32()
-        agg_type = StatsAggregationMethod(msg.read_int32())
-
-        self.stats[key].append((val, agg_type))
+        while msg.offset < len(msg.buffer):
+            key = msg.read_string()
+            val = msg.read_float32()
+            agg_type = StatsAggregationMethod(msg.read_int32())
+            count = msg.read_int32(default_value=1)
+            self.stats[key].append((val, agg_type, max(count, 1)))
 
     def get_and_reset_stats(self) -> EnvironmentStats:
         """
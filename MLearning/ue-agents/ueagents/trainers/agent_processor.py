@@ -225,8 +225,27 @@ class AgentProcessor:
             # Index is needed to grab from last_take_action_outputs
             self._last_step_result[global_agent_id] = (step, index)
 
+        # The agent acted on older actions while the ones decided at the stored step
+        # were late, so this state does not follow from them and the transition is left
+        # out of training. The trajectory ends before it, bootstrapping from the stored
+        # observations. A terminal step still ends the episode below, so its reward and
+        # done flag reach the trainer.
+        if (
+            step.stale_actions
+            and not terminated
+            and stored_decision_step is not None
+            and stored_take_action_outputs is not None
+        ):
+            if self._experience_buffers[global_agent_id]:
+                self._end_trajectory(
+                    global_agent_id, global_group_id, stored_decision_step.obs
+                )
+            self._episode_rewards[global_agent_id] += step.reward
+            self._episode_steps[global_agent_id] += 1
         # This state is the consequence of a past action
-        if stored_decision_step is not None and stored_take_action_outputs is not None:
+        elif (
+            stored_decision_step is not None and stored_take_action_outputs is not None
+        ):
             obs = stored_decision_step.obs
             if self.policy.use_recurrent:
                 memory = self.policy.retrieve_previous_memories([global_agent_id])[0, :]
@@ -285,22 +304,7 @@ class AgentProcessor:
                 >= self._max_trajectory_length
                 or terminated
             ):
-                next_obs = step.obs
-                next_group_obs = []
-                for _id, _obs in self._current_group_obs[global_group_id].items():
-                    if _id != global_agent_id:
-                        next_group_obs.append(_obs)
-
-                trajectory = Trajectory(
-                    steps=self._experience_buffers[global_agent_id],
-                    agent_id=global_agent_id,
-                    next_obs=next_obs,
-                    next_group_obs=next_group_obs,
-                    behavior_id=self._behavior_id,
-                )
-                for traj_queue in self._trajectory_queues:
-                    traj_queue.put(trajectory)
-                self._experience_buffers[global_agent_id] = []
+                self._end_trajectory(global_agent_id, global_group_id, step.obs)
             if terminated:
                 # Record episode length.
                 self._stats_reporter.add_stat(
@@ -309,6 +313,34 @@ class AgentProcessor:
                 )
                 self._clean_agent_data(global_agent_id)
 
+    def _end_trajectory(
+        self,
+        global_agent_id: GlobalAgentId,
+        global_group_id: GlobalGroupId,
+        next_obs: List[np.ndarray],
+    ) -> None:
+        """
+        Sends the experiences gathered for an agent as a trajectory and starts a new one.
+        :param global_agent_id: The agent of the trajectory.
+        :param global_group_id: The group of the agent.
+        :param next_obs: The observations following the last experience.
+        """
+        next_group_obs = []
+        for _id, _obs in self._current_group_obs[global_group_id].items():
+            if _id != global_agent_id:
+                next_group_obs.append(_obs)
+
+        trajectory = Trajectory(
+            steps=self._experience_buffers[global_agent_id],
+            agent_id=global_agent_id,
+            next_obs=next_obs,
+            next_group_obs=next_group_obs,
+            behavior_id=self._behavior_id,
+        )
+        for traj_queue in self._trajectory_queues:
+            traj_queue.put(trajectory)
+        self._experience_buffers[global_agent_id] = []
+
     def _clean_agent_data(self, global_id: GlobalAgentId) -> None:
         """
         Removes the data for an Agent.
@@ -445,15 +477,16 @@ class AgentManager(AgentProcessor):
         Pass stats from the environment to the StatsReporter.
         Depending on the StatsAggregationMethod, either StatsReporter.add_stat or StatsReporter.set_stat is used.
         The worker_id is used to determine whether StatsReporter.set_stat should be used.
+        An average weighs as many values as it was computed from.
 
         :param env_stats:
         :param worker_id:
         :return:
         """
         for stat_name, value_list in env_stats.items():
-            for val, agg_type in value_list:
+            for val, agg_type, count in value_list:
                 if agg_type == StatsAggregationMethod.AVERAGE:
-                    self._stats_reporter.add_stat(stat_name, val, agg_type)
+                    self._stats_reporter.add_stat(stat_name, val, agg_type, count)
                 elif agg_type == StatsAggregationMethod.SUM:
                     self._stats_reporter.add_stat(stat_name, val, agg_type)
                 elif agg_type == StatsAggregationMethod.HISTOGRAM:
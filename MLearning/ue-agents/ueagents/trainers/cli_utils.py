@@ -239,6 +239,28 @@ def _create_parser() -> argparse.ArgumentParser:
         help="The period of time to wait on a Unity environment to startup for training.",
         action=DetectDefault,
     )
+    argparser.add_argument(
+        "--shared-memory",
+        default=False,
+        action=DetectDefaultStoreTrue,
+        help="Whether to exchange messages with environments running on the same host through shared memory "
+        "instead of gRPC over TCP.",
+    )
+    argparser.add_argument(
+        "--unix-socket",
+        default=False,
+        action=DetectDefaultStoreTrue,
+        help="Whether gRPC communicates with environments running on the same host through a Unix domain socket "
+        "per worker instead of a TCP port.",
+    )
+    argparser.add_argument(
+        "--max-message-size",
+        default=4 * 1024 * 1024,
+        type=int,
+        help="The largest gRPC message exchanged with the environments, in bytes. Environments send larger step "
+        "messages in chunks, which the trainer reassembles.",
+        action=DetectDefault,
+    )
 
     eng_conf = argparser.add_argument_group(title="Engine Configuration")
     eng_conf.add_argument(
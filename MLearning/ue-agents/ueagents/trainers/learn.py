@@ -21,6 +21,7 @@ from ueagents.trainers.stats import StatsReporter
 from ueagents.trainers.cli_utils import parser
 from ueagents.trainers.settings import RunOptions
 from ueagents_envs.environment import UnrealEnvironment
+from ueagents_envs.communicator import RpcCommunicator
 
 from ueagents.trainers.training_status import GlobalTrainingStatus
 from ueagents_envs.base_env import BaseEnv
@@ -106,6 +107,9 @@ def run_training(run_seed: int, options: RunOptions, num_areas: int) -> None:
             port,
             env_settings.env_args,
             os.path.abspath(run_logs_dir),  # Unity environment requires absolute path
+            env_settings.shared_memory,
+            env_settings.unix_socket,
+            env_settings.max_message_size,
         )
 
         env_manager = SubprocessEnvManager(env_factory, options, env_settings.num_envs)
@@ -182,6 +186,9 @@ def create_environment_factory(
     start_port: Optional[int],
     env_args: Optional[List[str]],
     log_folder: str,
+    shared_memory: bool = False,
+    unix_socket: bool = False,
+    max_message_size: int = RpcCommunicator.DEFAULT_MAX_MESSAGE_SIZE,
 ) -> Callable[[int, List[SideChannel]], BaseEnv]:
     def create_unity_environment(
         worker_id: int, side_channels: List[SideChannel]
@@ -200,6 +207,9 @@ def create_environment_factory(
             side_channels=side_channels,
             log_folder=log_folder,
             timeout_wait=timeout_wait,
+            use_shared_memory=shared_memory,
+            use_unix_socket=unix_socket,
+            max_message_size=max_message_size,
         )
 
     return create_unity_environment
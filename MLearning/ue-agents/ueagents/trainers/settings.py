@@ -818,6 +818,9 @@ class EnvironmentSettings:
     num_envs: int = attr.ib(default=parser.get_default("num_envs"))
     num_areas: int = attr.ib(default=parser.get_default("num_areas"))
     timeout_wait: int = attr.ib(default=parser.get_default("timeout_wait"))
+    shared_memory: bool = parser.get_default("shared_memory")
+    unix_socket: bool = parser.get_default("unix_socket")
+    max_message_size: int = parser.get_default("max_message_size")
     seed: int = parser.get_default("seed")
     max_lifetime_restarts: int = parser.get_default("max_lifetime_restarts")
     restarts_rate_limit_n: int = parser.get_default("restarts_rate_limit_n")
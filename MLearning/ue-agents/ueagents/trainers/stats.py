@@ -42,6 +42,8 @@ def _dict_to_str(param_dict: Dict[str, Any], num_tabs: int) -> str:
 class StatsSummary(NamedTuple):
     full_dist: List[float]
     aggregation_method: StatsAggregationMethod
+    # The number of values each entry stands for, None when each stands for one.
+    weights: Optional[List[int]] = None
 
     @staticmethod
     def empty() -> "StatsSummary":
@@ -56,15 +58,20 @@ class StatsSummary(NamedTuple):
 
     @property
     def mean(self):
-        return np.mean(self.full_dist)
+        return np.average(self.full_dist, weights=self.weights)
 
     @property
     def std(self):
-        return np.std(self.full_dist)
+        if self.weights is None:
+            return np.std(self.full_dist)
+        deviations = np.asarray(self.full_dist) - self.mean
+        return np.sqrt(np.average(deviations**2, weights=self.weights))
 
     @property
     def num(self):
-        return len(self.full_dist)
+        if self.weights is None:
+            return len(self.full_dist)
+        return sum(self.weights)
 
     @property
     def sum(self):
@@ -289,6 +296,9 @@ class TensorboardWriter(StatsWriter):
 class StatsReporter:
     writers: List[StatsWriter] = []
     stats_dict: Dict[str, Dict[str, List]] = defaultdict(lambda: defaultdict(list))
+    stats_weights: Dict[str, Dict[str, List[int]]] = defaultdict(
+        lambda: defaultdict(list)
+    )
     lock = RLock()
     stats_aggregation: Dict[str, Dict[str, StatsAggregationMethod]] = defaultdict(
         lambda: defaultdict(lambda: StatsAggregationMethod.AVERAGE)
@@ -326,6 +336,7 @@ class StatsReporter:
         key: str,
         value: float,
         aggregation: StatsAggregationMethod = StatsAggregationMethod.AVERAGE,
+        weight: int = 1,
     ) -> None:
         """
         Add a float value stat to the StatsReporter.
@@ -333,9 +344,11 @@ class StatsReporter:
         :param key: The type of statistic, e.g. Environment/Reward.
         :param value: the value of the statistic.
         :param aggregation: the aggregation method for the statistic, default StatsAggregationMethod.AVERAGE.
+        :param weight: the number of values the value stands for, such as an average computed by the environment.
         """
         with StatsReporter.lock:
             StatsReporter.stats_dict[self.category][key].append(value)
+            StatsReporter.stats_weights[self.category][key].append(weight)
             StatsReporter.stats_aggregation[self.category][key] = aggregation
             for writer in StatsReporter.writers:
                 writer.on_add_stat(self.category, key, value, aggregation)
@@ -350,6 +363,7 @@ class StatsReporter:
         """
         with StatsReporter.lock:
             StatsReporter.stats_dict[self.category][key] = [value]
+            StatsReporter.stats_weights[self.category][key] = [1]
             StatsReporter.stats_aggregation[self.category][
                 key
             ] = StatsAggregationMethod.MOST_RECENT
@@ -375,6 +389,7 @@ class StatsReporter:
             for writer in StatsReporter.writers:
                 writer.write_stats(self.category, values, step)
             del StatsReporter.stats_dict[self.category]
+            StatsReporter.stats_weights.pop(self.category, None)
 
     def get_stats_summaries(self, key: str) -> StatsSummary:
         """
@@ -387,7 +402,9 @@ class StatsReporter:
         if len(stat_values) == 0:
             return StatsSummary.empty()
 
+        stat_weights = StatsReporter.stats_weights[self.category][key]
         return StatsSummary(
             full_dist=stat_values,
             aggregation_method=StatsReporter.stats_aggregation[self.category][key],
+            weights=None if all(w == 1 for w in stat_weights) else stat_weights,
         )
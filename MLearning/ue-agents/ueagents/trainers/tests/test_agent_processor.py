@@ -267,6 +267,51 @@ def test_agent_deletion():
     assert len(processor._last_step_result.keys()) == 0
 
 
+
+def test_stale_terminal_step():
+    policy = create_mock_policy()
+    tqueue = mock.Mock()
+    name_behavior_id = "test_brain_name"
+    processor = AgentProcessor(
+        policy,
+        name_behavior_id,
+        max_trajectory_length=5,
+        stats_reporter=StatsReporter("testcat"),
+    )
+
+    mock_decision_step, mock_terminal_step = mb.create_mock_steps(
+        num_agents=1,
+        observation_specs=create_observation_specs_with_shapes([(8,)]),
+        action_spec=ActionSpec.create_continuous(2),
+    )
+    mock_done_decision_step, mock_done_terminal_step = mb.create_mock_steps(
+        num_agents=1,
+        observation_specs=create_observation_specs_with_shapes([(8,)]),
+        action_spec=ActionSpec.create_continuous(2),
+        done=True,
+    )
+    # The agent ends its episode while acting on late actions
+    mock_done_terminal_step.stale_actions = np.array([True], dtype=bool)
+    fake_action_info = _create_action_info(1, mock_decision_step.agent_id)
+
+    processor.publish_trajectory_queue(tqueue)
+    processor.add_experiences(
+        mock_decision_step, mock_terminal_step, 0, ActionInfo.empty()
+    )
+    processor.add_experiences(
+        mock_decision_step, mock_terminal_step, 0, fake_action_info
+    )
+    processor.add_experiences(
+        mock_done_decision_step, mock_done_terminal_step, 0, fake_action_info
+    )
+
+    # The terminal step still ends the trajectory with its reward and done flag
+    trajectory = tqueue.put.call_args[0][0]
+    assert trajectory.done_reached
+    assert trajectory.steps[-1].reward == mock_done_terminal_step.reward[0]
+    assert len(processor._experience_buffers.keys()) == 0
+    assert len(processor._last_step_result.keys()) == 0
+
 def test_end_episode():
     policy = create_mock_policy()
     tqueue = mock.Mock()
@@ -355,14 +400,14 @@ def test_agent_manager_stats():
 
     all_env_stats = [
         {
-            "averaged": [(1.0, StatsAggregationMethod.AVERAGE)],
-            "most_recent": [(2.0, StatsAggregationMethod.MOST_RECENT)],
-            "summed": [(3.1, StatsAggregationMethod.SUM)],
+            "averaged": [(1.0, StatsAggregationMethod.AVERAGE, 1)],
+            "most_recent": [(2.0, StatsAggregationMethod.MOST_RECENT, 1)],
+            "summed": [(3.1, StatsAggregationMethod.SUM, 1)],
         },
         {
-            "averaged": [(3.0, StatsAggregationMethod.AVERAGE)],
-            "most_recent": [(4.0, StatsAggregationMethod.MOST_RECENT)],
-            "summed": [(1.1, StatsAggregationMethod.SUM)],
+            "averaged": [(3.0, StatsAggregationMethod.AVERAGE, 1)],
+            "most_recent": [(4.0, StatsAggregationMethod.MOST_RECENT, 1)],
+            "summed": [(1.1, StatsAggregationMethod.SUM, 1)],
         },
     ]
     for env_stats in all_env_stats:
@@ -0,0 +1,107 @@
+from typing import List
+
+from ueagents_envs.communicator import UnrealToExternalServicerImplementation
+from ueagents_envs.communicator_objects.agent_info_pb2 import AgentInfoProto
+from ueagents_envs.communicator_objects.unreal_message_pb2 import UnrealMessageProto
+
+
+def generate_step_message(step: int) -> UnrealMessageProto:
+    message = UnrealMessageProto()
+    message.header.status = 200
+    agents = message.unreal_output.rl_output.agentInfos["behavior"]
+    agents.value.extend([AgentInfoProto(id=step, reward=float(step))])
+    return message
+
+
+def generate_reply(step: int) -> UnrealMessageProto:
+    reply = UnrealMessageProto()
+    reply.header.status = 200
+    reply.unreal_input.rl_input.side_channel = bytes([step])
+    return reply
+
+
+def split_in_chunks(
+    message: UnrealMessageProto, num_chunks: int
+) -> List[UnrealMessageProto]:
+    serialized = message.SerializeToString()
+    size = -(-len(serialized) // num_chunks)
+    chunks = []
+    for offset in range(0, len(serialized), size):
+        chunk = UnrealMessageProto()
+        chunk.chunk = serialized[offset : offset + size]
+        chunk.more_chunks = offset + size < len(serialized)
+        chunks.append(chunk)
+    assert len(chunks) == num_chunks
+    return chunks
+
+
+def receive_all(servicer: UnrealToExternalServicerImplementation) -> List:
+    received = []
+    while servicer.parent_conn.poll():
+        received.append(servicer.parent_conn.recv())
+    return received
+
+
+def test_exchange_stream_carries_several_steps():
+    servicer = UnrealToExternalServicerImplementation()
+    steps = [generate_step_message(i) for i in range(3)]
+    # The trainer side of the pipe answers the steps in order
+    for i in range(3):
+        servicer.parent_conn.send(generate_reply(i))
+
+    replies = list(servicer.ExchangeStream(iter(steps), None))
+
+    assert replies == [generate_reply(i) for i in range(3)]
+    assert receive_all(servicer) == steps
+
+
+def test_exchange_acks_chunks_and_reassembles_message():
+    servicer = UnrealToExternalServicerImplementation()
+    message = generate_step_message(7)
+    chunks = split_in_chunks(message, 3)
+
+    # The chunks before the last one are acknowledged without reaching the trainer
+    for chunk in chunks[:-1]:
+        ack = servicer.Exchange(chunk, None)
+        assert ack.header.status == 200
+        assert not ack.HasField("unreal_input")
+        assert receive_all(servicer) == []
+
+    servicer.parent_conn.send(generate_reply(7))
+    assert servicer.Exchange(chunks[-1], None) == generate_reply(7)
+    assert receive_all(servicer) == [message]
+    assert servicer.chunks == []
+
+
+def test_exchange_passes_unchunked_message():
+    servicer = UnrealToExternalServicerImplementation()
+    message = generate_step_message(1)
+    servicer.parent_conn.send(generate_reply(1))
+    assert servicer.Exchange(message, None) == generate_reply(1)
+    assert receive_all(servicer) == [message]
+
+
+def test_exchange_stream_reassembles_chunked_steps():
+    servicer = UnrealToExternalServicerImplementation()
+    steps = [generate_step_message(i) for i in range(3)]
+    # The first and last steps are chunked, the one in between is not
+    requests = split_in_chunks(steps[0], 2) + [steps[1]] + split_in_chunks(steps[2], 4)
+    for i in range(3):
+        servicer.parent_conn.send(generate_reply(i))
+
+    replies = list(servicer.ExchangeStream(iter(requests), None))
+
+    # Only the last chunk of a step is answered
+    assert replies == [generate_reply(i) for i in range(3)]
+    assert receive_all(servicer) == steps
+
+
+def test_initialize_drops_partial_chunks():
+    servicer = UnrealToExternalServicerImplementation()
+    servicer.Exchange(split_in_chunks(generate_step_message(0), 2)[0], None)
+    init_message = UnrealMessageProto()
+    init_message.header.status = 200
+    servicer.parent_conn.send(generate_reply(0))
+    servicer.Initialize(init_message, None)
+    assert servicer.chunks == []
+    assert receive_all(servicer) == [init_message]
@@ -0,0 +1,153 @@
+from typing import List
+from unittest import mock
+
+import numpy as np
+import pytest
+
+from ueagents_envs.base_env import ActionSpec, ActionTuple
+from ueagents_envs.communicator_objects.agent_info_pb2 import AgentInfoProto
+from ueagents_envs.communicator_objects.unreal_output_pb2 import UnrealOutputProto
+from ueagents_envs.environment import UnrealEnvironment
+from ueagents_envs.exception import UnrealActionException, UnrealObservationException
+
+BEHAVIOR_NAME = "RealFakeBehavior"
+OBS_SIZE = 4
+
+
+def generate_agent_proto(
+    agent_id: int, data: List[float], delta_indices: List[int] = None
+) -> AgentInfoProto:
+    ap = AgentInfoProto(id=agent_id)
+    obs_proto = ap.observations.add()
+    obs_proto.shape.append(OBS_SIZE)
+    obs_proto.float_data.data.extend(data)
+    if delta_indices is not None:
+        obs_proto.is_delta = True
+        obs_proto.delta_indices.extend(delta_indices)
+    return ap
+
+
+def generate_output(
+    agent_protos: List[AgentInfoProto], initialization: bool = False
+) -> UnrealOutputProto:
+    output = UnrealOutputProto()
+    if initialization:
+        init = output.rl_initialization_output
+        init.communication_version = UnrealEnvironment.API_VERSION
+        brain = init.brain_parameters.add()
+        brain.brain_name = BEHAVIOR_NAME
+        brain.action_spec.num_continuous_actions = 2
+    output.rl_output.agentInfos[BEHAVIOR_NAME].value.extend(agent_protos)
+    return output
+
+
+def create_environment(outputs: List[UnrealOutputProto]) -> UnrealEnvironment:
+    """
+    Creates an environment connected to a fake communicator, which answers the
+    handshake with the first output and each following exchange with the next one.
+    """
+    communicator = mock.Mock()
+    communicator.supports_streaming_exchange = False
+    communicator.max_message_size = 0
+    communicator.initialize.return_value = outputs[0]
+    communicator.exchange.side_effect = outputs[1:]
+    with mock.patch.object(
+        UnrealEnvironment, "_get_communicator", return_value=communicator
+    ):
+        return UnrealEnvironment()
+
+
+def test_reset_clears_delta_observations():
+    env = create_environment(
+        [
+            generate_output([generate_agent_proto(0, [0, 0, 0, 0])], True),
+            generate_output([generate_agent_proto(0, [1, 2, 3, 4])]),
+            generate_output([generate_agent_proto(0, [9], delta_indices=[1])]),
+            generate_output([generate_agent_proto(0, [5], delta_indices=[0])]),
+        ]
+    )
+    env.reset()
+    env.step()
+    decision_steps, _ = env.get_steps(BEHAVIOR_NAME)
+    assert list(decision_steps.obs[0][0]) == [1, 9, 3, 4]
+
+    # The environment sends full observations after a reset, a delta has no base
+    with pytest.raises(UnrealObservationException):
+        env.reset()
+    env.close()
+
+
+def test_validate_action_sequence_flattens_steps():
+    action_spec = ActionSpec.create_hybrid(2, (3,))
+    continuous = np.arange(12, dtype=np.float32).reshape(2, 3, 2)
+    discrete = np.array([[[0], [1], [2]], [[2], [1], [0]]], dtype=np.int32)
+    actions, num_steps = action_spec._validate_action_sequence(
+        ActionTuple(continuous=continuous, discrete=discrete), 2, BEHAVIOR_NAME
+    )
+    assert num_steps == 3
+    # The steps of each agent follow each other
+    assert np.array_equal(actions.continuous, continuous.reshape(2, 6))
+    assert np.array_equal(actions.discrete, discrete.reshape(2, 3))
+
+
+@pytest.mark.parametrize(
+    "continuous,discrete",
+    [
+        # Single actions are not a sequence
+        (np.zeros((2, 2)), np.zeros((2, 1))),
+        # Wrong number of agents
+        (np.zeros((3, 4, 2)), np.zeros((3, 4, 1))),
+        # Wrong action size
+        (np.zeros((2, 4, 3)), np.zeros((2, 4, 1))),
+        # The continuous and discrete sequences have a different number of steps
+        (np.zeros((2, 4, 2)), np.zeros((2, 5, 1))),
+    ],
+)
+def test_validate_action_sequence_rejects_bad_shapes(continuous, discrete):
+    action_spec = ActionSpec.create_hybrid(2, (3,))
+    with pytest.raises(UnrealActionException):
+        action_spec._validate_action_sequence(
+            ActionTuple(continuous=continuous, discrete=discrete), 2, BEHAVIOR_NAME
+        )
+
+
+def create_environment_with_agents(num_agents: int) -> UnrealEnvironment:
+    agent_protos = [generate_agent_proto(i, [0] * OBS_SIZE) for i in range(num_agents)]
+    env = create_environment(
+        [generate_output(agent_protos, True), generate_output(agent_protos)]
+    )
+    env.reset()
+    return env
+
+
+def test_step_input_sets_num_steps_of_every_agent():
+    env = create_environment_with_agents(2)
+    continuous = np.arange(12, dtype=np.float32).reshape(2, 3, 2)
+    env.set_action_sequence(BEHAVIOR_NAME, ActionTuple(continuous=continuous))
+
+    step_input = env._generate_step_input(env._env_actions)
+    agent_actions = step_input.rl_input.agent_actions[BEHAVIOR_NAME].value
+    assert [action.num_steps for action in agent_actions] == [3, 3]
+    for i, action in enumerate(agent_actions):
+        assert list(action.continuous_actions) == list(continuous[i].reshape(-1))
+
+    # Single actions replace the sequence and go back to one step
+    env.set_actions(
+        BEHAVIOR_NAME, ActionTuple(continuous=np.zeros((2, 2), dtype=np.float32))
+    )
+    step_input = env._generate_step_input(env._env_actions)
+    agent_actions = step_input.rl_input.agent_actions[BEHAVIOR_NAME].value
+    assert [action.num_steps for action in agent_actions] == [0, 0]
+    env.close()
+
+
+def test_sequence_and_single_actions_cannot_be_mixed():
+    env = create_environment_with_agents(2)
+    env.set_action_sequence(
+        BEHAVIOR_NAME, ActionTuple(continuous=np.zeros((2, 3, 2), dtype=np.float32))
+    )
+    with pytest.raises(UnrealActionException):
+        env.set_action_for_agent(
+            BEHAVIOR_NAME, 0, ActionTuple(continuous=np.zeros((1, 2), dtype=np.float32))
+        )
+    env.close()
@@ -1,34 +1,43 @@
-import io
 import numpy as np
 import pytest
-from typing import List, Tuple, Any
+import zlib
+from typing import List, Optional, Tuple, Any
 
 from ueagents_envs.communicator_objects.agent_info_pb2 import AgentInfoProto
 from ueagents_envs.communicator_objects.observation_pb2 import (
     ObservationProto,
     NONE,
-    PNG,
+    ZLIB,
+    FLOAT32,
+    FLOAT16,
+    UINT8,
 )
 from ueagents_envs.communicator_objects.brain_parameters_pb2 import BrainParametersProto
 from ueagents_envs.communicator_objects.agent_info_action_pair_pb2 import (
     AgentInfoActionPairProto,
 )
 from ueagents_envs.communicator_objects.agent_action_pb2 import AgentActionProto
+from ueagents_envs.communicator_objects.unreal_rl_output_pb2 import (
+    UnrealRLOutputProto,
+)
 from ueagents_envs.base_env import (
     BehaviorSpec,
+    DimensionProperty,
     ActionSpec,
     DecisionSteps,
     TerminalSteps,
 )
-from ueagents_envs.exception import UnityObservationException
+from ueagents_envs.exception import UnrealObservationException
 from ueagents_envs.rpc_utils import (
     behavior_spec_from_proto,
-    process_pixels,
     _process_maybe_compressed_observation,
     _process_rank_one_or_two_observation,
+    _observation_data,
+    _process_shared_observation,
     steps_from_proto,
+    steps_from_packed_proto,
+    ObservationDeltaDecoder,
 )
-from PIL import Image
 from ueagents.trainers.tests.dummy_config import create_observation_specs_with_shapes
 
 
@@ -61,62 +70,35 @@ def generate_list_agent_proto(
     return result
 
 
-def generate_compressed_data(in_array: np.ndarray) -> bytes:
-    image_arr = (in_array * 255).astype(np.uint8)
-    bytes_out = bytes()
-
-    num_channels = in_array.shape[0]
-    num_images = (num_channels + 2) // 3
-    # Split the input image into batches of 3 channels.
-    for i in range(num_images):
-        sub_image = image_arr[3 * i : 3 * i + 3, ...]
-        if (i == num_images - 1) and (num_channels % 3) != 0:
-            # Pad zeros
-            zero_shape = list(in_array.shape)
-            zero_shape[0] = 3 - (num_channels % 3)
-            z = np.zeros(zero_shape, dtype=np.uint8)
-            sub_image = np.concatenate([sub_image, z], axis=0)
-        sub_image = np.moveaxis(sub_image, 0, -1)
-        im = Image.fromarray(sub_image, "RGB")
-        byteIO = io.BytesIO()
-        im.save(byteIO, format="PNG")
-        bytes_out += byteIO.getvalue()
-    return bytes_out
-
-
-# test helper function for old C# API (no compressed channel mapping)
-def generate_compressed_proto_obs(
-    in_array: np.ndarray, grayscale: bool = False
-) -> ObservationProto:
+def generate_compressed_proto_obs(in_array: np.ndarray) -> ObservationProto:
     obs_proto = ObservationProto()
-    obs_proto.compressed_data = generate_compressed_data(in_array)
-    obs_proto.compression_type = PNG
-    if grayscale:
-        # grayscale flag is only used for old API without mapping
-        expected_shape = [1, in_array.shape[1], in_array.shape[2]]
-        obs_proto.shape.extend(expected_shape)
-    else:
-        obs_proto.shape.extend(in_array.shape)
+    obs_proto.compressed_data = zlib.compress(in_array.astype("<f4").tobytes())
+    obs_proto.compression_type = ZLIB
+    obs_proto.shape.extend(in_array.shape)
     return obs_proto
 
 
-# test helper function for new C# API (with compressed channel mapping)
-def generate_compressed_proto_obs_with_mapping(
-    in_array: np.ndarray, mapping: List[int]
+def generate_encoded_proto_obs(
+    in_array: np.ndarray, encoding: int, compress: bool
 ) -> ObservationProto:
     obs_proto = ObservationProto()
-    obs_proto.compressed_data = generate_compressed_data(in_array)
-    obs_proto.compression_type = PNG
-    if mapping is not None:
-        obs_proto.compressed_channel_mapping.extend(mapping)
-        expected_shape = [
-            len({m for m in mapping if m >= 0}),
-            in_array.shape[1],
-            in_array.shape[2],
-        ]
-        obs_proto.shape.extend(expected_shape)
+    obs_proto.encoding = encoding
+    obs_proto.shape.extend(in_array.shape)
+    if encoding == FLOAT16:
+        data = in_array.astype("<f2").tobytes()
+    elif encoding == UINT8:
+        low, high = float(in_array.min()), float(in_array.max())
+        obs_proto.quantization_scale = (high - low) / 255.0
+        obs_proto.quantization_offset = low
+        quantized = np.round((in_array - low) / obs_proto.quantization_scale)
+        data = quantized.astype(np.uint8).tobytes()
+    else:
+        data = in_array.astype("<f4").tobytes()
+    if compress:
+        obs_proto.compressed_data = zlib.compress(data)
+        obs_proto.compression_type = ZLIB
     else:
-        obs_proto.shape.extend(in_array.shape)
+        obs_proto.quantized_data = data
     return obs_proto
 
 
@@ -219,10 +201,8 @@ def proto_from_steps_and_action(
         proto = AgentActionProto()
         if continuous_actions is not None:
             proto.continuous_actions.extend(continuous_actions[i])
-            proto.vector_actions_deprecated.extend(continuous_actions[i])
         if discrete_actions is not None:
             proto.discrete_actions.extend(discrete_actions[i])
-            proto.vector_actions_deprecated.extend(discrete_actions[i])
         agent_action_protos.append(proto)
     agent_info_action_pair_protos = [
         AgentInfoActionPairProto(agent_info=agent_info_proto, action_info=action_proto)
@@ -233,36 +213,6 @@ def proto_from_steps_and_action(
     return agent_info_action_pair_protos
 
 
-def test_process_pixels():
-    in_array = np.random.rand(3, 128, 64)
-    byte_arr = generate_compressed_data(in_array)
-    out_array = process_pixels(byte_arr, 3)
-    assert out_array.shape == (3, 128, 64)
-    assert np.sum(in_array - out_array) / np.prod(in_array.shape) < 0.01
-    assert np.allclose(in_array, out_array, atol=0.01)
-
-
-def test_process_pixels_multi_png():
-    height = 128
-    width = 64
-    num_channels = 7
-    in_array = np.random.rand(num_channels, height, width)
-    byte_arr = generate_compressed_data(in_array)
-    out_array = process_pixels(byte_arr, num_channels)
-    assert out_array.shape == (num_channels, height, width)
-    assert np.sum(in_array - out_array) / np.prod(in_array.shape) < 0.01
-    assert np.allclose(in_array, out_array, atol=0.01)
-
-
-def test_process_pixels_gray():
-    in_array = np.random.rand(3, 128, 64)
-    byte_arr = generate_compressed_data(in_array)
-    out_array = process_pixels(byte_arr, 1)
-    assert out_array.shape == (1, 128, 64)
-    assert np.mean(in_array.mean(axis=0, keepdims=True) - out_array) < 0.01
-    assert np.allclose(in_array.mean(axis=0, keepdims=True), out_array, atol=0.01)
-
-
 def test_vector_observation():
     n_agents = 10
     shapes = [(3,), (4,)]
@@ -276,85 +226,123 @@ def test_vector_observation():
         assert np.allclose(arr, 0.1, atol=0.01)
 
 
-def test_process_visual_observation():
-    shape = (3, 128, 64)
-    in_array_1 = np.random.rand(*shape)
-    proto_obs_1 = generate_compressed_proto_obs(in_array_1)
-    in_array_2 = np.random.rand(*shape)
-    in_array_2_mapping = [0, 1, 2]
-    proto_obs_2 = generate_compressed_proto_obs_with_mapping(
-        in_array_2, in_array_2_mapping
-    )
-
-    ap1 = AgentInfoProto()
-    ap1.observations.extend([proto_obs_1])
-    ap2 = AgentInfoProto()
-    ap2.observations.extend([proto_obs_2])
-    ap_list = [ap1, ap2]
+@pytest.mark.parametrize("shape", [(5,), (3, 4)])
+def test_process_compressed_rank_one_or_two_observation(shape):
+    in_arrays = [np.random.rand(*shape).astype(np.float32) for _ in range(3)]
+    ap_list = []
+    for in_array in in_arrays:
+        ap = AgentInfoProto()
+        ap.observations.extend([generate_compressed_proto_obs(in_array)])
+        ap_list.append(ap)
     obs_spec = create_observation_specs_with_shapes([shape])[0]
-    arr = _process_maybe_compressed_observation(0, obs_spec, ap_list)
-    assert list(arr.shape) == [2, 3, 128, 64]
-    assert np.allclose(arr[0, :, :, :], in_array_1, atol=0.01)
-    assert np.allclose(arr[1, :, :, :], in_array_2, atol=0.01)
-
-
-def test_process_visual_observation_grayscale():
-    in_array_1 = np.random.rand(3, 128, 64)
-    proto_obs_1 = generate_compressed_proto_obs(in_array_1, grayscale=True)
-    expected_out_array_1 = np.mean(in_array_1, axis=0, keepdims=True)
-    in_array_2 = np.random.rand(3, 128, 64)
-    in_array_2_mapping = [0, 0, 0]
-    proto_obs_2 = generate_compressed_proto_obs_with_mapping(
-        in_array_2, in_array_2_mapping
-    )
-    expected_out_array_2 = np.mean(in_array_2, axis=0, keepdims=True)
+    arr = _process_rank_one_or_two_observation(0, obs_spec, ap_list)
+    assert arr.shape == (3,) + shape
+    assert np.array_equal(arr, np.stack(in_arrays))
+
 
+def test_process_compressed_rank_one_observation_mixed_with_float_data():
+    compressed = np.array([1.0, 2.0, 3.0], dtype=np.float32)
     ap1 = AgentInfoProto()
-    ap1.observations.extend([proto_obs_1])
+    ap1.observations.extend([generate_compressed_proto_obs(compressed)])
     ap2 = AgentInfoProto()
-    ap2.observations.extend([proto_obs_2])
-    ap_list = [ap1, ap2]
-    shape = (1, 128, 64)
-    obs_spec = create_observation_specs_with_shapes([shape])[0]
-    arr = _process_maybe_compressed_observation(0, obs_spec, ap_list)
-    assert list(arr.shape) == [2, 1, 128, 64]
-    assert np.allclose(arr[0, :, :, :], expected_out_array_1, atol=0.01)
-    assert np.allclose(arr[1, :, :, :], expected_out_array_2, atol=0.01)
+    ap2.observations.extend([generate_uncompressed_proto_obs(compressed * 2)])
+    obs_spec = create_observation_specs_with_shapes([(3,)])[0]
+    arr = _process_rank_one_or_two_observation(0, obs_spec, [ap1, ap2])
+    assert np.array_equal(arr, np.stack([compressed, compressed * 2]))
 
 
-def test_process_visual_observation_padded_channels():
-    in_array_1 = np.random.rand(12, 128, 64)
-    in_array_1_mapping = [0, 1, 2, 3, -1, -1, 4, 5, 6, 7, -1, -1]
-    proto_obs_1 = generate_compressed_proto_obs_with_mapping(
-        in_array_1, in_array_1_mapping
-    )
-    expected_out_array_1 = np.take(in_array_1, [0, 1, 2, 3, 6, 7, 8, 9], axis=0)
+def test_process_visual_observation():
+    shape = (3, 16, 8)
+    in_array_1 = np.random.rand(*shape).astype(np.float32)
+    proto_obs_1 = generate_compressed_proto_obs(in_array_1)
+    in_array_2 = np.random.rand(*shape).astype(np.float32)
+    proto_obs_2 = generate_uncompressed_proto_obs(in_array_2)
 
     ap1 = AgentInfoProto()
     ap1.observations.extend([proto_obs_1])
-    ap_list = [ap1]
-    shape = (8, 128, 64)
+    ap2 = AgentInfoProto()
+    ap2.observations.extend([proto_obs_2])
+    ap_list = [ap1, ap2]
     obs_spec = create_observation_specs_with_shapes([shape])[0]
-
     arr = _process_maybe_compressed_observation(0, obs_spec, ap_list)
-    assert list(arr.shape) == [1, 8, 128, 64]
-    assert np.allclose(arr[0, :, :, :], expected_out_array_1, atol=0.01)
+    assert list(arr.shape) == [2, 3, 16, 8]
+    assert np.array_equal(arr[0, :, :, :], in_array_1)
+    assert np.allclose(arr[1, :, :, :], in_array_2)
 
 
 def test_process_visual_observation_bad_shape():
-    in_array_1 = np.random.rand(128, 64, 3)
+    in_array_1 = np.random.rand(16, 8, 3)
     proto_obs_1 = generate_compressed_proto_obs(in_array_1)
     ap1 = AgentInfoProto()
     ap1.observations.extend([proto_obs_1])
     ap_list = [ap1]
 
-    shape = (128, 42, 3)
+    shape = (16, 5, 3)
     obs_spec = create_observation_specs_with_shapes([shape])[0]
 
-    with pytest.raises(UnityObservationException):
+    with pytest.raises(UnrealObservationException):
         _process_maybe_compressed_observation(0, obs_spec, ap_list)
 
 
+def test_process_observation_bad_compression_type():
+    proto_obs = generate_compressed_proto_obs(np.random.rand(3, 16, 8))
+    proto_obs.compression_type = NONE
+    ap = AgentInfoProto()
+    ap.observations.extend([proto_obs])
+    obs_spec = create_observation_specs_with_shapes([(3, 16, 8)])[0]
+
+    with pytest.raises(UnrealObservationException):
+        _process_maybe_compressed_observation(0, obs_spec, [ap])
+
+
+def test_decode_float16_observation():
+    obs_proto = ObservationProto()
+    obs_proto.encoding = FLOAT16
+    obs_proto.quantized_data = np.array([0.5, -2.0, 1024.0], dtype="<f2").tobytes()
+    arr = _observation_data(obs_proto)
+    assert arr.dtype == np.float32
+    assert np.array_equal(arr, [0.5, -2.0, 1024.0])
+
+
+def test_decode_uint8_observation():
+    obs_proto = ObservationProto()
+    obs_proto.encoding = UINT8
+    obs_proto.quantization_scale = 0.5
+    obs_proto.quantization_offset = -1.0
+    obs_proto.quantized_data = np.array([0, 2, 255], dtype=np.uint8).tobytes()
+    arr = _observation_data(obs_proto)
+    assert arr.dtype == np.float32
+    assert np.array_equal(arr, [-1.0, 0.0, 126.5])
+
+
+@pytest.mark.parametrize("compress", [False, True])
+def test_decode_unsupported_encoding(compress):
+    obs_proto = generate_encoded_proto_obs(np.ones(4), FLOAT32, compress)
+    obs_proto.encoding = 42
+    with pytest.raises(UnrealObservationException):
+        _observation_data(obs_proto)
+
+
+@pytest.mark.parametrize("compress", [False, True])
+@pytest.mark.parametrize(
+    "encoding,atol", [(FLOAT32, 0.0), (FLOAT16, 1e-3), (UINT8, 2.0 / 255)]
+)
+def test_encoded_observation_round_trip(encoding, atol, compress):
+    shape = (3, 16, 8)
+    in_arrays = [np.random.rand(*shape).astype(np.float32) for _ in range(2)]
+    ap_list = []
+    for in_array in in_arrays:
+        ap = AgentInfoProto()
+        ap.observations.extend(
+            [generate_encoded_proto_obs(in_array, encoding, compress)]
+        )
+        ap_list.append(ap)
+    obs_spec = create_observation_specs_with_shapes([shape])[0]
+    arr = _process_maybe_compressed_observation(0, obs_spec, ap_list)
+    assert arr.shape == (2,) + shape
+    assert np.allclose(arr, np.stack(in_arrays), rtol=0.0, atol=atol)
+
+
 def test_batched_step_result_from_proto():
     n_agents = 10
     shapes = [(3,), (4,)]
@@ -395,7 +383,7 @@ def test_mismatch_observations_raise_in_step_result_from_proto():
     # Hack an observation to be larger, we should get an exception
     ap_list[0].observations[0].shape[0] += 1
     ap_list[0].observations[0].float_data.data.append(0.42)
-    with pytest.raises(UnityObservationException):
+    with pytest.raises(UnrealObservationException):
         steps_from_proto(ap_list, spec)
 
 
@@ -465,8 +453,8 @@ def test_action_masking_continuous():
 def test_agent_behavior_spec_from_proto():
     agent_proto = generate_list_agent_proto(1, [(3,), (4,)])[0]
     bp = BrainParametersProto()
-    bp.vector_action_size_deprecated.extend([5, 4])
-    bp.vector_action_space_type_deprecated = 0
+    bp.action_spec.num_discrete_actions = 2
+    bp.action_spec.discrete_branch_sizes.extend([5, 4])
     behavior_spec = behavior_spec_from_proto(bp, agent_proto)
     assert behavior_spec.action_spec.is_discrete()
     assert not behavior_spec.action_spec.is_continuous()
@@ -474,14 +462,67 @@ def test_agent_behavior_spec_from_proto():
     assert behavior_spec.action_spec.discrete_branches == (5, 4)
     assert behavior_spec.action_spec.discrete_size == 2
     bp = BrainParametersProto()
-    bp.vector_action_size_deprecated.extend([6])
-    bp.vector_action_space_type_deprecated = 1
+    bp.action_spec.num_continuous_actions = 6
     behavior_spec = behavior_spec_from_proto(bp, agent_proto)
     assert not behavior_spec.action_spec.is_discrete()
     assert behavior_spec.action_spec.is_continuous()
     assert behavior_spec.action_spec.continuous_size == 6
 
 
+def test_behavior_spec_from_registered_observation_specs():
+    bp = BrainParametersProto()
+    bp.action_spec.num_continuous_actions = 2
+    vector_spec = bp.observation_specs.add(name="vector", shape=[3])
+    visual_spec = bp.observation_specs.add(name="camera", shape=[2, 4, 4])
+    visual_spec.dimension_properties.extend(
+        [
+            DimensionProperty.NONE,
+            DimensionProperty.TRANSLATIONAL_EQUIVARIANCE,
+            DimensionProperty.TRANSLATIONAL_EQUIVARIANCE,
+        ]
+    )
+    # The observations of the agent match their registered spec and leave the shape out
+    agent_proto = AgentInfoProto()
+    agent_proto.observations.add().float_data.data.extend([0.1] * 3)
+    agent_proto.observations.add().float_data.data.extend([0.2] * 32)
+
+    behavior_spec = behavior_spec_from_proto(bp, agent_proto)
+    assert [spec.name for spec in behavior_spec.observation_specs] == [
+        vector_spec.name,
+        visual_spec.name,
+    ]
+    assert [spec.shape for spec in behavior_spec.observation_specs] == [
+        (3,),
+        (2, 4, 4),
+    ]
+    assert behavior_spec.observation_specs[0].dimension_property == (
+        DimensionProperty.UNSPECIFIED,
+    )
+    assert behavior_spec.observation_specs[1].dimension_property == (
+        DimensionProperty.NONE,
+        DimensionProperty.TRANSLATIONAL_EQUIVARIANCE,
+        DimensionProperty.TRANSLATIONAL_EQUIVARIANCE,
+    )
+
+    decision_steps, terminal_steps = steps_from_proto([agent_proto], behavior_spec)
+    assert decision_steps.obs[0].shape == (1, 3)
+    assert decision_steps.obs[1].shape == (1, 2, 4, 4)
+    assert np.allclose(decision_steps.obs[1], 0.2)
+    assert terminal_steps.obs[1].shape == (0, 2, 4, 4)
+
+
+def test_observation_with_shape_must_match_registered_spec():
+    bp = BrainParametersProto()
+    bp.observation_specs.add(name="camera", shape=[2, 4, 4])
+    agent_proto = AgentInfoProto()
+    agent_proto.observations.extend(
+        [generate_uncompressed_proto_obs(np.zeros((4, 4, 2)))]
+    )
+    behavior_spec = behavior_spec_from_proto(bp, agent_proto)
+    with pytest.raises(UnrealObservationException):
+        steps_from_proto([agent_proto], behavior_spec)
+
+
 def test_batched_step_result_from_proto_raises_on_infinite():
     n_agents = 10
     shapes = [(3,), (4,)]
@@ -502,3 +543,224 @@ def test_batched_step_result_from_proto_raises_on_nan():
     ap_list = generate_list_agent_proto(n_agents, shapes, nan_observations=True)
     with pytest.raises(RuntimeError):
         steps_from_proto(ap_list, behavior_spec)
+
+
+def generate_packed_proto(
+    dones: List[bool], obs_size: int, consumed_steps: Optional[List[int]] = None
+) -> UnrealRLOutputProto.PackedAgentInfoProto:
+    n_agents = len(dones)
+    packed = UnrealRLOutputProto.PackedAgentInfoProto()
+    packed.num_agents = n_agents
+    packed.ids = np.arange(n_agents, dtype="<i4").tobytes()
+    packed.rewards = np.arange(n_agents, dtype="<f4").tobytes()
+    packed.dones = np.array(dones, dtype=np.uint8).tobytes()
+    packed.max_step_reached = np.zeros(n_agents, dtype=np.uint8).tobytes()
+    packed.group_ids = np.zeros(n_agents, dtype="<i4").tobytes()
+    packed.group_rewards = np.zeros(n_agents, dtype="<f4").tobytes()
+    if consumed_steps is not None:
+        packed.consumed_steps = np.array(consumed_steps, dtype="<i4").tobytes()
+    obs = packed.observations.add()
+    obs.shape.extend([obs_size])
+    obs.quantized_data = np.full(n_agents * obs_size, 0.1, dtype="<f4").tobytes()
+    return packed
+
+
+def generate_packed_behavior_spec(obs_size: int) -> BehaviorSpec:
+    return BehaviorSpec(
+        create_observation_specs_with_shapes([(obs_size,)]),
+        ActionSpec.create_continuous(2),
+    )
+
+
+def test_packed_steps_consumed_steps():
+    dones = [False, True, False, True]
+    packed = generate_packed_proto(dones, 3, consumed_steps=[2, 4, 0, 1])
+    decision_steps, terminal_steps = steps_from_packed_proto(
+        packed, generate_packed_behavior_spec(3)
+    )
+    assert decision_steps.stale_actions is None
+    assert terminal_steps.stale_actions is None
+    assert list(decision_steps.consumed_steps) == [2, 0]
+    assert list(terminal_steps.consumed_steps) == [4, 1]
+    assert decision_steps[0].consumed_steps == 2
+    assert not decision_steps[0].stale_actions
+    assert decision_steps[2].consumed_steps == 0
+    assert terminal_steps[3].consumed_steps == 1
+    assert not terminal_steps[3].stale_actions
+    assert decision_steps.obs[0].shape == (2, 3)
+
+
+def test_packed_steps_without_consumed_steps():
+    packed = generate_packed_proto([False, True], 3)
+    decision_steps, terminal_steps = steps_from_packed_proto(
+        packed, generate_packed_behavior_spec(3)
+    )
+    assert decision_steps.stale_actions is None
+    assert decision_steps.consumed_steps is None
+    assert terminal_steps.consumed_steps is None
+    assert decision_steps[0].consumed_steps == 0
+    assert not terminal_steps[1].stale_actions
+
+
+def generate_shared_agent_protos(
+    shared_with: List[int], shape: Tuple[int, ...], dones: List[bool] = None
+) -> List[AgentInfoProto]:
+    """
+    Agents whose shared_with is 0 send an observation filled with their id, the
+    others refer to the agent at shared_with - 1 and send no data.
+    """
+    ap_list = []
+    for agent_id, shared in enumerate(shared_with):
+        ap = AgentInfoProto(id=agent_id, done=bool(dones and dones[agent_id]))
+        obs_proto = ap.observations.add()
+        if shared:
+            obs_proto.shared_with = shared
+        else:
+            obs_proto.shape.extend(shape)
+            obs_proto.float_data.data.extend([float(agent_id)] * int(np.prod(shape)))
+        ap_list.append(ap)
+    return ap_list
+
+
+def test_shared_observation_owned_by_terminal_agent():
+    # Agent 0 ends its episode while the agents that refer to it still decide
+    ap_list = generate_shared_agent_protos([0, 1, 1], (3,), dones=[True, False, False])
+    spec = BehaviorSpec(
+        create_observation_specs_with_shapes([(3,)]), ActionSpec.create_continuous(2)
+    )
+    decision_steps, terminal_steps = steps_from_proto(ap_list, spec)
+    assert list(decision_steps.agent_id) == [1, 2]
+    assert np.array_equal(decision_steps.obs[0], np.zeros((2, 3)))
+    assert list(terminal_steps.agent_id) == [0]
+    assert np.array_equal(terminal_steps.obs[0], np.zeros((1, 3)))
+
+
+def test_shared_observation_per_group():
+    # Agents 0 and 1 form one group, agents 2 and 3 another
+    ap_list = generate_shared_agent_protos([0, 1, 0, 3], (3,))
+    obs_spec = create_observation_specs_with_shapes([(3,)])[0]
+    arr = _process_shared_observation(0, obs_spec, ap_list)
+    assert arr.shape == (4, 3)
+    assert np.array_equal(arr[:, 0], [0, 0, 2, 2])
+
+
+def test_shared_visual_observation_for_whole_behavior():
+    shape = (2, 4, 4)
+    ap_list = generate_shared_agent_protos([0, 1, 1, 1], shape, dones=[False] * 4)
+    spec = BehaviorSpec(
+        create_observation_specs_with_shapes([shape]), ActionSpec.create_continuous(2)
+    )
+    decision_steps, terminal_steps = steps_from_proto(ap_list, spec)
+    assert decision_steps.obs[0].shape == (4,) + shape
+    assert np.array_equal(decision_steps.obs[0], np.zeros((4,) + shape))
+    assert terminal_steps.obs[0].shape == (0,) + shape
+
+
+@pytest.mark.parametrize(
+    "shared_with",
+    [
+        # Agent 2 refers to an agent that shares itself
+        [0, 1, 2],
+        # Agent 1 refers to an agent that is not in the message
+        [0, 4, 0],
+    ],
+)
+def test_shared_observation_invalid_reference(shared_with):
+    ap_list = generate_shared_agent_protos(shared_with, (3,))
+    obs_spec = create_observation_specs_with_shapes([(3,)])[0]
+    with pytest.raises(UnrealObservationException):
+        _process_shared_observation(0, obs_spec, ap_list)
+
+
+def test_packed_shared_observation_rows():
+    packed = generate_packed_proto([False, True, False], 3)
+    obs = packed.observations[0]
+    # Two distinct rows shared by the three agents
+    obs.quantized_data = np.array([[1] * 3, [2] * 3], dtype="<f4").tobytes()
+    obs.shared_rows = np.array([1, 0, 1], dtype="<i4").tobytes()
+    decision_steps, terminal_steps = steps_from_packed_proto(
+        packed, generate_packed_behavior_spec(3)
+    )
+    assert np.array_equal(decision_steps.obs[0][:, 0], [2, 2])
+    assert np.array_equal(terminal_steps.obs[0][:, 0], [1])
+
+    obs.shared_rows = np.array([1, 0, 2], dtype="<i4").tobytes()
+    with pytest.raises(UnrealObservationException):
+        steps_from_packed_proto(packed, generate_packed_behavior_spec(3))
+
+
+def generate_delta_agent_proto(
+    agent_id: int, data: List[float], delta_indices: List[int] = None, done=False
+) -> AgentInfoProto:
+    ap = AgentInfoProto(id=agent_id, done=done)
+    obs_proto = ap.observations.add()
+    obs_proto.shape.append(4)
+    obs_proto.float_data.data.extend(data)
+    if delta_indices is not None:
+        obs_proto.is_delta = True
+        obs_proto.delta_indices.extend(delta_indices)
+    return ap
+
+
+def test_delta_decoder_applies_delta_onto_base():
+    decoder = ObservationDeltaDecoder()
+    decoder.decode("behavior", [generate_delta_agent_proto(0, [1, 2, 3, 4])])
+
+    ap = generate_delta_agent_proto(0, [20, 40], delta_indices=[1, 3])
+    decoder.decode("behavior", [ap])
+    obs_proto = ap.observations[0]
+    assert list(obs_proto.float_data.data) == [1, 20, 3, 40]
+    assert not obs_proto.is_delta
+    assert len(obs_proto.delta_indices) == 0
+
+    # The rebuilt observation is the base of the next delta
+    ap = generate_delta_agent_proto(0, [9], delta_indices=[0])
+    decoder.decode("behavior", [ap])
+    assert list(ap.observations[0].float_data.data) == [9, 20, 3, 40]
+
+
+def test_delta_decoder_keeps_a_base_per_agent_and_behavior():
+    decoder = ObservationDeltaDecoder()
+    decoder.decode(
+        "behavior",
+        [
+            generate_delta_agent_proto(0, [1, 1, 1, 1]),
+            generate_delta_agent_proto(1, [2, 2, 2, 2]),
+        ],
+    )
+    decoder.decode("other", [generate_delta_agent_proto(0, [3, 3, 3, 3])])
+
+    ap_list = [
+        generate_delta_agent_proto(1, [5], delta_indices=[2]),
+        generate_delta_agent_proto(0, [6], delta_indices=[0]),
+    ]
+    decoder.decode("behavior", ap_list)
+    assert list(ap_list[0].observations[0].float_data.data) == [2, 2, 5, 2]
+    assert list(ap_list[1].observations[0].float_data.data) == [6, 1, 1, 1]
+
+
+def test_delta_decoder_raises_without_base():
+    decoder = ObservationDeltaDecoder()
+    with pytest.raises(UnrealObservationException):
+        decoder.decode("behavior", [generate_delta_agent_proto(0, [1], [0])])
+
+
+def test_delta_decoder_drops_base_of_done_agent():
+    decoder = ObservationDeltaDecoder()
+    decoder.decode("behavior", [generate_delta_agent_proto(0, [1, 2, 3, 4])])
+
+    # The last observation of the episode is still rebuilt from the base
+    ap = generate_delta_agent_proto(0, [7], delta_indices=[2], done=True)
+    decoder.decode("behavior", [ap])
+    assert list(ap.observations[0].float_data.data) == [1, 2, 7, 4]
+
+    with pytest.raises(UnrealObservationException):
+        decoder.decode("behavior", [generate_delta_agent_proto(0, [1], [0])])
+
+
+def test_delta_decoder_clear():
+    decoder = ObservationDeltaDecoder()
+    decoder.decode("behavior", [generate_delta_agent_proto(0, [1, 2, 3, 4])])
+    decoder.clear()
+    with pytest.raises(UnrealObservationException):
+        decoder.decode("behavior", [generate_delta_agent_proto(0, [1], [0])])
@@ -117,7 +117,7 @@ def test_agent_manager_stats_report(aggregation_type):
 
     values = range(5)
 
-    env_stats = {"stat": [(i, aggregation_type) for i in values]}
+    env_stats = {"stat": [(i, aggregation_type, 1) for i in values]}
     manager.record_environment_stats(env_stats, 0)
     summary = stats_reporter.get_stats_summaries("stat")
     aggregation_result = {
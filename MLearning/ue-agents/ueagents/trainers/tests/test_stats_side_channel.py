@@ -0,0 +1,67 @@
+import pytest
+
+from ueagents_envs.side_channel.incoming_message import IncomingMessage
+from ueagents_envs.side_channel.outgoing_message import OutgoingMessage
+from ueagents_envs.side_channel.stats_side_channel import (
+    StatsSideChannel,
+    StatsAggregationMethod,
+)
+from ueagents.trainers.env_manager import AgentManager
+from ueagents.trainers.stats import StatsReporter
+
+
+def _write_entry(msg, key, value, agg_type, count=None):
+    msg.write_string(key)
+    msg.write_float32(value)
+    msg.write_int32(agg_type.value)
+    if count is not None:
+        msg.write_int32(count)
+
+
+def _receive(channel, msg):
+    channel.on_message_received(IncomingMessage(bytes(msg.buffer)))
+
+
+def test_stats_side_channel_reads_every_entry():
+    channel = StatsSideChannel()
+    msg = OutgoingMessage()
+    _write_entry(msg, "reward", 2.0, StatsAggregationMethod.AVERAGE, 4)
+    _write_entry(msg, "kills", 3.0, StatsAggregationMethod.SUM, 3)
+    _write_entry(msg, "level", 7.0, StatsAggregationMethod.MOST_RECENT, 1)
+    _receive(channel, msg)
+
+    stats = channel.get_and_reset_stats()
+    assert stats["reward"] == [(2.0, StatsAggregationMethod.AVERAGE, 4)]
+    assert stats["kills"] == [(3.0, StatsAggregationMethod.SUM, 3)]
+    assert stats["level"] == [(7.0, StatsAggregationMethod.MOST_RECENT, 1)]
+    assert channel.get_and_reset_stats() == {}
+
+
+def test_stats_side_channel_single_entry_without_count():
+    channel = StatsSideChannel()
+    msg = OutgoingMessage()
+    _write_entry(msg, "reward", 1.5, StatsAggregationMethod.AVERAGE)
+    _receive(channel, msg)
+
+    assert channel.get_and_reset_stats()["reward"] == [
+        (1.5, StatsAggregationMethod.AVERAGE, 1)
+    ]
+
+
+def test_stats_side_channel_weighted_average():
+    channel = StatsSideChannel()
+    for value, count in [(1.0, 3), (5.0, 1)]:
+        msg = OutgoingMessage()
+        _write_entry(msg, "reward", value, StatsAggregationMethod.AVERAGE, count)
+        _receive(channel, msg)
+
+    stats_reporter = StatsReporter("stats_side_channel")
+    manager = AgentManager(None, "behaviorName", stats_reporter)
+    manager.record_environment_stats(channel.get_and_reset_stats(), 0)
+
+    summary = stats_reporter.get_stats_summaries("reward")
+    assert summary.full_dist == [1.0, 5.0]
+    assert summary.num == 4
+    assert summary.mean == pytest.approx(2.0)
+    assert summary.std == pytest.approx(3.0**0.5)
+    stats_reporter.write_stats(0)
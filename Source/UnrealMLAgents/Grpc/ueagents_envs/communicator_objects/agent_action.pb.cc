@@ -33,6 +33,8 @@ PROTOBUF_CONSTEXPR AgentActionProto::AgentActionProto(
 
   , /*decltype(_impl_.value_)*/ 0
 
+  , /*decltype(_impl_.num_steps_)*/ 0
+
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct AgentActionProtoDefaultTypeInternal {
   PROTOBUF_CONSTEXPR AgentActionProtoDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
@@ -63,6 +65,7 @@ const ::uint32_t TableStruct_ueagents_5fenvs_2fcommunicator_5fobjects_2fagent_5f
     PROTOBUF_FIELD_OFFSET(::communicator_objects::AgentActionProto, _impl_.value_),
     PROTOBUF_FIELD_OFFSET(::communicator_objects::AgentActionProto, _impl_.continuous_actions_),
     PROTOBUF_FIELD_OFFSET(::communicator_objects::AgentActionProto, _impl_.discrete_actions_),
+    PROTOBUF_FIELD_OFFSET(::communicator_objects::AgentActionProto, _impl_.num_steps_),
 };
 
 static const ::_pbi::MigrationSchema
@@ -75,16 +78,16 @@ static const ::_pb::Message* const file_default_instances[] = {
 };
 const char descriptor_table_protodef_ueagents_5fenvs_2fcommunicator_5fobjects_2fagent_5faction_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
     "\n5ueagents_envs/communicator_objects/age"
-    "nt_action.proto\022\024communicator_objects\"W\n"
+    "nt_action.proto\022\024communicator_objects\"j\n"
     "\020AgentActionProto\022\r\n\005value\030\001 \001(\002\022\032\n\022cont"
     "inuous_actions\030\002 \003(\002\022\030\n\020discrete_actions"
-    "\030\003 \003(\005b\006proto3"
+    "\030\003 \003(\005\022\021\n\tnum_steps\030\004 \001(\005b\006proto3"
 };
 static ::absl::once_flag descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2fagent_5faction_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2fagent_5faction_2eproto = {
     false,
     false,
-    174,
+    193,
     descriptor_table_protodef_ueagents_5fenvs_2fcommunicator_5fobjects_2fagent_5faction_2eproto,
     "ueagents_envs/communicator_objects/agent_action.proto",
     &descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2fagent_5faction_2eproto_once,
@@ -139,10 +142,14 @@ AgentActionProto::AgentActionProto(const AgentActionProto& from)
 
     , decltype(_impl_.value_) {}
 
+    , decltype(_impl_.num_steps_) {}
+
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _this->_impl_.value_ = from._impl_.value_;
+  ::memcpy(&_impl_.value_, &from._impl_.value_,
+    static_cast<::size_t>(reinterpret_cast<char*>(&_impl_.num_steps_) -
+    reinterpret_cast<char*>(&_impl_.value_)) + sizeof(_impl_.num_steps_));
   // @@protoc_insertion_point(copy_constructor:communicator_objects.AgentActionProto)
 }
 
@@ -156,6 +163,8 @@ inline void AgentActionProto::SharedCtor(::_pb::Arena* arena) {
 
     , decltype(_impl_.value_) { 0 }
 
+    , decltype(_impl_.num_steps_) { 0 }
+
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
@@ -187,7 +196,9 @@ void AgentActionProto::Clear() {
 
   _internal_mutable_continuous_actions()->Clear();
   _internal_mutable_discrete_actions()->Clear();
-  _impl_.value_ = 0;
+  ::memset(&_impl_.value_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.num_steps_) -
+      reinterpret_cast<char*>(&_impl_.value_)) + sizeof(_impl_.num_steps_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -230,6 +241,15 @@ const char* AgentActionProto::_InternalParse(const char* ptr, ::_pbi::ParseConte
           goto handle_unusual;
         }
         continue;
+      // int32 num_steps = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 32)) {
+          _impl_.num_steps_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else {
+          goto handle_unusual;
+        }
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -284,6 +304,13 @@ failure:
     }
   }
 
+  // int32 num_steps = 4;
+  if (this->_internal_num_steps() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(
+        4, this->_internal_num_steps(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -336,6 +363,12 @@ failure:
     total_size += 5;
   }
 
+  // int32 num_steps = 4;
+  if (this->_internal_num_steps() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+        this->_internal_num_steps());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -363,6 +396,9 @@ void AgentActionProto::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const
   if (raw_value != 0) {
     _this->_internal_set_value(from._internal_value());
   }
+  if (from._internal_num_steps() != 0) {
+    _this->_internal_set_num_steps(from._internal_num_steps());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -382,8 +418,12 @@ void AgentActionProto::InternalSwap(AgentActionProto* other) {
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   _impl_.continuous_actions_.InternalSwap(&other->_impl_.continuous_actions_);
   _impl_.discrete_actions_.InternalSwap(&other->_impl_.discrete_actions_);
-
-  swap(_impl_.value_, other->_impl_.value_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(AgentActionProto, _impl_.num_steps_)
+      + sizeof(AgentActionProto::_impl_.num_steps_)
+      - PROTOBUF_FIELD_OFFSET(AgentActionProto, _impl_.value_)>(
+          reinterpret_cast<char*>(&_impl_.value_),
+          reinterpret_cast<char*>(&other->_impl_.value_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata AgentActionProto::GetMetadata() const {
@@ -200,6 +200,7 @@ class AgentActionProto final :
     kContinuousActionsFieldNumber = 2,
     kDiscreteActionsFieldNumber = 3,
     kValueFieldNumber = 1,
+    kNumStepsFieldNumber = 4,
   };
   // repeated float continuous_actions = 2;
   int continuous_actions_size() const;
@@ -250,6 +251,16 @@ class AgentActionProto final :
   float _internal_value() const;
   void _internal_set_value(float value);
 
+  public:
+  // int32 num_steps = 4;
+  void clear_num_steps() ;
+  ::int32_t num_steps() const;
+  void set_num_steps(::int32_t value);
+
+  private:
+  ::int32_t _internal_num_steps() const;
+  void _internal_set_num_steps(::int32_t value);
+
   public:
   // @@protoc_insertion_point(class_scope:communicator_objects.AgentActionProto)
  private:
@@ -263,6 +274,7 @@ class AgentActionProto final :
     ::PROTOBUF_NAMESPACE_ID::RepeatedField<::int32_t> discrete_actions_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _discrete_actions_cached_byte_size_;
     float value_;
+    ::int32_t num_steps_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -305,6 +317,26 @@ inline void AgentActionProto::_internal_set_value(float value) {
   _impl_.value_ = value;
 }
 
+// int32 num_steps = 4;
+inline void AgentActionProto::clear_num_steps() {
+  _impl_.num_steps_ = 0;
+}
+inline ::int32_t AgentActionProto::num_steps() const {
+  // @@protoc_insertion_point(field_get:communicator_objects.AgentActionProto.num_steps)
+  return _internal_num_steps();
+}
+inline void AgentActionProto::set_num_steps(::int32_t value) {
+  _internal_set_num_steps(value);
+  // @@protoc_insertion_point(field_set:communicator_objects.AgentActionProto.num_steps)
+}
+inline ::int32_t AgentActionProto::_internal_num_steps() const {
+  return _impl_.num_steps_;
+}
+inline void AgentActionProto::_internal_set_num_steps(::int32_t value) {
+  ;
+  _impl_.num_steps_ = value;
+}
+
 // repeated float continuous_actions = 2;
 inline int AgentActionProto::_internal_continuous_actions_size() const {
   return _impl_.continuous_actions_.size();
@@ -41,6 +41,10 @@ PROTOBUF_CONSTEXPR AgentInfoProto::AgentInfoProto(
 
   , /*decltype(_impl_.group_reward_)*/ 0
 
+  , /*decltype(_impl_.stale_actions_)*/ false
+
+  , /*decltype(_impl_.consumed_steps_)*/ 0
+
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct AgentInfoProtoDefaultTypeInternal {
   PROTOBUF_CONSTEXPR AgentInfoProtoDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
@@ -76,6 +80,8 @@ const ::uint32_t TableStruct_ueagents_5fenvs_2fcommunicator_5fobjects_2fagent_5f
     PROTOBUF_FIELD_OFFSET(::communicator_objects::AgentInfoProto, _impl_.observations_),
     PROTOBUF_FIELD_OFFSET(::communicator_objects::AgentInfoProto, _impl_.group_id_),
     PROTOBUF_FIELD_OFFSET(::communicator_objects::AgentInfoProto, _impl_.group_reward_),
+    PROTOBUF_FIELD_OFFSET(::communicator_objects::AgentInfoProto, _impl_.stale_actions_),
+    PROTOBUF_FIELD_OFFSET(::communicator_objects::AgentInfoProto, _impl_.consumed_steps_),
 };
 
 static const ::_pbi::MigrationSchema
@@ -90,12 +96,13 @@ const char descriptor_table_protodef_ueagents_5fenvs_2fcommunicator_5fobjects_2f
     "\n3ueagents_envs/communicator_objects/age"
     "nt_info.proto\022\024communicator_objects\0324uea"
     "gents_envs/communicator_objects/observat"
-    "ion.proto\"\317\001\n\016AgentInfoProto\022\016\n\006reward\030\001"
+    "ion.proto\"\376\001\n\016AgentInfoProto\022\016\n\006reward\030\001"
     " \001(\002\022\014\n\004done\030\002 \001(\010\022\030\n\020max_step_reached\030\003"
     " \001(\010\022\n\n\002id\030\004 \001(\005\022\023\n\013action_mask\030\005 \003(\010\022<\n"
     "\014observations\030\006 \003(\0132&.communicator_objec"
     "ts.ObservationProto\022\020\n\010group_id\030\007 \001(\005\022\024\n"
-    "\014group_reward\030\010 \001(\002b\006proto3"
+    "\014group_reward\030\010 \001(\002\022\025\n\rstale_actions\030\t \001"
+    "(\010\022\026\n\016consumed_steps\030\n \001(\005b\006proto3"
 };
 static const ::_pbi::DescriptorTable* const descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2fagent_5finfo_2eproto_deps[1] =
     {
@@ -105,7 +112,7 @@ static ::absl::once_flag descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjec
 const ::_pbi::DescriptorTable descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2fagent_5finfo_2eproto = {
     false,
     false,
-    347,
+    394,
     descriptor_table_protodef_ueagents_5fenvs_2fcommunicator_5fobjects_2fagent_5finfo_2eproto,
     "ueagents_envs/communicator_objects/agent_info.proto",
     &descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2fagent_5finfo_2eproto_once,
@@ -171,12 +178,16 @@ AgentInfoProto::AgentInfoProto(const AgentInfoProto& from)
 
     , decltype(_impl_.group_reward_) {}
 
+    , decltype(_impl_.stale_actions_) {}
+
+    , decltype(_impl_.consumed_steps_) {}
+
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::memcpy(&_impl_.reward_, &from._impl_.reward_,
-    static_cast<::size_t>(reinterpret_cast<char*>(&_impl_.group_reward_) -
-    reinterpret_cast<char*>(&_impl_.reward_)) + sizeof(_impl_.group_reward_));
+    static_cast<::size_t>(reinterpret_cast<char*>(&_impl_.consumed_steps_) -
+    reinterpret_cast<char*>(&_impl_.reward_)) + sizeof(_impl_.consumed_steps_));
   // @@protoc_insertion_point(copy_constructor:communicator_objects.AgentInfoProto)
 }
 
@@ -198,6 +209,10 @@ inline void AgentInfoProto::SharedCtor(::_pb::Arena* arena) {
 
     , decltype(_impl_.group_reward_) { 0 }
 
+    , decltype(_impl_.stale_actions_) { false }
+
+    , decltype(_impl_.consumed_steps_) { 0 }
+
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
@@ -230,8 +245,8 @@ void AgentInfoProto::Clear() {
   _internal_mutable_action_mask()->Clear();
   _internal_mutable_observations()->Clear();
   ::memset(&_impl_.reward_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.group_reward_) -
-      reinterpret_cast<char*>(&_impl_.reward_)) + sizeof(_impl_.group_reward_));
+      reinterpret_cast<char*>(&_impl_.consumed_steps_) -
+      reinterpret_cast<char*>(&_impl_.reward_)) + sizeof(_impl_.consumed_steps_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -322,6 +337,25 @@ const char* AgentInfoProto::_InternalParse(const char* ptr, ::_pbi::ParseContext
           goto handle_unusual;
         }
         continue;
+      // bool stale_actions = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 72)) {
+          #pragma warning(disable: 4800)
+          _impl_.stale_actions_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else {
+          goto handle_unusual;
+        }
+        continue;
+      // int32 consumed_steps = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 80)) {
+          _impl_.consumed_steps_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else {
+          goto handle_unusual;
+        }
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -414,6 +448,20 @@ failure:
         8, this->_internal_group_reward(), target);
   }
 
+  // bool stale_actions = 9;
+  if (this->_internal_stale_actions() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(
+        9, this->_internal_stale_actions(), target);
+  }
+
+  // int32 consumed_steps = 10;
+  if (this->_internal_consumed_steps() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(
+        10, this->_internal_consumed_steps(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -490,6 +538,17 @@ failure:
     total_size += 5;
   }
 
+  // bool stale_actions = 9;
+  if (this->_internal_stale_actions() != 0) {
+    total_size += 2;
+  }
+
+  // int32 consumed_steps = 10;
+  if (this->_internal_consumed_steps() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+        this->_internal_consumed_steps());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -536,6 +595,12 @@ void AgentInfoProto::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const :
   if (raw_group_reward != 0) {
     _this->_internal_set_group_reward(from._internal_group_reward());
   }
+  if (from._internal_stale_actions() != 0) {
+    _this->_internal_set_stale_actions(from._internal_stale_actions());
+  }
+  if (from._internal_consumed_steps() != 0) {
+    _this->_internal_set_consumed_steps(from._internal_consumed_steps());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -556,8 +621,8 @@ void AgentInfoProto::InternalSwap(AgentInfoProto* other) {
   _impl_.action_mask_.InternalSwap(&other->_impl_.action_mask_);
   _internal_mutable_observations()->InternalSwap(other->_internal_mutable_observations());
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(AgentInfoProto, _impl_.group_reward_)
-      + sizeof(AgentInfoProto::_impl_.group_reward_)
+      PROTOBUF_FIELD_OFFSET(AgentInfoProto, _impl_.consumed_steps_)
+      + sizeof(AgentInfoProto::_impl_.consumed_steps_)
       - PROTOBUF_FIELD_OFFSET(AgentInfoProto, _impl_.reward_)>(
           reinterpret_cast<char*>(&_impl_.reward_),
           reinterpret_cast<char*>(&other->_impl_.reward_));
@@ -206,6 +206,8 @@ class AgentInfoProto final :
     kIdFieldNumber = 4,
     kGroupIdFieldNumber = 7,
     kGroupRewardFieldNumber = 8,
+    kStaleActionsFieldNumber = 9,
+    kConsumedStepsFieldNumber = 10,
   };
   // repeated bool action_mask = 5;
   int action_mask_size() const;
@@ -306,6 +308,26 @@ class AgentInfoProto final :
   float _internal_group_reward() const;
   void _internal_set_group_reward(float value);
 
+  public:
+  // bool stale_actions = 9;
+  void clear_stale_actions() ;
+  bool stale_actions() const;
+  void set_stale_actions(bool value);
+
+  private:
+  bool _internal_stale_actions() const;
+  void _internal_set_stale_actions(bool value);
+
+  public:
+  // int32 consumed_steps = 10;
+  void clear_consumed_steps() ;
+  ::int32_t consumed_steps() const;
+  void set_consumed_steps(::int32_t value);
+
+  private:
+  ::int32_t _internal_consumed_steps() const;
+  void _internal_set_consumed_steps(::int32_t value);
+
   public:
   // @@protoc_insertion_point(class_scope:communicator_objects.AgentInfoProto)
  private:
@@ -323,6 +345,8 @@ class AgentInfoProto final :
     ::int32_t id_;
     ::int32_t group_id_;
     float group_reward_;
+    bool stale_actions_;
+    ::int32_t consumed_steps_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -554,6 +578,46 @@ inline void AgentInfoProto::_internal_set_group_reward(float value) {
   _impl_.group_reward_ = value;
 }
 
+// bool stale_actions = 9;
+inline void AgentInfoProto::clear_stale_actions() {
+  _impl_.stale_actions_ = false;
+}
+inline bool AgentInfoProto::stale_actions() const {
+  // @@protoc_insertion_point(field_get:communicator_objects.AgentInfoProto.stale_actions)
+  return _internal_stale_actions();
+}
+inline void AgentInfoProto::set_stale_actions(bool value) {
+  _internal_set_stale_actions(value);
+  // @@protoc_insertion_point(field_set:communicator_objects.AgentInfoProto.stale_actions)
+}
+inline bool AgentInfoProto::_internal_stale_actions() const {
+  return _impl_.stale_actions_;
+}
+inline void AgentInfoProto::_internal_set_stale_actions(bool value) {
+  ;
+  _impl_.stale_actions_ = value;
+}
+
+// int32 consumed_steps = 10;
+inline void AgentInfoProto::clear_consumed_steps() {
+  _impl_.consumed_steps_ = 0;
+}
+inline ::int32_t AgentInfoProto::consumed_steps() const {
+  // @@protoc_insertion_point(field_get:communicator_objects.AgentInfoProto.consumed_steps)
+  return _internal_consumed_steps();
+}
+inline void AgentInfoProto::set_consumed_steps(::int32_t value) {
+  _internal_set_consumed_steps(value);
+  // @@protoc_insertion_point(field_set:communicator_objects.AgentInfoProto.consumed_steps)
+}
+inline ::int32_t AgentInfoProto::_internal_consumed_steps() const {
+  return _impl_.consumed_steps_;
+}
+inline void AgentInfoProto::_internal_set_consumed_steps(::int32_t value) {
+  ;
+  _impl_.consumed_steps_ = value;
+}
+
 #ifdef __GNUC__
 #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -50,6 +50,7 @@ PROTOBUF_CONSTEXPR BrainParametersProto::BrainParametersProto(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_._has_bits_)*/{}
   , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.observation_specs_)*/{}
   , /*decltype(_impl_.brain_name_)*/ {
     &::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized {}
   }
@@ -98,15 +99,17 @@ const ::uint32_t TableStruct_ueagents_5fenvs_2fcommunicator_5fobjects_2fbrain_5f
     PROTOBUF_FIELD_OFFSET(::communicator_objects::BrainParametersProto, _impl_.brain_name_),
     PROTOBUF_FIELD_OFFSET(::communicator_objects::BrainParametersProto, _impl_.is_training_),
     PROTOBUF_FIELD_OFFSET(::communicator_objects::BrainParametersProto, _impl_.action_spec_),
+    PROTOBUF_FIELD_OFFSET(::communicator_objects::BrainParametersProto, _impl_.observation_specs_),
     ~0u,
     ~0u,
     0,
+    ~0u,
 };
 
 static const ::_pbi::MigrationSchema
     schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
         { 0, -1, -1, sizeof(::communicator_objects::ActionSpecProto)},
-        { 12, 23, -1, sizeof(::communicator_objects::BrainParametersProto)},
+        { 12, 24, -1, sizeof(::communicator_objects::BrainParametersProto)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
@@ -116,24 +119,31 @@ static const ::_pb::Message* const file_default_instances[] = {
 const char descriptor_table_protodef_ueagents_5fenvs_2fcommunicator_5fobjects_2fbrain_5fparameters_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
     "\n9ueagents_envs/communicator_objects/bra"
     "in_parameters.proto\022\024communicator_object"
-    "s\"\213\001\n\017ActionSpecProto\022\036\n\026num_continuous_"
-    "actions\030\001 \001(\005\022\034\n\024num_discrete_actions\030\002 "
-    "\001(\005\022\035\n\025discrete_branch_sizes\030\003 \003(\005\022\033\n\023ac"
-    "tion_descriptions\030\004 \003(\t\"{\n\024BrainParamete"
-    "rsProto\022\022\n\nbrain_name\030\001 \001(\t\022\023\n\013is_traini"
-    "ng\030\002 \001(\010\022:\n\013action_spec\030\003 \001(\0132%.communic"
-    "ator_objects.ActionSpecProtob\006proto3"
+    "s\0324ueagents_envs/communicator_objects/ob"
+    "servation.proto\"\213\001\n\017ActionSpecProto\022\036\n\026n"
+    "um_continuous_actions\030\001 \001(\005\022\034\n\024num_discr"
+    "ete_actions\030\002 \001(\005\022\035\n\025discrete_branch_siz"
+    "es\030\003 \003(\005\022\033\n\023action_descriptions\030\004 \003(\t\"\276\001"
+    "\n\024BrainParametersProto\022\022\n\nbrain_name\030\001 \001"
+    "(\t\022\023\n\013is_training\030\002 \001(\010\022:\n\013action_spec\030\003"
+    " \001(\0132%.communicator_objects.ActionSpecPr"
+    "oto\022A\n\021observation_specs\030\004 \003(\0132&.communi"
+    "cator_objects.ObservationProtob\006proto3"
+};
+static const ::_pbi::DescriptorTable* const descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2fbrain_5fparameters_2eproto_deps[1] =
+    {
+        &::descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2fobservation_2eproto,
 };
 static ::absl::once_flag descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2fbrain_5fparameters_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2fbrain_5fparameters_2eproto = {
     false,
     false,
-    356,
+    478,
     descriptor_table_protodef_ueagents_5fenvs_2fcommunicator_5fobjects_2fbrain_5fparameters_2eproto,
     "ueagents_envs/communicator_objects/brain_parameters.proto",
     &descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2fbrain_5fparameters_2eproto_once,
-    nullptr,
-    0,
+    descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2fbrain_5fparameters_2eproto_deps,
+    1,
     2,
     schemas,
     file_default_instances,
@@ -478,6 +488,9 @@ const ::communicator_objects::ActionSpecProto&
 BrainParametersProto::_Internal::action_spec(const BrainParametersProto* msg) {
   return *msg->_impl_.action_spec_;
 }
+void BrainParametersProto::clear_observation_specs() {
+  _internal_mutable_observation_specs()->Clear();
+}
 BrainParametersProto::BrainParametersProto(::PROTOBUF_NAMESPACE_ID::Arena* arena)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
   SharedCtor(arena);
@@ -489,6 +502,7 @@ BrainParametersProto::BrainParametersProto(const BrainParametersProto& from)
   new (&_impl_) Impl_{
       decltype(_impl_._has_bits_){from._impl_._has_bits_}
     , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.observation_specs_){from._impl_.observation_specs_}
     , decltype(_impl_.brain_name_) {}
 
     , decltype(_impl_.action_spec_){nullptr}
@@ -515,6 +529,7 @@ inline void BrainParametersProto::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_{
       decltype(_impl_._has_bits_){}
     , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.observation_specs_){arena}
     , decltype(_impl_.brain_name_) {}
 
     , decltype(_impl_.action_spec_){nullptr}
@@ -538,6 +553,7 @@ BrainParametersProto::~BrainParametersProto() {
 
 inline void BrainParametersProto::SharedDtor() {
   ABSL_DCHECK(GetArenaForAllocation() == nullptr);
+  _internal_mutable_observation_specs()->~RepeatedPtrField();
   _impl_.brain_name_.Destroy();
   if (this != internal_default_instance()) delete _impl_.action_spec_;
 }
@@ -552,6 +568,7 @@ void BrainParametersProto::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  _internal_mutable_observation_specs()->Clear();
   _impl_.brain_name_.ClearToEmpty();
   cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x00000001u) {
@@ -601,6 +618,20 @@ const char* BrainParametersProto::_InternalParse(const char* ptr, ::_pbi::ParseC
           goto handle_unusual;
         }
         continue;
+      // repeated .communicator_objects.ObservationProto observation_specs = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_observation_specs(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else {
+          goto handle_unusual;
+        }
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -654,6 +685,14 @@ failure:
         _Internal::action_spec(this).GetCachedSize(), target, stream);
   }
 
+  // repeated .communicator_objects.ObservationProto observation_specs = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_observation_specs_size()); i < n; i++) {
+    const auto& repfield = this->_internal_observation_specs(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -670,6 +709,13 @@ failure:
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  // repeated .communicator_objects.ObservationProto observation_specs = 4;
+  total_size += 1UL * this->_internal_observation_specs_size();
+  for (const auto& msg : this->_internal_observation_specs()) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
   // string brain_name = 1;
   if (!this->_internal_brain_name().empty()) {
     total_size += 1 + ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
@@ -707,6 +753,7 @@ void BrainParametersProto::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, c
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
+  _this->_internal_mutable_observation_specs()->MergeFrom(from._internal_observation_specs());
   if (!from._internal_brain_name().empty()) {
     _this->_internal_set_brain_name(from._internal_brain_name());
   }
@@ -737,6 +784,7 @@ void BrainParametersProto::InternalSwap(BrainParametersProto* other) {
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _internal_mutable_observation_specs()->InternalSwap(other->_internal_mutable_observation_specs());
   ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.brain_name_, lhs_arena,
                                        &other->_impl_.brain_name_, rhs_arena);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
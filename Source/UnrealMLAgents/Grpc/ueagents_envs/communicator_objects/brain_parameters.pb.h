@@ -33,6 +33,7 @@
 #include "google/protobuf/repeated_field.h"  // IWYU pragma: export
 #include "google/protobuf/extension_set.h"  // IWYU pragma: export
 #include "google/protobuf/unknown_field_set.h"
+#include "ueagents_envs/communicator_objects/observation.pb.h"
 // @@protoc_insertion_point(includes)
 
 // Must be included last.
@@ -424,10 +425,31 @@ class BrainParametersProto final :
   // accessors -------------------------------------------------------
 
   enum : int {
+    kObservationSpecsFieldNumber = 4,
     kBrainNameFieldNumber = 1,
     kActionSpecFieldNumber = 3,
     kIsTrainingFieldNumber = 2,
   };
+  // repeated .communicator_objects.ObservationProto observation_specs = 4;
+  int observation_specs_size() const;
+  private:
+  int _internal_observation_specs_size() const;
+
+  public:
+  void clear_observation_specs() ;
+  ::communicator_objects::ObservationProto* mutable_observation_specs(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::communicator_objects::ObservationProto >*
+      mutable_observation_specs();
+  private:
+  const ::communicator_objects::ObservationProto& _internal_observation_specs(int index) const;
+  ::communicator_objects::ObservationProto* _internal_add_observation_specs();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<::communicator_objects::ObservationProto>& _internal_observation_specs() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<::communicator_objects::ObservationProto>* _internal_mutable_observation_specs();
+  public:
+  const ::communicator_objects::ObservationProto& observation_specs(int index) const;
+  ::communicator_objects::ObservationProto* add_observation_specs();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::communicator_objects::ObservationProto >&
+      observation_specs() const;
   // string brain_name = 1;
   void clear_brain_name() ;
   const std::string& brain_name() const;
@@ -482,6 +504,7 @@ class BrainParametersProto final :
   struct Impl_ {
     ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::communicator_objects::ObservationProto > observation_specs_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr brain_name_;
     ::communicator_objects::ActionSpecProto* action_spec_;
     bool is_training_;
@@ -841,6 +864,51 @@ inline void BrainParametersProto::set_allocated_action_spec(::communicator_objec
   // @@protoc_insertion_point(field_set_allocated:communicator_objects.BrainParametersProto.action_spec)
 }
 
+// repeated .communicator_objects.ObservationProto observation_specs = 4;
+inline int BrainParametersProto::_internal_observation_specs_size() const {
+  return _impl_.observation_specs_.size();
+}
+inline int BrainParametersProto::observation_specs_size() const {
+  return _internal_observation_specs_size();
+}
+inline ::communicator_objects::ObservationProto* BrainParametersProto::mutable_observation_specs(int index) {
+  // @@protoc_insertion_point(field_mutable:communicator_objects.BrainParametersProto.observation_specs)
+  return _internal_mutable_observation_specs()->Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::communicator_objects::ObservationProto >*
+BrainParametersProto::mutable_observation_specs() {
+  // @@protoc_insertion_point(field_mutable_list:communicator_objects.BrainParametersProto.observation_specs)
+  return _internal_mutable_observation_specs();
+}
+inline const ::communicator_objects::ObservationProto& BrainParametersProto::_internal_observation_specs(int index) const {
+  return _internal_observation_specs().Get(index);
+}
+inline const ::communicator_objects::ObservationProto& BrainParametersProto::observation_specs(int index) const {
+  // @@protoc_insertion_point(field_get:communicator_objects.BrainParametersProto.observation_specs)
+  return _internal_observation_specs(index);
+}
+inline ::communicator_objects::ObservationProto* BrainParametersProto::_internal_add_observation_specs() {
+  return _internal_mutable_observation_specs()->Add();
+}
+inline ::communicator_objects::ObservationProto* BrainParametersProto::add_observation_specs() {
+  ::communicator_objects::ObservationProto* _add = _internal_add_observation_specs();
+  // @@protoc_insertion_point(field_add:communicator_objects.BrainParametersProto.observation_specs)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::communicator_objects::ObservationProto >&
+BrainParametersProto::observation_specs() const {
+  // @@protoc_insertion_point(field_list:communicator_objects.BrainParametersProto.observation_specs)
+  return _internal_observation_specs();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<::communicator_objects::ObservationProto>&
+BrainParametersProto::_internal_observation_specs() const {
+  return _impl_.observation_specs_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<::communicator_objects::ObservationProto>*
+BrainParametersProto::_internal_mutable_observation_specs() {
+  return &_impl_.observation_specs_;
+}
+
 #ifdef __GNUC__
 #pragma GCC diagnostic pop
 #endif  // __GNUC__
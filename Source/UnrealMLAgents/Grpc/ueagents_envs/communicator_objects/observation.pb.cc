@@ -48,10 +48,29 @@ PROTOBUF_CONSTEXPR ObservationProto::ObservationProto(
   , /*decltype(_impl_.dimension_properties_)*/ {}
   ,/* _impl_._dimension_properties_cached_byte_size_ = */ { 0 }
 
+  , /*decltype(_impl_.delta_indices_)*/ {}
+  ,/* _impl_._delta_indices_cached_byte_size_ = */ { 0 }
+
   , /*decltype(_impl_.name_)*/ {
     &::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized {}
   }
 
+  , /*decltype(_impl_.shared_rows_)*/ {
+    &::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized {}
+  }
+
+  , /*decltype(_impl_.compression_type_)*/ 0
+
+  , /*decltype(_impl_.encoding_)*/ 0
+
+  , /*decltype(_impl_.quantization_scale_)*/ 0
+
+  , /*decltype(_impl_.quantization_offset_)*/ 0
+
+  , /*decltype(_impl_.is_delta_)*/ false
+
+  , /*decltype(_impl_.shared_with_)*/ 0
+
   , /*decltype(_impl_.observation_data_)*/{}
   , /*decltype(_impl_._cached_size_)*/{}
   , /*decltype(_impl_._oneof_case_)*/{}} {}
@@ -67,7 +86,7 @@ PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
     PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ObservationProtoDefaultTypeInternal _ObservationProto_default_instance_;
 }  // namespace communicator_objects
 static ::_pb::Metadata file_level_metadata_ueagents_5fenvs_2fcommunicator_5fobjects_2fobservation_2eproto[2];
-static const ::_pb::EnumDescriptor* file_level_enum_descriptors_ueagents_5fenvs_2fcommunicator_5fobjects_2fobservation_2eproto[1];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_ueagents_5fenvs_2fcommunicator_5fobjects_2fobservation_2eproto[3];
 static constexpr const ::_pb::ServiceDescriptor**
     file_level_service_descriptors_ueagents_5fenvs_2fcommunicator_5fobjects_2fobservation_2eproto = nullptr;
 const ::uint32_t TableStruct_ueagents_5fenvs_2fcommunicator_5fobjects_2fobservation_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
@@ -91,8 +110,18 @@ const ::uint32_t TableStruct_ueagents_5fenvs_2fcommunicator_5fobjects_2fobservat
     ~0u,  // no sizeof(Split)
     PROTOBUF_FIELD_OFFSET(::communicator_objects::ObservationProto, _impl_.shape_),
     ::_pbi::kInvalidFieldOffsetTag,
+    ::_pbi::kInvalidFieldOffsetTag,
+    ::_pbi::kInvalidFieldOffsetTag,
     PROTOBUF_FIELD_OFFSET(::communicator_objects::ObservationProto, _impl_.dimension_properties_),
     PROTOBUF_FIELD_OFFSET(::communicator_objects::ObservationProto, _impl_.name_),
+    PROTOBUF_FIELD_OFFSET(::communicator_objects::ObservationProto, _impl_.compression_type_),
+    PROTOBUF_FIELD_OFFSET(::communicator_objects::ObservationProto, _impl_.encoding_),
+    PROTOBUF_FIELD_OFFSET(::communicator_objects::ObservationProto, _impl_.quantization_scale_),
+    PROTOBUF_FIELD_OFFSET(::communicator_objects::ObservationProto, _impl_.quantization_offset_),
+    PROTOBUF_FIELD_OFFSET(::communicator_objects::ObservationProto, _impl_.delta_indices_),
+    PROTOBUF_FIELD_OFFSET(::communicator_objects::ObservationProto, _impl_.is_delta_),
+    PROTOBUF_FIELD_OFFSET(::communicator_objects::ObservationProto, _impl_.shared_with_),
+    PROTOBUF_FIELD_OFFSET(::communicator_objects::ObservationProto, _impl_.shared_rows_),
     PROTOBUF_FIELD_OFFSET(::communicator_objects::ObservationProto, _impl_.observation_data_),
 };
 
@@ -108,20 +137,31 @@ static const ::_pb::Message* const file_default_instances[] = {
 };
 const char descriptor_table_protodef_ueagents_5fenvs_2fcommunicator_5fobjects_2fobservation_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
     "\n4ueagents_envs/communicator_objects/obs"
-    "ervation.proto\022\024communicator_objects\"\304\001\n"
+    "ervation.proto\022\024communicator_objects\"\215\004\n"
     "\020ObservationProto\022\r\n\005shape\030\001 \003(\005\022F\n\nfloa"
     "t_data\030\002 \001(\01320.communicator_objects.Obse"
-    "rvationProto.FloatDataH\000\022\034\n\024dimension_pr"
-    "operties\030\003 \003(\005\022\014\n\004name\030\004 \001(\t\032\031\n\tFloatDat"
-    "a\022\014\n\004data\030\001 \003(\002B\022\n\020observation_data*4\n\024O"
-    "bservationTypeProto\022\013\n\007DEFAULT\020\000\022\017\n\013GOAL"
-    "_SIGNAL\020\001b\006proto3"
+    "rvationProto.FloatDataH\000\022\031\n\017compressed_d"
+    "ata\030\005 \001(\014H\000\022\030\n\016quantized_data\030\007 \001(\014H\000\022\034\n"
+    "\024dimension_properties\030\003 \003(\005\022\014\n\004name\030\004 \001("
+    "\t\022D\n\020compression_type\030\006 \001(\0162*.communicat"
+    "or_objects.CompressionTypeProto\022@\n\010encod"
+    "ing\030\010 \001(\0162..communicator_objects.Observa"
+    "tionEncodingProto\022\032\n\022quantization_scale\030"
+    "\t \001(\002\022\033\n\023quantization_offset\030\n \001(\002\022\025\n\rde"
+    "lta_indices\030\013 \003(\005\022\020\n\010is_delta\030\014 \001(\010\022\023\n\013s"
+    "hared_with\030\r \001(\005\022\023\n\013shared_rows\030\016 \001(\014\032\031\n"
+    "\tFloatData\022\014\n\004data\030\001 \003(\002B\022\n\020observation_"
+    "data*4\n\024ObservationTypeProto\022\013\n\007DEFAULT\020"
+    "\000\022\017\n\013GOAL_SIGNAL\020\001**\n\024CompressionTypePro"
+    "to\022\010\n\004NONE\020\000\022\010\n\004ZLIB\020\001*\?\n\030ObservationEnc"
+    "odingProto\022\013\n\007FLOAT32\020\000\022\013\n\007FLOAT16\020\001\022\t\n\005"
+    "UINT8\020\002b\006proto3"
 };
 static ::absl::once_flag descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2fobservation_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2fobservation_2eproto = {
     false,
     false,
-    337,
+    775,
     descriptor_table_protodef_ueagents_5fenvs_2fcommunicator_5fobjects_2fobservation_2eproto,
     "ueagents_envs/communicator_objects/observation.proto",
     &descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2fobservation_2eproto_once,
@@ -167,6 +207,33 @@ bool ObservationTypeProto_IsValid(int value) {
       return false;
   }
 }
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* CompressionTypeProto_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2fobservation_2eproto);
+  return file_level_enum_descriptors_ueagents_5fenvs_2fcommunicator_5fobjects_2fobservation_2eproto[1];
+}
+bool CompressionTypeProto_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ObservationEncodingProto_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2fobservation_2eproto);
+  return file_level_enum_descriptors_ueagents_5fenvs_2fcommunicator_5fobjects_2fobservation_2eproto[2];
+}
+bool ObservationEncodingProto_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
 // ===================================================================
 
 class ObservationProto_FloatData::_Internal {
@@ -395,8 +462,25 @@ ObservationProto::ObservationProto(const ObservationProto& from)
     , decltype(_impl_.dimension_properties_) { from._impl_.dimension_properties_ }
     ,/* _impl_._dimension_properties_cached_byte_size_ = */ { 0 }
 
+    , decltype(_impl_.delta_indices_) { from._impl_.delta_indices_ }
+    ,/* _impl_._delta_indices_cached_byte_size_ = */ { 0 }
+
     , decltype(_impl_.name_) {}
 
+    , decltype(_impl_.shared_rows_) {}
+
+    , decltype(_impl_.compression_type_) {}
+
+    , decltype(_impl_.encoding_) {}
+
+    , decltype(_impl_.quantization_scale_) {}
+
+    , decltype(_impl_.quantization_offset_) {}
+
+    , decltype(_impl_.is_delta_) {}
+
+    , decltype(_impl_.shared_with_) {}
+
     , decltype(_impl_.observation_data_){}
     , /*decltype(_impl_._cached_size_)*/{}
     , /*decltype(_impl_._oneof_case_)*/{}};
@@ -409,6 +493,16 @@ ObservationProto::ObservationProto(const ObservationProto& from)
   if (!from._internal_name().empty()) {
     _this->_impl_.name_.Set(from._internal_name(), _this->GetArenaForAllocation());
   }
+  _impl_.shared_rows_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        _impl_.shared_rows_.Set("", GetArenaForAllocation());
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_shared_rows().empty()) {
+    _this->_impl_.shared_rows_.Set(from._internal_shared_rows(), _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.compression_type_, &from._impl_.compression_type_,
+    static_cast<::size_t>(reinterpret_cast<char*>(&_impl_.shared_with_) -
+    reinterpret_cast<char*>(&_impl_.compression_type_)) + sizeof(_impl_.shared_with_));
   clear_has_observation_data();
   switch (from.observation_data_case()) {
     case kFloatData: {
@@ -416,6 +510,14 @@ ObservationProto::ObservationProto(const ObservationProto& from)
           from._internal_float_data());
       break;
     }
+    case kCompressedData: {
+      _this->_internal_set_compressed_data(from._internal_compressed_data());
+      break;
+    }
+    case kQuantizedData: {
+      _this->_internal_set_quantized_data(from._internal_quantized_data());
+      break;
+    }
     case OBSERVATION_DATA_NOT_SET: {
       break;
     }
@@ -432,8 +534,25 @@ inline void ObservationProto::SharedCtor(::_pb::Arena* arena) {
     , decltype(_impl_.dimension_properties_) { arena }
     ,/* _impl_._dimension_properties_cached_byte_size_ = */ { 0 }
 
+    , decltype(_impl_.delta_indices_) { arena }
+    ,/* _impl_._delta_indices_cached_byte_size_ = */ { 0 }
+
     , decltype(_impl_.name_) {}
 
+    , decltype(_impl_.shared_rows_) {}
+
+    , decltype(_impl_.compression_type_) { 0 }
+
+    , decltype(_impl_.encoding_) { 0 }
+
+    , decltype(_impl_.quantization_scale_) { 0 }
+
+    , decltype(_impl_.quantization_offset_) { 0 }
+
+    , decltype(_impl_.is_delta_) { false }
+
+    , decltype(_impl_.shared_with_) { 0 }
+
     , decltype(_impl_.observation_data_){}
     , /*decltype(_impl_._cached_size_)*/{}
     , /*decltype(_impl_._oneof_case_)*/{}
@@ -442,6 +561,10 @@ inline void ObservationProto::SharedCtor(::_pb::Arena* arena) {
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
         _impl_.name_.Set("", GetArenaForAllocation());
   #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.shared_rows_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        _impl_.shared_rows_.Set("", GetArenaForAllocation());
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   clear_has_observation_data();
 }
 
@@ -458,7 +581,9 @@ inline void ObservationProto::SharedDtor() {
   ABSL_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.shape_.~RepeatedField();
   _impl_.dimension_properties_.~RepeatedField();
+  _impl_.delta_indices_.~RepeatedField();
   _impl_.name_.Destroy();
+  _impl_.shared_rows_.Destroy();
   if (has_observation_data()) {
     clear_observation_data();
   }
@@ -477,6 +602,14 @@ void ObservationProto::clear_observation_data() {
       }
       break;
     }
+    case kCompressedData: {
+      _impl_.observation_data_.compressed_data_.Destroy();
+      break;
+    }
+    case kQuantizedData: {
+      _impl_.observation_data_.quantized_data_.Destroy();
+      break;
+    }
     case OBSERVATION_DATA_NOT_SET: {
       break;
     }
@@ -493,7 +626,12 @@ void ObservationProto::Clear() {
 
   _internal_mutable_shape()->Clear();
   _internal_mutable_dimension_properties()->Clear();
+  _internal_mutable_delta_indices()->Clear();
   _impl_.name_.ClearToEmpty();
+  _impl_.shared_rows_.ClearToEmpty();
+  ::memset(&_impl_.compression_type_, 0, static_cast<::size_t>(
+      reinterpret_cast<char*>(&_impl_.shared_with_) -
+      reinterpret_cast<char*>(&_impl_.compression_type_)) + sizeof(_impl_.shared_with_));
   clear_observation_data();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
@@ -548,6 +686,105 @@ const char* ObservationProto::_InternalParse(const char* ptr, ::_pbi::ParseConte
           goto handle_unusual;
         }
         continue;
+      // bytes compressed_data = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_compressed_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else {
+          goto handle_unusual;
+        }
+        continue;
+      // .communicator_objects.CompressionTypeProto compression_type = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 48)) {
+          ::int32_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+          _internal_set_compression_type(static_cast<::communicator_objects::CompressionTypeProto>(val));
+        } else {
+          goto handle_unusual;
+        }
+        continue;
+      // bytes quantized_data = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_quantized_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else {
+          goto handle_unusual;
+        }
+        continue;
+      // .communicator_objects.ObservationEncodingProto encoding = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 64)) {
+          ::int32_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+          _internal_set_encoding(static_cast<::communicator_objects::ObservationEncodingProto>(val));
+        } else {
+          goto handle_unusual;
+        }
+        continue;
+      // float quantization_scale = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 77)) {
+          _impl_.quantization_scale_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else {
+          goto handle_unusual;
+        }
+        continue;
+      // float quantization_offset = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 85)) {
+          _impl_.quantization_offset_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else {
+          goto handle_unusual;
+        }
+        continue;
+      // repeated int32 delta_indices = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 90)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_delta_indices(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::uint8_t>(tag) == 88) {
+          _internal_add_delta_indices(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else {
+          goto handle_unusual;
+        }
+        continue;
+      // bool is_delta = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 96)) {
+          #pragma warning(disable: 4800)
+          _impl_.is_delta_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else {
+          goto handle_unusual;
+        }
+        continue;
+      // int32 shared_with = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 104)) {
+          _impl_.shared_with_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else {
+          goto handle_unusual;
+        }
+        continue;
+      // bytes shared_rows = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 114)) {
+          auto str = _internal_mutable_shared_rows();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else {
+          goto handle_unusual;
+        }
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -610,6 +847,83 @@ failure:
     target = stream->WriteStringMaybeAliased(4, _s, target);
   }
 
+  // bytes compressed_data = 5;
+  if (observation_data_case() == kCompressedData) {
+    const std::string& _s = this->_internal_compressed_data();
+    target = stream->WriteBytesMaybeAliased(5, _s, target);
+  }
+
+  // .communicator_objects.CompressionTypeProto compression_type = 6;
+  if (this->_internal_compression_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+        6, this->_internal_compression_type(), target);
+  }
+
+  // bytes quantized_data = 7;
+  if (observation_data_case() == kQuantizedData) {
+    const std::string& _s = this->_internal_quantized_data();
+    target = stream->WriteBytesMaybeAliased(7, _s, target);
+  }
+
+  // .communicator_objects.ObservationEncodingProto encoding = 8;
+  if (this->_internal_encoding() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+        8, this->_internal_encoding(), target);
+  }
+
+  // float quantization_scale = 9;
+  static_assert(sizeof(::uint32_t) == sizeof(float), "Code assumes ::uint32_t and float are the same size.");
+  float tmp_quantization_scale = this->_internal_quantization_scale();
+  ::uint32_t raw_quantization_scale;
+  memcpy(&raw_quantization_scale, &tmp_quantization_scale, sizeof(tmp_quantization_scale));
+  if (raw_quantization_scale != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(
+        9, this->_internal_quantization_scale(), target);
+  }
+
+  // float quantization_offset = 10;
+  static_assert(sizeof(::uint32_t) == sizeof(float), "Code assumes ::uint32_t and float are the same size.");
+  float tmp_quantization_offset = this->_internal_quantization_offset();
+  ::uint32_t raw_quantization_offset;
+  memcpy(&raw_quantization_offset, &tmp_quantization_offset, sizeof(tmp_quantization_offset));
+  if (raw_quantization_offset != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(
+        10, this->_internal_quantization_offset(), target);
+  }
+
+  // repeated int32 delta_indices = 11;
+  {
+    int byte_size = _impl_._delta_indices_cached_byte_size_.Get();
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(11, _internal_delta_indices(),
+                                                 byte_size, target);
+    }
+  }
+
+  // bool is_delta = 12;
+  if (this->_internal_is_delta() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(
+        12, this->_internal_is_delta(), target);
+  }
+
+  // int32 shared_with = 13;
+  if (this->_internal_shared_with() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(
+        13, this->_internal_shared_with(), target);
+  }
+
+  // bytes shared_rows = 14;
+  if (!this->_internal_shared_rows().empty()) {
+    const std::string& _s = this->_internal_shared_rows();
+    target = stream->WriteBytesMaybeAliased(14, _s, target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -654,12 +968,67 @@ failure:
     total_size += tag_size + data_size;
   }
 
+  // repeated int32 delta_indices = 11;
+  {
+    std::size_t data_size = ::_pbi::WireFormatLite::Int32Size(
+        this->_internal_delta_indices())
+    ;
+    _impl_._delta_indices_cached_byte_size_.Set(::_pbi::ToCachedSize(data_size));
+    std::size_t tag_size = data_size == 0
+        ? 0
+        : 1 + ::_pbi::WireFormatLite::Int32Size(
+                            static_cast<int32_t>(data_size))
+    ;
+    total_size += tag_size + data_size;
+  }
+
   // string name = 4;
   if (!this->_internal_name().empty()) {
     total_size += 1 + ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
                                     this->_internal_name());
   }
 
+  // bytes shared_rows = 14;
+  if (!this->_internal_shared_rows().empty()) {
+    total_size += 1 + ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+                                    this->_internal_shared_rows());
+  }
+
+  // .communicator_objects.CompressionTypeProto compression_type = 6;
+  if (this->_internal_compression_type() != 0) {
+    total_size += 1 +
+                  ::_pbi::WireFormatLite::EnumSize(this->_internal_compression_type());
+  }
+
+  // .communicator_objects.ObservationEncodingProto encoding = 8;
+  if (this->_internal_encoding() != 0) {
+    total_size += 1 +
+                  ::_pbi::WireFormatLite::EnumSize(this->_internal_encoding());
+  }
+
+  // float quantization_scale = 9;
+  static_assert(sizeof(::uint32_t) == sizeof(float), "Code assumes ::uint32_t and float are the same size.");
+  float tmp_quantization_scale = this->_internal_quantization_scale();
+  ::uint32_t raw_quantization_scale;
+  memcpy(&raw_quantization_scale, &tmp_quantization_scale, sizeof(tmp_quantization_scale));
+  if (raw_quantization_scale != 0) {
+    total_size += 5;
+  }
+
+  // float quantization_offset = 10;
+  static_assert(sizeof(::uint32_t) == sizeof(float), "Code assumes ::uint32_t and float are the same size.");
+  float tmp_quantization_offset = this->_internal_quantization_offset();
+  ::uint32_t raw_quantization_offset;
+  memcpy(&raw_quantization_offset, &tmp_quantization_offset, sizeof(tmp_quantization_offset));
+  if (raw_quantization_offset != 0) {
+    total_size += 5;
+  }
+
+  // bool is_delta = 12;
+  if (this->_internal_is_delta() != 0) {
+    total_size += 2;
+  }
+
   switch (observation_data_case()) {
     // .communicator_objects.ObservationProto.FloatData float_data = 2;
     case kFloatData: {
@@ -668,10 +1037,28 @@ failure:
           *_impl_.observation_data_.float_data_);
       break;
     }
+    // bytes compressed_data = 5;
+    case kCompressedData: {
+      total_size += 1 + ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+                                      this->_internal_compressed_data());
+      break;
+    }
+    // bytes quantized_data = 7;
+    case kQuantizedData: {
+      total_size += 1 + ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+                                      this->_internal_quantized_data());
+      break;
+    }
     case OBSERVATION_DATA_NOT_SET: {
       break;
     }
   }
+  // int32 shared_with = 13;
+  if (this->_internal_shared_with() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+        this->_internal_shared_with());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -692,19 +1079,57 @@ void ObservationProto::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const
 
   _this->_impl_.shape_.MergeFrom(from._impl_.shape_);
   _this->_impl_.dimension_properties_.MergeFrom(from._impl_.dimension_properties_);
+  _this->_impl_.delta_indices_.MergeFrom(from._impl_.delta_indices_);
   if (!from._internal_name().empty()) {
     _this->_internal_set_name(from._internal_name());
   }
+  if (!from._internal_shared_rows().empty()) {
+    _this->_internal_set_shared_rows(from._internal_shared_rows());
+  }
+  if (from._internal_compression_type() != 0) {
+    _this->_internal_set_compression_type(from._internal_compression_type());
+  }
+  if (from._internal_encoding() != 0) {
+    _this->_internal_set_encoding(from._internal_encoding());
+  }
+  static_assert(sizeof(::uint32_t) == sizeof(float), "Code assumes ::uint32_t and float are the same size.");
+  float tmp_quantization_scale = from._internal_quantization_scale();
+  ::uint32_t raw_quantization_scale;
+  memcpy(&raw_quantization_scale, &tmp_quantization_scale, sizeof(tmp_quantization_scale));
+  if (raw_quantization_scale != 0) {
+    _this->_internal_set_quantization_scale(from._internal_quantization_scale());
+  }
+  static_assert(sizeof(::uint32_t) == sizeof(float), "Code assumes ::uint32_t and float are the same size.");
+  float tmp_quantization_offset = from._internal_quantization_offset();
+  ::uint32_t raw_quantization_offset;
+  memcpy(&raw_quantization_offset, &tmp_quantization_offset, sizeof(tmp_quantization_offset));
+  if (raw_quantization_offset != 0) {
+    _this->_internal_set_quantization_offset(from._internal_quantization_offset());
+  }
+  if (from._internal_is_delta() != 0) {
+    _this->_internal_set_is_delta(from._internal_is_delta());
+  }
   switch (from.observation_data_case()) {
     case kFloatData: {
       _this->_internal_mutable_float_data()->::communicator_objects::ObservationProto_FloatData::MergeFrom(
           from._internal_float_data());
       break;
     }
+    case kCompressedData: {
+      _this->_internal_set_compressed_data(from._internal_compressed_data());
+      break;
+    }
+    case kQuantizedData: {
+      _this->_internal_set_quantized_data(from._internal_quantized_data());
+      break;
+    }
     case OBSERVATION_DATA_NOT_SET: {
       break;
     }
   }
+  if (from._internal_shared_with() != 0) {
+    _this->_internal_set_shared_with(from._internal_shared_with());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -726,8 +1151,17 @@ void ObservationProto::InternalSwap(ObservationProto* other) {
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   _impl_.shape_.InternalSwap(&other->_impl_.shape_);
   _impl_.dimension_properties_.InternalSwap(&other->_impl_.dimension_properties_);
+  _impl_.delta_indices_.InternalSwap(&other->_impl_.delta_indices_);
   ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.name_, lhs_arena,
                                        &other->_impl_.name_, rhs_arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.shared_rows_, lhs_arena,
+                                       &other->_impl_.shared_rows_, rhs_arena);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ObservationProto, _impl_.shared_with_)
+      + sizeof(ObservationProto::_impl_.shared_with_)
+      - PROTOBUF_FIELD_OFFSET(ObservationProto, _impl_.compression_type_)>(
+          reinterpret_cast<char*>(&_impl_.compression_type_),
+          reinterpret_cast<char*>(&other->_impl_.compression_type_));
   swap(_impl_.observation_data_, other->_impl_.observation_data_);
   swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
 }
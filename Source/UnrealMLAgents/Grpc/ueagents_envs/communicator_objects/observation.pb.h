@@ -101,6 +101,71 @@ inline bool ObservationTypeProto_Parse(absl::string_view name, ObservationTypePr
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ObservationTypeProto>(
       ObservationTypeProto_descriptor(), name, value);
 }
+enum CompressionTypeProto : int {
+  NONE = 0,
+  ZLIB = 1,
+  CompressionTypeProto_INT_MIN_SENTINEL_DO_NOT_USE_ =
+      std::numeric_limits<::int32_t>::min(),
+  CompressionTypeProto_INT_MAX_SENTINEL_DO_NOT_USE_ =
+      std::numeric_limits<::int32_t>::max(),
+};
+
+bool CompressionTypeProto_IsValid(int value);
+constexpr CompressionTypeProto CompressionTypeProto_MIN = static_cast<CompressionTypeProto>(0);
+constexpr CompressionTypeProto CompressionTypeProto_MAX = static_cast<CompressionTypeProto>(1);
+constexpr int CompressionTypeProto_ARRAYSIZE = 1 + 1;
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+CompressionTypeProto_descriptor();
+template <typename T>
+const std::string& CompressionTypeProto_Name(T value) {
+  static_assert(std::is_same<T, CompressionTypeProto>::value ||
+                    std::is_integral<T>::value,
+                "Incorrect type passed to CompressionTypeProto_Name().");
+  return CompressionTypeProto_Name(static_cast<CompressionTypeProto>(value));
+}
+template <>
+inline const std::string& CompressionTypeProto_Name(CompressionTypeProto value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfDenseEnum<CompressionTypeProto_descriptor,
+                                                 0, 1>(
+      static_cast<int>(value));
+}
+inline bool CompressionTypeProto_Parse(absl::string_view name, CompressionTypeProto* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<CompressionTypeProto>(
+      CompressionTypeProto_descriptor(), name, value);
+}
+enum ObservationEncodingProto : int {
+  FLOAT32 = 0,
+  FLOAT16 = 1,
+  UINT8 = 2,
+  ObservationEncodingProto_INT_MIN_SENTINEL_DO_NOT_USE_ =
+      std::numeric_limits<::int32_t>::min(),
+  ObservationEncodingProto_INT_MAX_SENTINEL_DO_NOT_USE_ =
+      std::numeric_limits<::int32_t>::max(),
+};
+
+bool ObservationEncodingProto_IsValid(int value);
+constexpr ObservationEncodingProto ObservationEncodingProto_MIN = static_cast<ObservationEncodingProto>(0);
+constexpr ObservationEncodingProto ObservationEncodingProto_MAX = static_cast<ObservationEncodingProto>(2);
+constexpr int ObservationEncodingProto_ARRAYSIZE = 2 + 1;
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+ObservationEncodingProto_descriptor();
+template <typename T>
+const std::string& ObservationEncodingProto_Name(T value) {
+  static_assert(std::is_same<T, ObservationEncodingProto>::value ||
+                    std::is_integral<T>::value,
+                "Incorrect type passed to ObservationEncodingProto_Name().");
+  return ObservationEncodingProto_Name(static_cast<ObservationEncodingProto>(value));
+}
+template <>
+inline const std::string& ObservationEncodingProto_Name(ObservationEncodingProto value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfDenseEnum<ObservationEncodingProto_descriptor,
+                                                 0, 2>(
+      static_cast<int>(value));
+}
+inline bool ObservationEncodingProto_Parse(absl::string_view name, ObservationEncodingProto* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ObservationEncodingProto>(
+      ObservationEncodingProto_descriptor(), name, value);
+}
 
 // ===================================================================
 
@@ -325,6 +390,8 @@ class ObservationProto final :
   }
   enum ObservationDataCase {
     kFloatData = 2,
+    kCompressedData = 5,
+    kQuantizedData = 7,
     OBSERVATION_DATA_NOT_SET = 0,
   };
 
@@ -409,8 +476,18 @@ class ObservationProto final :
   enum : int {
     kShapeFieldNumber = 1,
     kDimensionPropertiesFieldNumber = 3,
+    kDeltaIndicesFieldNumber = 11,
     kNameFieldNumber = 4,
+    kSharedRowsFieldNumber = 14,
+    kCompressionTypeFieldNumber = 6,
+    kEncodingFieldNumber = 8,
+    kQuantizationScaleFieldNumber = 9,
+    kQuantizationOffsetFieldNumber = 10,
+    kIsDeltaFieldNumber = 12,
+    kSharedWithFieldNumber = 13,
     kFloatDataFieldNumber = 2,
+    kCompressedDataFieldNumber = 5,
+    kQuantizedDataFieldNumber = 7,
   };
   // repeated int32 shape = 1;
   int shape_size() const;
@@ -451,6 +528,26 @@ class ObservationProto final :
   const ::PROTOBUF_NAMESPACE_ID::RepeatedField<::int32_t>& _internal_dimension_properties() const;
   ::PROTOBUF_NAMESPACE_ID::RepeatedField<::int32_t>* _internal_mutable_dimension_properties();
 
+  public:
+  // repeated int32 delta_indices = 11;
+  int delta_indices_size() const;
+  private:
+  int _internal_delta_indices_size() const;
+
+  public:
+  void clear_delta_indices() ;
+  ::int32_t delta_indices(int index) const;
+  void set_delta_indices(int index, ::int32_t value);
+  void add_delta_indices(::int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField<::int32_t>& delta_indices() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<::int32_t>* mutable_delta_indices();
+
+  private:
+  ::int32_t _internal_delta_indices(int index) const;
+  void _internal_add_delta_indices(::int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField<::int32_t>& _internal_delta_indices() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<::int32_t>* _internal_mutable_delta_indices();
+
   public:
   // string name = 4;
   void clear_name() ;
@@ -471,6 +568,86 @@ class ObservationProto final :
       const std::string& value);
   std::string* _internal_mutable_name();
 
+  public:
+  // bytes shared_rows = 14;
+  void clear_shared_rows() ;
+  const std::string& shared_rows() const;
+
+
+
+
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_shared_rows(Arg_&& arg, Args_... args);
+  std::string* mutable_shared_rows();
+  PROTOBUF_NODISCARD std::string* release_shared_rows();
+  void set_allocated_shared_rows(std::string* ptr);
+
+  private:
+  const std::string& _internal_shared_rows() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_shared_rows(
+      const std::string& value);
+  std::string* _internal_mutable_shared_rows();
+
+  public:
+  // .communicator_objects.CompressionTypeProto compression_type = 6;
+  void clear_compression_type() ;
+  ::communicator_objects::CompressionTypeProto compression_type() const;
+  void set_compression_type(::communicator_objects::CompressionTypeProto value);
+
+  private:
+  ::communicator_objects::CompressionTypeProto _internal_compression_type() const;
+  void _internal_set_compression_type(::communicator_objects::CompressionTypeProto value);
+
+  public:
+  // .communicator_objects.ObservationEncodingProto encoding = 8;
+  void clear_encoding() ;
+  ::communicator_objects::ObservationEncodingProto encoding() const;
+  void set_encoding(::communicator_objects::ObservationEncodingProto value);
+
+  private:
+  ::communicator_objects::ObservationEncodingProto _internal_encoding() const;
+  void _internal_set_encoding(::communicator_objects::ObservationEncodingProto value);
+
+  public:
+  // float quantization_scale = 9;
+  void clear_quantization_scale() ;
+  float quantization_scale() const;
+  void set_quantization_scale(float value);
+
+  private:
+  float _internal_quantization_scale() const;
+  void _internal_set_quantization_scale(float value);
+
+  public:
+  // float quantization_offset = 10;
+  void clear_quantization_offset() ;
+  float quantization_offset() const;
+  void set_quantization_offset(float value);
+
+  private:
+  float _internal_quantization_offset() const;
+  void _internal_set_quantization_offset(float value);
+
+  public:
+  // bool is_delta = 12;
+  void clear_is_delta() ;
+  bool is_delta() const;
+  void set_is_delta(bool value);
+
+  private:
+  bool _internal_is_delta() const;
+  void _internal_set_is_delta(bool value);
+
+  public:
+  // int32 shared_with = 13;
+  void clear_shared_with() ;
+  ::int32_t shared_with() const;
+  void set_shared_with(::int32_t value);
+
+  private:
+  ::int32_t _internal_shared_with() const;
+  void _internal_set_shared_with(::int32_t value);
+
   public:
   // .communicator_objects.ObservationProto.FloatData float_data = 2;
   bool has_float_data() const;
@@ -490,12 +667,55 @@ class ObservationProto final :
   void unsafe_arena_set_allocated_float_data(
       ::communicator_objects::ObservationProto_FloatData* float_data);
   ::communicator_objects::ObservationProto_FloatData* unsafe_arena_release_float_data();
+  // bytes compressed_data = 5;
+  bool has_compressed_data() const;
+  void clear_compressed_data() ;
+  const std::string& compressed_data() const;
+
+
+
+
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_compressed_data(Arg_&& arg, Args_... args);
+  std::string* mutable_compressed_data();
+  PROTOBUF_NODISCARD std::string* release_compressed_data();
+  void set_allocated_compressed_data(std::string* ptr);
+
+  private:
+  const std::string& _internal_compressed_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_compressed_data(
+      const std::string& value);
+  std::string* _internal_mutable_compressed_data();
+
+  // bytes quantized_data = 7;
+  bool has_quantized_data() const;
+  void clear_quantized_data() ;
+  const std::string& quantized_data() const;
+
+
+
+
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_quantized_data(Arg_&& arg, Args_... args);
+  std::string* mutable_quantized_data();
+  PROTOBUF_NODISCARD std::string* release_quantized_data();
+  void set_allocated_quantized_data(std::string* ptr);
+
+  private:
+  const std::string& _internal_quantized_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_quantized_data(
+      const std::string& value);
+  std::string* _internal_mutable_quantized_data();
+
+  public:
   void clear_observation_data();
   ObservationDataCase observation_data_case() const;
   // @@protoc_insertion_point(class_scope:communicator_objects.ObservationProto)
  private:
   class _Internal;
   void set_has_float_data();
+  void set_has_compressed_data();
+  void set_has_quantized_data();
 
   inline bool has_observation_data() const;
   inline void clear_has_observation_data();
@@ -508,11 +728,22 @@ class ObservationProto final :
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _shape_cached_byte_size_;
     ::PROTOBUF_NAMESPACE_ID::RepeatedField<::int32_t> dimension_properties_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _dimension_properties_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField<::int32_t> delta_indices_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _delta_indices_cached_byte_size_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr shared_rows_;
+    int compression_type_;
+    int encoding_;
+    float quantization_scale_;
+    float quantization_offset_;
+    bool is_delta_;
+    ::int32_t shared_with_;
     union ObservationDataUnion {
       constexpr ObservationDataUnion() : _constinit_{} {}
         ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
       ::communicator_objects::ObservationProto_FloatData* float_data_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr compressed_data_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr quantized_data_;
     } observation_data_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
     ::uint32_t _oneof_case_[1];
@@ -704,6 +935,164 @@ inline ::communicator_objects::ObservationProto_FloatData* ObservationProto::mut
   return _msg;
 }
 
+// bytes compressed_data = 5;
+inline bool ObservationProto::has_compressed_data() const {
+  return observation_data_case() == kCompressedData;
+}
+inline void ObservationProto::set_has_compressed_data() {
+  _impl_._oneof_case_[0] = kCompressedData;
+}
+inline void ObservationProto::clear_compressed_data() {
+  if (observation_data_case() == kCompressedData) {
+    _impl_.observation_data_.compressed_data_.Destroy();
+    clear_has_observation_data();
+  }
+}
+inline const std::string& ObservationProto::compressed_data() const {
+  // @@protoc_insertion_point(field_get:communicator_objects.ObservationProto.compressed_data)
+  return _internal_compressed_data();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void ObservationProto::set_compressed_data(Arg_&& arg,
+                                                     Args_... args) {
+  if (observation_data_case() != kCompressedData) {
+    clear_observation_data();
+
+    set_has_compressed_data();
+    _impl_.observation_data_.compressed_data_.InitDefault();
+  }
+  _impl_.observation_data_.compressed_data_.SetBytes(static_cast<Arg_&&>(arg), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:communicator_objects.ObservationProto.compressed_data)
+}
+inline std::string* ObservationProto::mutable_compressed_data() {
+  std::string* _s = _internal_mutable_compressed_data();
+  // @@protoc_insertion_point(field_mutable:communicator_objects.ObservationProto.compressed_data)
+  return _s;
+}
+inline const std::string& ObservationProto::_internal_compressed_data() const {
+  if (observation_data_case() != kCompressedData) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
+  }
+  return _impl_.observation_data_.compressed_data_.Get();
+}
+inline void ObservationProto::_internal_set_compressed_data(const std::string& value) {
+  if (observation_data_case() != kCompressedData) {
+    clear_observation_data();
+
+    set_has_compressed_data();
+    _impl_.observation_data_.compressed_data_.InitDefault();
+  }
+
+
+  _impl_.observation_data_.compressed_data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ObservationProto::_internal_mutable_compressed_data() {
+  if (observation_data_case() != kCompressedData) {
+    clear_observation_data();
+
+    set_has_compressed_data();
+    _impl_.observation_data_.compressed_data_.InitDefault();
+  }
+  return _impl_.observation_data_.compressed_data_.Mutable( GetArenaForAllocation());
+}
+inline std::string* ObservationProto::release_compressed_data() {
+  // @@protoc_insertion_point(field_release:communicator_objects.ObservationProto.compressed_data)
+  if (observation_data_case() != kCompressedData) {
+    return nullptr;
+  }
+  clear_has_observation_data();
+  return _impl_.observation_data_.compressed_data_.Release();
+}
+inline void ObservationProto::set_allocated_compressed_data(std::string* value) {
+  if (has_observation_data()) {
+    clear_observation_data();
+  }
+  if (value != nullptr) {
+    set_has_compressed_data();
+    _impl_.observation_data_.compressed_data_.InitAllocated(value, GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(field_set_allocated:communicator_objects.ObservationProto.compressed_data)
+}
+
+// bytes quantized_data = 7;
+inline bool ObservationProto::has_quantized_data() const {
+  return observation_data_case() == kQuantizedData;
+}
+inline void ObservationProto::set_has_quantized_data() {
+  _impl_._oneof_case_[0] = kQuantizedData;
+}
+inline void ObservationProto::clear_quantized_data() {
+  if (observation_data_case() == kQuantizedData) {
+    _impl_.observation_data_.quantized_data_.Destroy();
+    clear_has_observation_data();
+  }
+}
+inline const std::string& ObservationProto::quantized_data() const {
+  // @@protoc_insertion_point(field_get:communicator_objects.ObservationProto.quantized_data)
+  return _internal_quantized_data();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void ObservationProto::set_quantized_data(Arg_&& arg,
+                                                     Args_... args) {
+  if (observation_data_case() != kQuantizedData) {
+    clear_observation_data();
+
+    set_has_quantized_data();
+    _impl_.observation_data_.quantized_data_.InitDefault();
+  }
+  _impl_.observation_data_.quantized_data_.SetBytes(static_cast<Arg_&&>(arg), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:communicator_objects.ObservationProto.quantized_data)
+}
+inline std::string* ObservationProto::mutable_quantized_data() {
+  std::string* _s = _internal_mutable_quantized_data();
+  // @@protoc_insertion_point(field_mutable:communicator_objects.ObservationProto.quantized_data)
+  return _s;
+}
+inline const std::string& ObservationProto::_internal_quantized_data() const {
+  if (observation_data_case() != kQuantizedData) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
+  }
+  return _impl_.observation_data_.quantized_data_.Get();
+}
+inline void ObservationProto::_internal_set_quantized_data(const std::string& value) {
+  if (observation_data_case() != kQuantizedData) {
+    clear_observation_data();
+
+    set_has_quantized_data();
+    _impl_.observation_data_.quantized_data_.InitDefault();
+  }
+
+
+  _impl_.observation_data_.quantized_data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ObservationProto::_internal_mutable_quantized_data() {
+  if (observation_data_case() != kQuantizedData) {
+    clear_observation_data();
+
+    set_has_quantized_data();
+    _impl_.observation_data_.quantized_data_.InitDefault();
+  }
+  return _impl_.observation_data_.quantized_data_.Mutable( GetArenaForAllocation());
+}
+inline std::string* ObservationProto::release_quantized_data() {
+  // @@protoc_insertion_point(field_release:communicator_objects.ObservationProto.quantized_data)
+  if (observation_data_case() != kQuantizedData) {
+    return nullptr;
+  }
+  clear_has_observation_data();
+  return _impl_.observation_data_.quantized_data_.Release();
+}
+inline void ObservationProto::set_allocated_quantized_data(std::string* value) {
+  if (has_observation_data()) {
+    clear_observation_data();
+  }
+  if (value != nullptr) {
+    set_has_quantized_data();
+    _impl_.observation_data_.quantized_data_.InitAllocated(value, GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(field_set_allocated:communicator_objects.ObservationProto.quantized_data)
+}
+
 // repeated int32 dimension_properties = 3;
 inline int ObservationProto::_internal_dimension_properties_size() const {
   return _impl_.dimension_properties_.size();
@@ -748,6 +1137,50 @@ inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<::int32_t>* ObservationProto::_int
   return &_impl_.dimension_properties_;
 }
 
+// repeated int32 delta_indices = 11;
+inline int ObservationProto::_internal_delta_indices_size() const {
+  return _impl_.delta_indices_.size();
+}
+inline int ObservationProto::delta_indices_size() const {
+  return _internal_delta_indices_size();
+}
+inline void ObservationProto::clear_delta_indices() {
+  _internal_mutable_delta_indices()->Clear();
+}
+inline ::int32_t ObservationProto::delta_indices(int index) const {
+  // @@protoc_insertion_point(field_get:communicator_objects.ObservationProto.delta_indices)
+  return _internal_delta_indices(index);
+}
+inline void ObservationProto::set_delta_indices(int index, ::int32_t value) {
+  _internal_mutable_delta_indices()->Set(index, value);
+  // @@protoc_insertion_point(field_set:communicator_objects.ObservationProto.delta_indices)
+}
+inline void ObservationProto::add_delta_indices(::int32_t value) {
+  _internal_add_delta_indices(value);
+  // @@protoc_insertion_point(field_add:communicator_objects.ObservationProto.delta_indices)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField<::int32_t>& ObservationProto::delta_indices() const {
+  // @@protoc_insertion_point(field_list:communicator_objects.ObservationProto.delta_indices)
+  return _internal_delta_indices();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<::int32_t>* ObservationProto::mutable_delta_indices() {
+  // @@protoc_insertion_point(field_mutable_list:communicator_objects.ObservationProto.delta_indices)
+  return _internal_mutable_delta_indices();
+}
+
+inline ::int32_t ObservationProto::_internal_delta_indices(int index) const {
+  return _internal_delta_indices().Get(index);
+}
+inline void ObservationProto::_internal_add_delta_indices(::int32_t value) {
+  _internal_mutable_delta_indices()->Add(value);
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField<::int32_t>& ObservationProto::_internal_delta_indices() const {
+  return _impl_.delta_indices_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<::int32_t>* ObservationProto::_internal_mutable_delta_indices() {
+  return &_impl_.delta_indices_;
+}
+
 // string name = 4;
 inline void ObservationProto::clear_name() {
   _impl_.name_.ClearToEmpty();
@@ -795,6 +1228,126 @@ inline void ObservationProto::set_allocated_name(std::string* value) {
   // @@protoc_insertion_point(field_set_allocated:communicator_objects.ObservationProto.name)
 }
 
+// .communicator_objects.CompressionTypeProto compression_type = 6;
+inline void ObservationProto::clear_compression_type() {
+  _impl_.compression_type_ = 0;
+}
+inline ::communicator_objects::CompressionTypeProto ObservationProto::compression_type() const {
+  // @@protoc_insertion_point(field_get:communicator_objects.ObservationProto.compression_type)
+  return _internal_compression_type();
+}
+inline void ObservationProto::set_compression_type(::communicator_objects::CompressionTypeProto value) {
+   _internal_set_compression_type(value);
+  // @@protoc_insertion_point(field_set:communicator_objects.ObservationProto.compression_type)
+}
+inline ::communicator_objects::CompressionTypeProto ObservationProto::_internal_compression_type() const {
+  return static_cast<::communicator_objects::CompressionTypeProto>(_impl_.compression_type_);
+}
+inline void ObservationProto::_internal_set_compression_type(::communicator_objects::CompressionTypeProto value) {
+  ;
+  _impl_.compression_type_ = value;
+}
+
+// .communicator_objects.ObservationEncodingProto encoding = 8;
+inline void ObservationProto::clear_encoding() {
+  _impl_.encoding_ = 0;
+}
+inline ::communicator_objects::ObservationEncodingProto ObservationProto::encoding() const {
+  // @@protoc_insertion_point(field_get:communicator_objects.ObservationProto.encoding)
+  return _internal_encoding();
+}
+inline void ObservationProto::set_encoding(::communicator_objects::ObservationEncodingProto value) {
+   _internal_set_encoding(value);
+  // @@protoc_insertion_point(field_set:communicator_objects.ObservationProto.encoding)
+}
+inline ::communicator_objects::ObservationEncodingProto ObservationProto::_internal_encoding() const {
+  return static_cast<::communicator_objects::ObservationEncodingProto>(_impl_.encoding_);
+}
+inline void ObservationProto::_internal_set_encoding(::communicator_objects::ObservationEncodingProto value) {
+  ;
+  _impl_.encoding_ = value;
+}
+
+// float quantization_scale = 9;
+inline void ObservationProto::clear_quantization_scale() {
+  _impl_.quantization_scale_ = 0;
+}
+inline float ObservationProto::quantization_scale() const {
+  // @@protoc_insertion_point(field_get:communicator_objects.ObservationProto.quantization_scale)
+  return _internal_quantization_scale();
+}
+inline void ObservationProto::set_quantization_scale(float value) {
+  _internal_set_quantization_scale(value);
+  // @@protoc_insertion_point(field_set:communicator_objects.ObservationProto.quantization_scale)
+}
+inline float ObservationProto::_internal_quantization_scale() const {
+  return _impl_.quantization_scale_;
+}
+inline void ObservationProto::_internal_set_quantization_scale(float value) {
+  ;
+  _impl_.quantization_scale_ = value;
+}
+
+// float quantization_offset = 10;
+inline void ObservationProto::clear_quantization_offset() {
+  _impl_.quantization_offset_ = 0;
+}
+inline float ObservationProto::quantization_offset() const {
+  // @@protoc_insertion_point(field_get:communicator_objects.ObservationProto.quantization_offset)
+  return _internal_quantization_offset();
+}
+inline void ObservationProto::set_quantization_offset(float value) {
+  _internal_set_quantization_offset(value);
+  // @@protoc_insertion_point(field_set:communicator_objects.ObservationProto.quantization_offset)
+}
+inline float ObservationProto::_internal_quantization_offset() const {
+  return _impl_.quantization_offset_;
+}
+inline void ObservationProto::_internal_set_quantization_offset(float value) {
+  ;
+  _impl_.quantization_offset_ = value;
+}
+
+// bool is_delta = 12;
+inline void ObservationProto::clear_is_delta() {
+  _impl_.is_delta_ = false;
+}
+inline bool ObservationProto::is_delta() const {
+  // @@protoc_insertion_point(field_get:communicator_objects.ObservationProto.is_delta)
+  return _internal_is_delta();
+}
+inline void ObservationProto::set_is_delta(bool value) {
+  _internal_set_is_delta(value);
+  // @@protoc_insertion_point(field_set:communicator_objects.ObservationProto.is_delta)
+}
+inline bool ObservationProto::_internal_is_delta() const {
+  return _impl_.is_delta_;
+}
+inline void ObservationProto::_internal_set_is_delta(bool value) {
+  ;
+  _impl_.is_delta_ = value;
+}
+
+// int32 shared_with = 13;
+inline void ObservationProto::clear_shared_with() {
+  _impl_.shared_with_ = 0;
+}
+inline ::int32_t ObservationProto::shared_with() const {
+  // @@protoc_insertion_point(field_get:communicator_objects.ObservationProto.shared_with)
+  return _internal_shared_with();
+}
+inline void ObservationProto::set_shared_with(::int32_t value) {
+  _internal_set_shared_with(value);
+  // @@protoc_insertion_point(field_set:communicator_objects.ObservationProto.shared_with)
+}
+inline ::int32_t ObservationProto::_internal_shared_with() const {
+  return _impl_.shared_with_;
+}
+inline void ObservationProto::_internal_set_shared_with(::int32_t value) {
+  ;
+  _impl_.shared_with_ = value;
+}
+
 inline bool ObservationProto::has_observation_data() const {
   return observation_data_case() != OBSERVATION_DATA_NOT_SET;
 }
@@ -808,6 +1361,53 @@ inline ObservationProto::ObservationDataCase ObservationProto::observation_data_
 #pragma GCC diagnostic pop
 #endif  // __GNUC__
 
+// bytes shared_rows = 14;
+inline void ObservationProto::clear_shared_rows() {
+  _impl_.shared_rows_.ClearToEmpty();
+}
+inline const std::string& ObservationProto::shared_rows() const {
+  // @@protoc_insertion_point(field_get:communicator_objects.ObservationProto.shared_rows)
+  return _internal_shared_rows();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void ObservationProto::set_shared_rows(Arg_&& arg,
+                                                     Args_... args) {
+  ;
+  _impl_.shared_rows_.SetBytes(static_cast<Arg_&&>(arg), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:communicator_objects.ObservationProto.shared_rows)
+}
+inline std::string* ObservationProto::mutable_shared_rows() {
+  std::string* _s = _internal_mutable_shared_rows();
+  // @@protoc_insertion_point(field_mutable:communicator_objects.ObservationProto.shared_rows)
+  return _s;
+}
+inline const std::string& ObservationProto::_internal_shared_rows() const {
+  return _impl_.shared_rows_.Get();
+}
+inline void ObservationProto::_internal_set_shared_rows(const std::string& value) {
+  ;
+
+
+  _impl_.shared_rows_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ObservationProto::_internal_mutable_shared_rows() {
+  ;
+  return _impl_.shared_rows_.Mutable( GetArenaForAllocation());
+}
+inline std::string* ObservationProto::release_shared_rows() {
+  // @@protoc_insertion_point(field_release:communicator_objects.ObservationProto.shared_rows)
+  return _impl_.shared_rows_.Release();
+}
+inline void ObservationProto::set_allocated_shared_rows(std::string* value) {
+  _impl_.shared_rows_.SetAllocated(value, GetArenaForAllocation());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.shared_rows_.IsDefault()) {
+          _impl_.shared_rows_.Set("", GetArenaForAllocation());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:communicator_objects.ObservationProto.shared_rows)
+}
+
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace communicator_objects
 
@@ -820,6 +1420,18 @@ template <>
 inline const EnumDescriptor* GetEnumDescriptor<::communicator_objects::ObservationTypeProto>() {
   return ::communicator_objects::ObservationTypeProto_descriptor();
 }
+template <>
+struct is_proto_enum<::communicator_objects::CompressionTypeProto> : std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor<::communicator_objects::CompressionTypeProto>() {
+  return ::communicator_objects::CompressionTypeProto_descriptor();
+}
+template <>
+struct is_proto_enum<::communicator_objects::ObservationEncodingProto> : std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor<::communicator_objects::ObservationEncodingProto>() {
+  return ::communicator_objects::ObservationEncodingProto_descriptor();
+}
 
 PROTOBUF_NAMESPACE_CLOSE
 
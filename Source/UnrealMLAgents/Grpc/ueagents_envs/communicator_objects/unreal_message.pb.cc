@@ -28,9 +28,15 @@ PROTOBUF_CONSTEXPR UnrealMessageProto::UnrealMessageProto(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_._has_bits_)*/{}
   , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.chunk_)*/ {
+    &::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized {}
+  }
+
   , /*decltype(_impl_.header_)*/nullptr
   , /*decltype(_impl_.unreal_output_)*/nullptr
-  , /*decltype(_impl_.unreal_input_)*/nullptr} {}
+  , /*decltype(_impl_.unreal_input_)*/nullptr
+  , /*decltype(_impl_.more_chunks_)*/ false
+} {}
 struct UnrealMessageProtoDefaultTypeInternal {
   PROTOBUF_CONSTEXPR UnrealMessageProtoDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
   ~UnrealMessageProtoDefaultTypeInternal() {}
@@ -60,14 +66,18 @@ const ::uint32_t TableStruct_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5
     PROTOBUF_FIELD_OFFSET(::communicator_objects::UnrealMessageProto, _impl_.header_),
     PROTOBUF_FIELD_OFFSET(::communicator_objects::UnrealMessageProto, _impl_.unreal_output_),
     PROTOBUF_FIELD_OFFSET(::communicator_objects::UnrealMessageProto, _impl_.unreal_input_),
+    PROTOBUF_FIELD_OFFSET(::communicator_objects::UnrealMessageProto, _impl_.chunk_),
+    PROTOBUF_FIELD_OFFSET(::communicator_objects::UnrealMessageProto, _impl_.more_chunks_),
     0,
     1,
     2,
+    ~0u,
+    ~0u,
 };
 
 static const ::_pbi::MigrationSchema
     schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-        { 0, 11, -1, sizeof(::communicator_objects::UnrealMessageProto)},
+        { 0, 13, -1, sizeof(::communicator_objects::UnrealMessageProto)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
@@ -80,12 +90,13 @@ const char descriptor_table_protodef_ueagents_5fenvs_2fcommunicator_5fobjects_2f
     "al_output.proto\0325ueagents_envs/communica"
     "tor_objects/unreal_input.proto\032/ueagents"
     "_envs/communicator_objects/header.proto\""
-    "\305\001\n\022UnrealMessageProto\0221\n\006header\030\001 \001(\0132!"
+    "\351\001\n\022UnrealMessageProto\0221\n\006header\030\001 \001(\0132!"
     ".communicator_objects.HeaderProto\022>\n\runr"
     "eal_output\030\002 \001(\0132\'.communicator_objects."
     "UnrealOutputProto\022<\n\014unreal_input\030\003 \001(\0132"
-    "&.communicator_objects.UnrealInputProtob"
-    "\006proto3"
+    "&.communicator_objects.UnrealInputProto\022"
+    "\r\n\005chunk\030\004 \001(\014\022\023\n\013more_chunks\030\005 \001(\010b\006pro"
+    "to3"
 };
 static const ::_pbi::DescriptorTable* const descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5fmessage_2eproto_deps[3] =
     {
@@ -97,7 +108,7 @@ static ::absl::once_flag descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjec
 const ::_pbi::DescriptorTable descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5fmessage_2eproto = {
     false,
     false,
-    447,
+    483,
     descriptor_table_protodef_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5fmessage_2eproto,
     "ueagents_envs/communicator_objects/unreal_message.proto",
     &descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5fmessage_2eproto_once,
@@ -186,11 +197,22 @@ UnrealMessageProto::UnrealMessageProto(const UnrealMessageProto& from)
   new (&_impl_) Impl_{
       decltype(_impl_._has_bits_){from._impl_._has_bits_}
     , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.chunk_) {}
+
     , decltype(_impl_.header_){nullptr}
     , decltype(_impl_.unreal_output_){nullptr}
-    , decltype(_impl_.unreal_input_){nullptr}};
+    , decltype(_impl_.unreal_input_){nullptr}
+    , decltype(_impl_.more_chunks_) {}
+  };
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.chunk_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        _impl_.chunk_.Set("", GetArenaForAllocation());
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_chunk().empty()) {
+    _this->_impl_.chunk_.Set(from._internal_chunk(), _this->GetArenaForAllocation());
+  }
   if ((from._impl_._has_bits_[0] & 0x00000001u) != 0) {
     _this->_impl_.header_ = new ::communicator_objects::HeaderProto(*from._impl_.header_);
   }
@@ -200,6 +222,7 @@ UnrealMessageProto::UnrealMessageProto(const UnrealMessageProto& from)
   if ((from._impl_._has_bits_[0] & 0x00000004u) != 0) {
     _this->_impl_.unreal_input_ = new ::communicator_objects::UnrealInputProto(*from._impl_.unreal_input_);
   }
+  _this->_impl_.more_chunks_ = from._impl_.more_chunks_;
   // @@protoc_insertion_point(copy_constructor:communicator_objects.UnrealMessageProto)
 }
 
@@ -208,10 +231,18 @@ inline void UnrealMessageProto::SharedCtor(::_pb::Arena* arena) {
   new (&_impl_) Impl_{
       decltype(_impl_._has_bits_){}
     , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.chunk_) {}
+
     , decltype(_impl_.header_){nullptr}
     , decltype(_impl_.unreal_output_){nullptr}
     , decltype(_impl_.unreal_input_){nullptr}
+    , decltype(_impl_.more_chunks_) { false }
+
   };
+  _impl_.chunk_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        _impl_.chunk_.Set("", GetArenaForAllocation());
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 UnrealMessageProto::~UnrealMessageProto() {
@@ -225,6 +256,7 @@ UnrealMessageProto::~UnrealMessageProto() {
 
 inline void UnrealMessageProto::SharedDtor() {
   ABSL_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.chunk_.Destroy();
   if (this != internal_default_instance()) delete _impl_.header_;
   if (this != internal_default_instance()) delete _impl_.unreal_output_;
   if (this != internal_default_instance()) delete _impl_.unreal_input_;
@@ -240,6 +272,7 @@ void UnrealMessageProto::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  _impl_.chunk_.ClearToEmpty();
   cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x00000007u) {
     if (cached_has_bits & 0x00000001u) {
@@ -255,6 +288,7 @@ void UnrealMessageProto::Clear() {
       _impl_.unreal_input_->Clear();
     }
   }
+  _impl_.more_chunks_ = false;
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
@@ -293,6 +327,25 @@ const char* UnrealMessageProto::_InternalParse(const char* ptr, ::_pbi::ParseCon
           goto handle_unusual;
         }
         continue;
+      // bytes chunk = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_chunk();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else {
+          goto handle_unusual;
+        }
+        continue;
+      // bool more_chunks = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 40)) {
+          _impl_.more_chunks_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else {
+          goto handle_unusual;
+        }
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -345,6 +398,19 @@ failure:
         _Internal::unreal_input(this).GetCachedSize(), target, stream);
   }
 
+  // bytes chunk = 4;
+  if (!this->_internal_chunk().empty()) {
+    const std::string& _s = this->_internal_chunk();
+    target = stream->WriteBytesMaybeAliased(4, _s, target);
+  }
+
+  // bool more_chunks = 5;
+  if (this->_internal_more_chunks() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(
+        5, this->_internal_more_chunks(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -361,6 +427,12 @@ failure:
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  // bytes chunk = 4;
+  if (!this->_internal_chunk().empty()) {
+    total_size += 1 + ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+                                    this->_internal_chunk());
+  }
+
   cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x00000007u) {
     // .communicator_objects.HeaderProto header = 1;
@@ -385,6 +457,11 @@ failure:
     }
 
   }
+  // bool more_chunks = 5;
+  if (this->_internal_more_chunks() != 0) {
+    total_size += 2;
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -403,6 +480,9 @@ void UnrealMessageProto::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, con
   ::uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
+  if (!from._internal_chunk().empty()) {
+    _this->_internal_set_chunk(from._internal_chunk());
+  }
   cached_has_bits = from._impl_._has_bits_[0];
   if (cached_has_bits & 0x00000007u) {
     if (cached_has_bits & 0x00000001u) {
@@ -418,6 +498,9 @@ void UnrealMessageProto::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, con
           from._internal_unreal_input());
     }
   }
+  if (from._internal_more_chunks() != 0) {
+    _this->_internal_set_more_chunks(from._internal_more_chunks());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -434,11 +517,15 @@ bool UnrealMessageProto::IsInitialized() const {
 
 void UnrealMessageProto::InternalSwap(UnrealMessageProto* other) {
   using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.chunk_, lhs_arena,
+                                       &other->_impl_.chunk_, rhs_arena);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(UnrealMessageProto, _impl_.unreal_input_)
-      + sizeof(UnrealMessageProto::_impl_.unreal_input_)
+      PROTOBUF_FIELD_OFFSET(UnrealMessageProto, _impl_.more_chunks_)
+      + sizeof(UnrealMessageProto::_impl_.more_chunks_)
       - PROTOBUF_FIELD_OFFSET(UnrealMessageProto, _impl_.header_)>(
           reinterpret_cast<char*>(&_impl_.header_),
           reinterpret_cast<char*>(&other->_impl_.header_));
@@ -200,10 +200,32 @@ class UnrealMessageProto final :
   // accessors -------------------------------------------------------
 
   enum : int {
+    kChunkFieldNumber = 4,
     kHeaderFieldNumber = 1,
     kUnrealOutputFieldNumber = 2,
     kUnrealInputFieldNumber = 3,
+    kMoreChunksFieldNumber = 5,
   };
+  // bytes chunk = 4;
+  void clear_chunk() ;
+  const std::string& chunk() const;
+
+
+
+
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_chunk(Arg_&& arg, Args_... args);
+  std::string* mutable_chunk();
+  PROTOBUF_NODISCARD std::string* release_chunk();
+  void set_allocated_chunk(std::string* ptr);
+
+  private:
+  const std::string& _internal_chunk() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_chunk(
+      const std::string& value);
+  std::string* _internal_mutable_chunk();
+
+  public:
   // .communicator_objects.HeaderProto header = 1;
   bool has_header() const;
   void clear_header() ;
@@ -246,6 +268,16 @@ class UnrealMessageProto final :
   void unsafe_arena_set_allocated_unreal_input(
       ::communicator_objects::UnrealInputProto* unreal_input);
   ::communicator_objects::UnrealInputProto* unsafe_arena_release_unreal_input();
+  // bool more_chunks = 5;
+  void clear_more_chunks() ;
+  bool more_chunks() const;
+  void set_more_chunks(bool value);
+
+  private:
+  bool _internal_more_chunks() const;
+  void _internal_set_more_chunks(bool value);
+
+  public:
   // @@protoc_insertion_point(class_scope:communicator_objects.UnrealMessageProto)
  private:
   class _Internal;
@@ -256,9 +288,11 @@ class UnrealMessageProto final :
   struct Impl_ {
     ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr chunk_;
     ::communicator_objects::HeaderProto* header_;
     ::communicator_objects::UnrealOutputProto* unreal_output_;
     ::communicator_objects::UnrealInputProto* unreal_input_;
+    bool more_chunks_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5fmessage_2eproto;
@@ -532,6 +566,73 @@ inline void UnrealMessageProto::set_allocated_unreal_input(::communicator_object
   // @@protoc_insertion_point(field_set_allocated:communicator_objects.UnrealMessageProto.unreal_input)
 }
 
+// bytes chunk = 4;
+inline void UnrealMessageProto::clear_chunk() {
+  _impl_.chunk_.ClearToEmpty();
+}
+inline const std::string& UnrealMessageProto::chunk() const {
+  // @@protoc_insertion_point(field_get:communicator_objects.UnrealMessageProto.chunk)
+  return _internal_chunk();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void UnrealMessageProto::set_chunk(Arg_&& arg,
+                                                     Args_... args) {
+  ;
+  _impl_.chunk_.SetBytes(static_cast<Arg_&&>(arg), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:communicator_objects.UnrealMessageProto.chunk)
+}
+inline std::string* UnrealMessageProto::mutable_chunk() {
+  std::string* _s = _internal_mutable_chunk();
+  // @@protoc_insertion_point(field_mutable:communicator_objects.UnrealMessageProto.chunk)
+  return _s;
+}
+inline const std::string& UnrealMessageProto::_internal_chunk() const {
+  return _impl_.chunk_.Get();
+}
+inline void UnrealMessageProto::_internal_set_chunk(const std::string& value) {
+  ;
+
+
+  _impl_.chunk_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UnrealMessageProto::_internal_mutable_chunk() {
+  ;
+  return _impl_.chunk_.Mutable( GetArenaForAllocation());
+}
+inline std::string* UnrealMessageProto::release_chunk() {
+  // @@protoc_insertion_point(field_release:communicator_objects.UnrealMessageProto.chunk)
+  return _impl_.chunk_.Release();
+}
+inline void UnrealMessageProto::set_allocated_chunk(std::string* value) {
+  _impl_.chunk_.SetAllocated(value, GetArenaForAllocation());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.chunk_.IsDefault()) {
+          _impl_.chunk_.Set("", GetArenaForAllocation());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:communicator_objects.UnrealMessageProto.chunk)
+}
+
+// bool more_chunks = 5;
+inline void UnrealMessageProto::clear_more_chunks() {
+  _impl_.more_chunks_ = false;
+}
+inline bool UnrealMessageProto::more_chunks() const {
+  // @@protoc_insertion_point(field_get:communicator_objects.UnrealMessageProto.more_chunks)
+  return _internal_more_chunks();
+}
+inline void UnrealMessageProto::set_more_chunks(bool value) {
+  _internal_set_more_chunks(value);
+  // @@protoc_insertion_point(field_set:communicator_objects.UnrealMessageProto.more_chunks)
+}
+inline bool UnrealMessageProto::_internal_more_chunks() const {
+  return _impl_.more_chunks_;
+}
+inline void UnrealMessageProto::_internal_set_more_chunks(bool value) {
+  ;
+  _impl_.more_chunks_ = value;
+}
+
 #ifdef __GNUC__
 #pragma GCC diagnostic pop
 #endif  // __GNUC__
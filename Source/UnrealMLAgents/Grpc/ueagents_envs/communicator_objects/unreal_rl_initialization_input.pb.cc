@@ -38,6 +38,24 @@ PROTOBUF_CONSTEXPR UnrealRLInitializationInputProto::UnrealRLInitializationInput
 
   , /*decltype(_impl_.num_areas_)*/ 0
 
+  , /*decltype(_impl_.compressed_observations_)*/ false
+
+  , /*decltype(_impl_.quantized_observations_)*/ false
+
+  , /*decltype(_impl_.delta_observations_)*/ false
+
+  , /*decltype(_impl_.packed_observations_)*/ false
+
+  , /*decltype(_impl_.streaming_exchange_)*/ false
+
+  , /*decltype(_impl_.max_message_size_)*/ 0
+
+  , /*decltype(_impl_.registered_observation_specs_)*/ false
+
+  , /*decltype(_impl_.action_sequences_)*/ false
+
+  , /*decltype(_impl_.shared_observations_)*/ false
+
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct UnrealRLInitializationInputProtoDefaultTypeInternal {
   PROTOBUF_CONSTEXPR UnrealRLInitializationInputProtoDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
@@ -69,6 +87,15 @@ const ::uint32_t TableStruct_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5
     PROTOBUF_FIELD_OFFSET(::communicator_objects::UnrealRLInitializationInputProto, _impl_.communication_version_),
     PROTOBUF_FIELD_OFFSET(::communicator_objects::UnrealRLInitializationInputProto, _impl_.package_version_),
     PROTOBUF_FIELD_OFFSET(::communicator_objects::UnrealRLInitializationInputProto, _impl_.num_areas_),
+    PROTOBUF_FIELD_OFFSET(::communicator_objects::UnrealRLInitializationInputProto, _impl_.compressed_observations_),
+    PROTOBUF_FIELD_OFFSET(::communicator_objects::UnrealRLInitializationInputProto, _impl_.quantized_observations_),
+    PROTOBUF_FIELD_OFFSET(::communicator_objects::UnrealRLInitializationInputProto, _impl_.delta_observations_),
+    PROTOBUF_FIELD_OFFSET(::communicator_objects::UnrealRLInitializationInputProto, _impl_.packed_observations_),
+    PROTOBUF_FIELD_OFFSET(::communicator_objects::UnrealRLInitializationInputProto, _impl_.streaming_exchange_),
+    PROTOBUF_FIELD_OFFSET(::communicator_objects::UnrealRLInitializationInputProto, _impl_.max_message_size_),
+    PROTOBUF_FIELD_OFFSET(::communicator_objects::UnrealRLInitializationInputProto, _impl_.registered_observation_specs_),
+    PROTOBUF_FIELD_OFFSET(::communicator_objects::UnrealRLInitializationInputProto, _impl_.action_sequences_),
+    PROTOBUF_FIELD_OFFSET(::communicator_objects::UnrealRLInitializationInputProto, _impl_.shared_observations_),
 };
 
 static const ::_pbi::MigrationSchema
@@ -82,16 +109,23 @@ static const ::_pb::Message* const file_default_instances[] = {
 const char descriptor_table_protodef_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5frl_5finitialization_5finput_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
     "\nGueagents_envs/communicator_objects/unr"
     "eal_rl_initialization_input.proto\022\024commu"
-    "nicator_objects\"{\n UnrealRLInitializatio"
-    "nInputProto\022\014\n\004seed\030\001 \001(\005\022\035\n\025communicati"
-    "on_version\030\002 \001(\t\022\027\n\017package_version\030\003 \001("
-    "\t\022\021\n\tnum_areas\030\004 \001(\005b\006proto3"
+    "nicator_objects\"\210\003\n UnrealRLInitializati"
+    "onInputProto\022\014\n\004seed\030\001 \001(\005\022\035\n\025communicat"
+    "ion_version\030\002 \001(\t\022\027\n\017package_version\030\003 \001"
+    "(\t\022\021\n\tnum_areas\030\004 \001(\005\022\037\n\027compressed_obse"
+    "rvations\030\005 \001(\010\022\036\n\026quantized_observations"
+    "\030\006 \001(\010\022\032\n\022delta_observations\030\007 \001(\010\022\033\n\023pa"
+    "cked_observations\030\010 \001(\010\022\032\n\022streaming_exc"
+    "hange\030\t \001(\010\022\030\n\020max_message_size\030\n \001(\005\022$\n"
+    "\034registered_observation_specs\030\013 \001(\010\022\030\n\020a"
+    "ction_sequences\030\014 \001(\010\022\033\n\023shared_observat"
+    "ions\030\r \001(\010b\006proto3"
 };
 static ::absl::once_flag descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5frl_5finitialization_5finput_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5frl_5finitialization_5finput_2eproto = {
     false,
     false,
-    228,
+    498,
     descriptor_table_protodef_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5frl_5finitialization_5finput_2eproto,
     "ueagents_envs/communicator_objects/unreal_rl_initialization_input.proto",
     &descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5frl_5finitialization_5finput_2eproto_once,
@@ -147,6 +181,24 @@ UnrealRLInitializationInputProto::UnrealRLInitializationInputProto(const UnrealR
 
     , decltype(_impl_.num_areas_) {}
 
+    , decltype(_impl_.compressed_observations_) {}
+
+    , decltype(_impl_.quantized_observations_) {}
+
+    , decltype(_impl_.delta_observations_) {}
+
+    , decltype(_impl_.packed_observations_) {}
+
+    , decltype(_impl_.streaming_exchange_) {}
+
+    , decltype(_impl_.max_message_size_) {}
+
+    , decltype(_impl_.registered_observation_specs_) {}
+
+    , decltype(_impl_.action_sequences_) {}
+
+    , decltype(_impl_.shared_observations_) {}
+
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
@@ -165,8 +217,8 @@ UnrealRLInitializationInputProto::UnrealRLInitializationInputProto(const UnrealR
     _this->_impl_.package_version_.Set(from._internal_package_version(), _this->GetArenaForAllocation());
   }
   ::memcpy(&_impl_.seed_, &from._impl_.seed_,
-    static_cast<::size_t>(reinterpret_cast<char*>(&_impl_.num_areas_) -
-    reinterpret_cast<char*>(&_impl_.seed_)) + sizeof(_impl_.num_areas_));
+    static_cast<::size_t>(reinterpret_cast<char*>(&_impl_.shared_observations_) -
+    reinterpret_cast<char*>(&_impl_.seed_)) + sizeof(_impl_.shared_observations_));
   // @@protoc_insertion_point(copy_constructor:communicator_objects.UnrealRLInitializationInputProto)
 }
 
@@ -181,6 +233,24 @@ inline void UnrealRLInitializationInputProto::SharedCtor(::_pb::Arena* arena) {
 
     , decltype(_impl_.num_areas_) { 0 }
 
+    , decltype(_impl_.compressed_observations_) { false }
+
+    , decltype(_impl_.quantized_observations_) { false }
+
+    , decltype(_impl_.delta_observations_) { false }
+
+    , decltype(_impl_.packed_observations_) { false }
+
+    , decltype(_impl_.streaming_exchange_) { false }
+
+    , decltype(_impl_.max_message_size_) { 0 }
+
+    , decltype(_impl_.registered_observation_specs_) { false }
+
+    , decltype(_impl_.action_sequences_) { false }
+
+    , decltype(_impl_.shared_observations_) { false }
+
     , /*decltype(_impl_._cached_size_)*/{}
   };
   _impl_.communication_version_.InitDefault();
@@ -221,8 +291,8 @@ void UnrealRLInitializationInputProto::Clear() {
   _impl_.communication_version_.ClearToEmpty();
   _impl_.package_version_.ClearToEmpty();
   ::memset(&_impl_.seed_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.num_areas_) -
-      reinterpret_cast<char*>(&_impl_.seed_)) + sizeof(_impl_.num_areas_));
+      reinterpret_cast<char*>(&_impl_.shared_observations_) -
+      reinterpret_cast<char*>(&_impl_.seed_)) + sizeof(_impl_.shared_observations_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -272,6 +342,95 @@ const char* UnrealRLInitializationInputProto::_InternalParse(const char* ptr, ::
           goto handle_unusual;
         }
         continue;
+      // bool compressed_observations = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 40)) {
+          #pragma warning(disable: 4800)
+          _impl_.compressed_observations_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else {
+          goto handle_unusual;
+        }
+        continue;
+      // bool quantized_observations = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 48)) {
+          #pragma warning(disable: 4800)
+          _impl_.quantized_observations_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else {
+          goto handle_unusual;
+        }
+        continue;
+      // bool delta_observations = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 56)) {
+          #pragma warning(disable: 4800)
+          _impl_.delta_observations_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else {
+          goto handle_unusual;
+        }
+        continue;
+      // bool packed_observations = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 64)) {
+          #pragma warning(disable: 4800)
+          _impl_.packed_observations_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else {
+          goto handle_unusual;
+        }
+        continue;
+      // bool streaming_exchange = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 72)) {
+          #pragma warning(disable: 4800)
+          _impl_.streaming_exchange_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else {
+          goto handle_unusual;
+        }
+        continue;
+      // int32 max_message_size = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 80)) {
+          _impl_.max_message_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else {
+          goto handle_unusual;
+        }
+        continue;
+      // bool registered_observation_specs = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 88)) {
+          #pragma warning(disable: 4800)
+          _impl_.registered_observation_specs_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else {
+          goto handle_unusual;
+        }
+        continue;
+      // bool action_sequences = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 96)) {
+          #pragma warning(disable: 4800)
+          _impl_.action_sequences_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else {
+          goto handle_unusual;
+        }
+        continue;
+      // bool shared_observations = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 104)) {
+          #pragma warning(disable: 4800)
+          _impl_.shared_observations_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else {
+          goto handle_unusual;
+        }
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -331,6 +490,69 @@ failure:
         4, this->_internal_num_areas(), target);
   }
 
+  // bool compressed_observations = 5;
+  if (this->_internal_compressed_observations() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(
+        5, this->_internal_compressed_observations(), target);
+  }
+
+  // bool quantized_observations = 6;
+  if (this->_internal_quantized_observations() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(
+        6, this->_internal_quantized_observations(), target);
+  }
+
+  // bool delta_observations = 7;
+  if (this->_internal_delta_observations() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(
+        7, this->_internal_delta_observations(), target);
+  }
+
+  // bool packed_observations = 8;
+  if (this->_internal_packed_observations() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(
+        8, this->_internal_packed_observations(), target);
+  }
+
+  // bool streaming_exchange = 9;
+  if (this->_internal_streaming_exchange() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(
+        9, this->_internal_streaming_exchange(), target);
+  }
+
+  // int32 max_message_size = 10;
+  if (this->_internal_max_message_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(
+        10, this->_internal_max_message_size(), target);
+  }
+
+  // bool registered_observation_specs = 11;
+  if (this->_internal_registered_observation_specs() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(
+        11, this->_internal_registered_observation_specs(), target);
+  }
+
+  // bool action_sequences = 12;
+  if (this->_internal_action_sequences() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(
+        12, this->_internal_action_sequences(), target);
+  }
+
+  // bool shared_observations = 13;
+  if (this->_internal_shared_observations() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(
+        13, this->_internal_shared_observations(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -371,6 +593,52 @@ failure:
         this->_internal_num_areas());
   }
 
+  // bool compressed_observations = 5;
+  if (this->_internal_compressed_observations() != 0) {
+    total_size += 2;
+  }
+
+  // bool quantized_observations = 6;
+  if (this->_internal_quantized_observations() != 0) {
+    total_size += 2;
+  }
+
+  // bool delta_observations = 7;
+  if (this->_internal_delta_observations() != 0) {
+    total_size += 2;
+  }
+
+  // bool packed_observations = 8;
+  if (this->_internal_packed_observations() != 0) {
+    total_size += 2;
+  }
+
+  // bool streaming_exchange = 9;
+  if (this->_internal_streaming_exchange() != 0) {
+    total_size += 2;
+  }
+
+  // int32 max_message_size = 10;
+  if (this->_internal_max_message_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+        this->_internal_max_message_size());
+  }
+
+  // bool registered_observation_specs = 11;
+  if (this->_internal_registered_observation_specs() != 0) {
+    total_size += 2;
+  }
+
+  // bool action_sequences = 12;
+  if (this->_internal_action_sequences() != 0) {
+    total_size += 2;
+  }
+
+  // bool shared_observations = 13;
+  if (this->_internal_shared_observations() != 0) {
+    total_size += 2;
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -401,6 +669,33 @@ void UnrealRLInitializationInputProto::MergeImpl(::PROTOBUF_NAMESPACE_ID::Messag
   if (from._internal_num_areas() != 0) {
     _this->_internal_set_num_areas(from._internal_num_areas());
   }
+  if (from._internal_compressed_observations() != 0) {
+    _this->_internal_set_compressed_observations(from._internal_compressed_observations());
+  }
+  if (from._internal_quantized_observations() != 0) {
+    _this->_internal_set_quantized_observations(from._internal_quantized_observations());
+  }
+  if (from._internal_delta_observations() != 0) {
+    _this->_internal_set_delta_observations(from._internal_delta_observations());
+  }
+  if (from._internal_packed_observations() != 0) {
+    _this->_internal_set_packed_observations(from._internal_packed_observations());
+  }
+  if (from._internal_streaming_exchange() != 0) {
+    _this->_internal_set_streaming_exchange(from._internal_streaming_exchange());
+  }
+  if (from._internal_max_message_size() != 0) {
+    _this->_internal_set_max_message_size(from._internal_max_message_size());
+  }
+  if (from._internal_registered_observation_specs() != 0) {
+    _this->_internal_set_registered_observation_specs(from._internal_registered_observation_specs());
+  }
+  if (from._internal_action_sequences() != 0) {
+    _this->_internal_set_action_sequences(from._internal_action_sequences());
+  }
+  if (from._internal_shared_observations() != 0) {
+    _this->_internal_set_shared_observations(from._internal_shared_observations());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -425,8 +720,8 @@ void UnrealRLInitializationInputProto::InternalSwap(UnrealRLInitializationInputP
   ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.package_version_, lhs_arena,
                                        &other->_impl_.package_version_, rhs_arena);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(UnrealRLInitializationInputProto, _impl_.num_areas_)
-      + sizeof(UnrealRLInitializationInputProto::_impl_.num_areas_)
+      PROTOBUF_FIELD_OFFSET(UnrealRLInitializationInputProto, _impl_.shared_observations_)
+      + sizeof(UnrealRLInitializationInputProto::_impl_.shared_observations_)
       - PROTOBUF_FIELD_OFFSET(UnrealRLInitializationInputProto, _impl_.seed_)>(
           reinterpret_cast<char*>(&_impl_.seed_),
           reinterpret_cast<char*>(&other->_impl_.seed_));
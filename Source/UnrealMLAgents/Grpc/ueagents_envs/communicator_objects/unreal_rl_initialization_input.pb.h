@@ -201,6 +201,15 @@ class UnrealRLInitializationInputProto final :
     kPackageVersionFieldNumber = 3,
     kSeedFieldNumber = 1,
     kNumAreasFieldNumber = 4,
+    kCompressedObservationsFieldNumber = 5,
+    kQuantizedObservationsFieldNumber = 6,
+    kDeltaObservationsFieldNumber = 7,
+    kPackedObservationsFieldNumber = 8,
+    kStreamingExchangeFieldNumber = 9,
+    kMaxMessageSizeFieldNumber = 10,
+    kRegisteredObservationSpecsFieldNumber = 11,
+    kActionSequencesFieldNumber = 12,
+    kSharedObservationsFieldNumber = 13,
   };
   // string communication_version = 2;
   void clear_communication_version() ;
@@ -261,6 +270,96 @@ class UnrealRLInitializationInputProto final :
   ::int32_t _internal_num_areas() const;
   void _internal_set_num_areas(::int32_t value);
 
+  public:
+  // bool compressed_observations = 5;
+  void clear_compressed_observations() ;
+  bool compressed_observations() const;
+  void set_compressed_observations(bool value);
+
+  private:
+  bool _internal_compressed_observations() const;
+  void _internal_set_compressed_observations(bool value);
+
+  public:
+  // bool quantized_observations = 6;
+  void clear_quantized_observations() ;
+  bool quantized_observations() const;
+  void set_quantized_observations(bool value);
+
+  private:
+  bool _internal_quantized_observations() const;
+  void _internal_set_quantized_observations(bool value);
+
+  public:
+  // bool delta_observations = 7;
+  void clear_delta_observations() ;
+  bool delta_observations() const;
+  void set_delta_observations(bool value);
+
+  private:
+  bool _internal_delta_observations() const;
+  void _internal_set_delta_observations(bool value);
+
+  public:
+  // bool packed_observations = 8;
+  void clear_packed_observations() ;
+  bool packed_observations() const;
+  void set_packed_observations(bool value);
+
+  private:
+  bool _internal_packed_observations() const;
+  void _internal_set_packed_observations(bool value);
+
+  public:
+  // bool streaming_exchange = 9;
+  void clear_streaming_exchange() ;
+  bool streaming_exchange() const;
+  void set_streaming_exchange(bool value);
+
+  private:
+  bool _internal_streaming_exchange() const;
+  void _internal_set_streaming_exchange(bool value);
+
+  public:
+  // int32 max_message_size = 10;
+  void clear_max_message_size() ;
+  ::int32_t max_message_size() const;
+  void set_max_message_size(::int32_t value);
+
+  private:
+  ::int32_t _internal_max_message_size() const;
+  void _internal_set_max_message_size(::int32_t value);
+
+  public:
+  // bool registered_observation_specs = 11;
+  void clear_registered_observation_specs() ;
+  bool registered_observation_specs() const;
+  void set_registered_observation_specs(bool value);
+
+  private:
+  bool _internal_registered_observation_specs() const;
+  void _internal_set_registered_observation_specs(bool value);
+
+  public:
+  // bool action_sequences = 12;
+  void clear_action_sequences() ;
+  bool action_sequences() const;
+  void set_action_sequences(bool value);
+
+  private:
+  bool _internal_action_sequences() const;
+  void _internal_set_action_sequences(bool value);
+
+  public:
+  // bool shared_observations = 13;
+  void clear_shared_observations() ;
+  bool shared_observations() const;
+  void set_shared_observations(bool value);
+
+  private:
+  bool _internal_shared_observations() const;
+  void _internal_set_shared_observations(bool value);
+
   public:
   // @@protoc_insertion_point(class_scope:communicator_objects.UnrealRLInitializationInputProto)
  private:
@@ -274,6 +373,15 @@ class UnrealRLInitializationInputProto final :
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr package_version_;
     ::int32_t seed_;
     ::int32_t num_areas_;
+    bool compressed_observations_;
+    bool quantized_observations_;
+    bool delta_observations_;
+    bool packed_observations_;
+    bool streaming_exchange_;
+    ::int32_t max_message_size_;
+    bool registered_observation_specs_;
+    bool action_sequences_;
+    bool shared_observations_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -430,6 +538,186 @@ inline void UnrealRLInitializationInputProto::_internal_set_num_areas(::int32_t
   _impl_.num_areas_ = value;
 }
 
+// bool compressed_observations = 5;
+inline void UnrealRLInitializationInputProto::clear_compressed_observations() {
+  _impl_.compressed_observations_ = false;
+}
+inline bool UnrealRLInitializationInputProto::compressed_observations() const {
+  // @@protoc_insertion_point(field_get:communicator_objects.UnrealRLInitializationInputProto.compressed_observations)
+  return _internal_compressed_observations();
+}
+inline void UnrealRLInitializationInputProto::set_compressed_observations(bool value) {
+  _internal_set_compressed_observations(value);
+  // @@protoc_insertion_point(field_set:communicator_objects.UnrealRLInitializationInputProto.compressed_observations)
+}
+inline bool UnrealRLInitializationInputProto::_internal_compressed_observations() const {
+  return _impl_.compressed_observations_;
+}
+inline void UnrealRLInitializationInputProto::_internal_set_compressed_observations(bool value) {
+  ;
+  _impl_.compressed_observations_ = value;
+}
+
+// bool quantized_observations = 6;
+inline void UnrealRLInitializationInputProto::clear_quantized_observations() {
+  _impl_.quantized_observations_ = false;
+}
+inline bool UnrealRLInitializationInputProto::quantized_observations() const {
+  // @@protoc_insertion_point(field_get:communicator_objects.UnrealRLInitializationInputProto.quantized_observations)
+  return _internal_quantized_observations();
+}
+inline void UnrealRLInitializationInputProto::set_quantized_observations(bool value) {
+  _internal_set_quantized_observations(value);
+  // @@protoc_insertion_point(field_set:communicator_objects.UnrealRLInitializationInputProto.quantized_observations)
+}
+inline bool UnrealRLInitializationInputProto::_internal_quantized_observations() const {
+  return _impl_.quantized_observations_;
+}
+inline void UnrealRLInitializationInputProto::_internal_set_quantized_observations(bool value) {
+  ;
+  _impl_.quantized_observations_ = value;
+}
+
+// bool delta_observations = 7;
+inline void UnrealRLInitializationInputProto::clear_delta_observations() {
+  _impl_.delta_observations_ = false;
+}
+inline bool UnrealRLInitializationInputProto::delta_observations() const {
+  // @@protoc_insertion_point(field_get:communicator_objects.UnrealRLInitializationInputProto.delta_observations)
+  return _internal_delta_observations();
+}
+inline void UnrealRLInitializationInputProto::set_delta_observations(bool value) {
+  _internal_set_delta_observations(value);
+  // @@protoc_insertion_point(field_set:communicator_objects.UnrealRLInitializationInputProto.delta_observations)
+}
+inline bool UnrealRLInitializationInputProto::_internal_delta_observations() const {
+  return _impl_.delta_observations_;
+}
+inline void UnrealRLInitializationInputProto::_internal_set_delta_observations(bool value) {
+  ;
+  _impl_.delta_observations_ = value;
+}
+
+// bool packed_observations = 8;
+inline void UnrealRLInitializationInputProto::clear_packed_observations() {
+  _impl_.packed_observations_ = false;
+}
+inline bool UnrealRLInitializationInputProto::packed_observations() const {
+  // @@protoc_insertion_point(field_get:communicator_objects.UnrealRLInitializationInputProto.packed_observations)
+  return _internal_packed_observations();
+}
+inline void UnrealRLInitializationInputProto::set_packed_observations(bool value) {
+  _internal_set_packed_observations(value);
+  // @@protoc_insertion_point(field_set:communicator_objects.UnrealRLInitializationInputProto.packed_observations)
+}
+inline bool UnrealRLInitializationInputProto::_internal_packed_observations() const {
+  return _impl_.packed_observations_;
+}
+inline void UnrealRLInitializationInputProto::_internal_set_packed_observations(bool value) {
+  ;
+  _impl_.packed_observations_ = value;
+}
+
+// bool streaming_exchange = 9;
+inline void UnrealRLInitializationInputProto::clear_streaming_exchange() {
+  _impl_.streaming_exchange_ = false;
+}
+inline bool UnrealRLInitializationInputProto::streaming_exchange() const {
+  // @@protoc_insertion_point(field_get:communicator_objects.UnrealRLInitializationInputProto.streaming_exchange)
+  return _internal_streaming_exchange();
+}
+inline void UnrealRLInitializationInputProto::set_streaming_exchange(bool value) {
+  _internal_set_streaming_exchange(value);
+  // @@protoc_insertion_point(field_set:communicator_objects.UnrealRLInitializationInputProto.streaming_exchange)
+}
+inline bool UnrealRLInitializationInputProto::_internal_streaming_exchange() const {
+  return _impl_.streaming_exchange_;
+}
+inline void UnrealRLInitializationInputProto::_internal_set_streaming_exchange(bool value) {
+  ;
+  _impl_.streaming_exchange_ = value;
+}
+
+// int32 max_message_size = 10;
+inline void UnrealRLInitializationInputProto::clear_max_message_size() {
+  _impl_.max_message_size_ = 0;
+}
+inline ::int32_t UnrealRLInitializationInputProto::max_message_size() const {
+  // @@protoc_insertion_point(field_get:communicator_objects.UnrealRLInitializationInputProto.max_message_size)
+  return _internal_max_message_size();
+}
+inline void UnrealRLInitializationInputProto::set_max_message_size(::int32_t value) {
+  _internal_set_max_message_size(value);
+  // @@protoc_insertion_point(field_set:communicator_objects.UnrealRLInitializationInputProto.max_message_size)
+}
+inline ::int32_t UnrealRLInitializationInputProto::_internal_max_message_size() const {
+  return _impl_.max_message_size_;
+}
+inline void UnrealRLInitializationInputProto::_internal_set_max_message_size(::int32_t value) {
+  ;
+  _impl_.max_message_size_ = value;
+}
+
+// bool registered_observation_specs = 11;
+inline void UnrealRLInitializationInputProto::clear_registered_observation_specs() {
+  _impl_.registered_observation_specs_ = false;
+}
+inline bool UnrealRLInitializationInputProto::registered_observation_specs() const {
+  // @@protoc_insertion_point(field_get:communicator_objects.UnrealRLInitializationInputProto.registered_observation_specs)
+  return _internal_registered_observation_specs();
+}
+inline void UnrealRLInitializationInputProto::set_registered_observation_specs(bool value) {
+  _internal_set_registered_observation_specs(value);
+  // @@protoc_insertion_point(field_set:communicator_objects.UnrealRLInitializationInputProto.registered_observation_specs)
+}
+inline bool UnrealRLInitializationInputProto::_internal_registered_observation_specs() const {
+  return _impl_.registered_observation_specs_;
+}
+inline void UnrealRLInitializationInputProto::_internal_set_registered_observation_specs(bool value) {
+  ;
+  _impl_.registered_observation_specs_ = value;
+}
+
+// bool action_sequences = 12;
+inline void UnrealRLInitializationInputProto::clear_action_sequences() {
+  _impl_.action_sequences_ = false;
+}
+inline bool UnrealRLInitializationInputProto::action_sequences() const {
+  // @@protoc_insertion_point(field_get:communicator_objects.UnrealRLInitializationInputProto.action_sequences)
+  return _internal_action_sequences();
+}
+inline void UnrealRLInitializationInputProto::set_action_sequences(bool value) {
+  _internal_set_action_sequences(value);
+  // @@protoc_insertion_point(field_set:communicator_objects.UnrealRLInitializationInputProto.action_sequences)
+}
+inline bool UnrealRLInitializationInputProto::_internal_action_sequences() const {
+  return _impl_.action_sequences_;
+}
+inline void UnrealRLInitializationInputProto::_internal_set_action_sequences(bool value) {
+  ;
+  _impl_.action_sequences_ = value;
+}
+
+// bool shared_observations = 13;
+inline void UnrealRLInitializationInputProto::clear_shared_observations() {
+  _impl_.shared_observations_ = false;
+}
+inline bool UnrealRLInitializationInputProto::shared_observations() const {
+  // @@protoc_insertion_point(field_get:communicator_objects.UnrealRLInitializationInputProto.shared_observations)
+  return _internal_shared_observations();
+}
+inline void UnrealRLInitializationInputProto::set_shared_observations(bool value) {
+  _internal_set_shared_observations(value);
+  // @@protoc_insertion_point(field_set:communicator_objects.UnrealRLInitializationInputProto.shared_observations)
+}
+inline bool UnrealRLInitializationInputProto::_internal_shared_observations() const {
+  return _impl_.shared_observations_;
+}
+inline void UnrealRLInitializationInputProto::_internal_set_shared_observations(bool value) {
+  ;
+  _impl_.shared_observations_ = value;
+}
+
 #ifdef __GNUC__
 #pragma GCC diagnostic pop
 #endif  // __GNUC__
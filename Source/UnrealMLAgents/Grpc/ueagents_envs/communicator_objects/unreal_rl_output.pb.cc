@@ -39,6 +39,55 @@ struct UnrealRLOutputProto_ListAgentInfoProtoDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
     PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UnrealRLOutputProto_ListAgentInfoProtoDefaultTypeInternal _UnrealRLOutputProto_ListAgentInfoProto_default_instance_;
 template <typename>
+PROTOBUF_CONSTEXPR UnrealRLOutputProto_PackedAgentInfoProto::UnrealRLOutputProto_PackedAgentInfoProto(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.observations_)*/{}
+  , /*decltype(_impl_.ids_)*/ {
+    &::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized {}
+  }
+
+  , /*decltype(_impl_.rewards_)*/ {
+    &::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized {}
+  }
+
+  , /*decltype(_impl_.dones_)*/ {
+    &::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized {}
+  }
+
+  , /*decltype(_impl_.max_step_reached_)*/ {
+    &::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized {}
+  }
+
+  , /*decltype(_impl_.group_ids_)*/ {
+    &::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized {}
+  }
+
+  , /*decltype(_impl_.group_rewards_)*/ {
+    &::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized {}
+  }
+
+  , /*decltype(_impl_.action_masks_)*/ {
+    &::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized {}
+  }
+
+  , /*decltype(_impl_.consumed_steps_)*/ {
+    &::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized {}
+  }
+
+  , /*decltype(_impl_.num_agents_)*/ 0
+
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct UnrealRLOutputProto_PackedAgentInfoProtoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UnrealRLOutputProto_PackedAgentInfoProtoDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UnrealRLOutputProto_PackedAgentInfoProtoDefaultTypeInternal() {}
+  union {
+    UnrealRLOutputProto_PackedAgentInfoProto _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UnrealRLOutputProto_PackedAgentInfoProtoDefaultTypeInternal _UnrealRLOutputProto_PackedAgentInfoProto_default_instance_;
+template <typename>
 PROTOBUF_CONSTEXPR UnrealRLOutputProto_AgentInfosEntry_DoNotUse::UnrealRLOutputProto_AgentInfosEntry_DoNotUse(
     ::_pbi::ConstantInitialized) {}
 struct UnrealRLOutputProto_AgentInfosEntry_DoNotUseDefaultTypeInternal {
@@ -52,9 +101,23 @@ struct UnrealRLOutputProto_AgentInfosEntry_DoNotUseDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
     PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UnrealRLOutputProto_AgentInfosEntry_DoNotUseDefaultTypeInternal _UnrealRLOutputProto_AgentInfosEntry_DoNotUse_default_instance_;
 template <typename>
+PROTOBUF_CONSTEXPR UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUse::UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUse _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUseDefaultTypeInternal _UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUse_default_instance_;
+template <typename>
 PROTOBUF_CONSTEXPR UnrealRLOutputProto::UnrealRLOutputProto(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.agentinfos_)*/{}
+  , /*decltype(_impl_.packedagentinfos_)*/{}
   , /*decltype(_impl_.side_channel_)*/ {
     &::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized {}
   }
@@ -71,7 +134,7 @@ struct UnrealRLOutputProtoDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
     PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UnrealRLOutputProtoDefaultTypeInternal _UnrealRLOutputProto_default_instance_;
 }  // namespace communicator_objects
-static ::_pb::Metadata file_level_metadata_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5frl_5foutput_2eproto[3];
+static ::_pb::Metadata file_level_metadata_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5frl_5foutput_2eproto[5];
 static constexpr const ::_pb::EnumDescriptor**
     file_level_enum_descriptors_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5frl_5foutput_2eproto = nullptr;
 static constexpr const ::_pb::ServiceDescriptor**
@@ -87,6 +150,24 @@ const ::uint32_t TableStruct_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5
     ~0u,  // no _split_
     ~0u,  // no sizeof(Split)
     PROTOBUF_FIELD_OFFSET(::communicator_objects::UnrealRLOutputProto_ListAgentInfoProto, _impl_.value_),
+    ~0u,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(::communicator_objects::UnrealRLOutputProto_PackedAgentInfoProto, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::communicator_objects::UnrealRLOutputProto_PackedAgentInfoProto, _impl_.num_agents_),
+    PROTOBUF_FIELD_OFFSET(::communicator_objects::UnrealRLOutputProto_PackedAgentInfoProto, _impl_.ids_),
+    PROTOBUF_FIELD_OFFSET(::communicator_objects::UnrealRLOutputProto_PackedAgentInfoProto, _impl_.rewards_),
+    PROTOBUF_FIELD_OFFSET(::communicator_objects::UnrealRLOutputProto_PackedAgentInfoProto, _impl_.dones_),
+    PROTOBUF_FIELD_OFFSET(::communicator_objects::UnrealRLOutputProto_PackedAgentInfoProto, _impl_.max_step_reached_),
+    PROTOBUF_FIELD_OFFSET(::communicator_objects::UnrealRLOutputProto_PackedAgentInfoProto, _impl_.group_ids_),
+    PROTOBUF_FIELD_OFFSET(::communicator_objects::UnrealRLOutputProto_PackedAgentInfoProto, _impl_.group_rewards_),
+    PROTOBUF_FIELD_OFFSET(::communicator_objects::UnrealRLOutputProto_PackedAgentInfoProto, _impl_.action_masks_),
+    PROTOBUF_FIELD_OFFSET(::communicator_objects::UnrealRLOutputProto_PackedAgentInfoProto, _impl_.observations_),
+    PROTOBUF_FIELD_OFFSET(::communicator_objects::UnrealRLOutputProto_PackedAgentInfoProto, _impl_.consumed_steps_),
     PROTOBUF_FIELD_OFFSET(::communicator_objects::UnrealRLOutputProto_AgentInfosEntry_DoNotUse, _has_bits_),
     PROTOBUF_FIELD_OFFSET(::communicator_objects::UnrealRLOutputProto_AgentInfosEntry_DoNotUse, _internal_metadata_),
     ~0u,  // no _extensions_
@@ -99,6 +180,18 @@ const ::uint32_t TableStruct_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5
     PROTOBUF_FIELD_OFFSET(::communicator_objects::UnrealRLOutputProto_AgentInfosEntry_DoNotUse, value_),
     0,
     1,
+    PROTOBUF_FIELD_OFFSET(::communicator_objects::UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUse, _has_bits_),
+    PROTOBUF_FIELD_OFFSET(::communicator_objects::UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUse, _internal_metadata_),
+    ~0u,  // no _extensions_
+    ~0u,  // no _oneof_case_
+    ~0u,  // no _weak_field_map_
+    ~0u,  // no _inlined_string_donated_
+    ~0u,  // no _split_
+    ~0u,  // no sizeof(Split)
+    PROTOBUF_FIELD_OFFSET(::communicator_objects::UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUse, key_),
+    PROTOBUF_FIELD_OFFSET(::communicator_objects::UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUse, value_),
+    0,
+    1,
     ~0u,  // no _has_bits_
     PROTOBUF_FIELD_OFFSET(::communicator_objects::UnrealRLOutputProto, _internal_metadata_),
     ~0u,  // no _extensions_
@@ -109,49 +202,68 @@ const ::uint32_t TableStruct_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5
     ~0u,  // no sizeof(Split)
     PROTOBUF_FIELD_OFFSET(::communicator_objects::UnrealRLOutputProto, _impl_.agentinfos_),
     PROTOBUF_FIELD_OFFSET(::communicator_objects::UnrealRLOutputProto, _impl_.side_channel_),
+    PROTOBUF_FIELD_OFFSET(::communicator_objects::UnrealRLOutputProto, _impl_.packedagentinfos_),
 };
 
 static const ::_pbi::MigrationSchema
     schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
         { 0, -1, -1, sizeof(::communicator_objects::UnrealRLOutputProto_ListAgentInfoProto)},
-        { 9, 19, -1, sizeof(::communicator_objects::UnrealRLOutputProto_AgentInfosEntry_DoNotUse)},
-        { 21, -1, -1, sizeof(::communicator_objects::UnrealRLOutputProto)},
+        { 9, -1, -1, sizeof(::communicator_objects::UnrealRLOutputProto_PackedAgentInfoProto)},
+        { 26, 36, -1, sizeof(::communicator_objects::UnrealRLOutputProto_AgentInfosEntry_DoNotUse)},
+        { 38, 48, -1, sizeof(::communicator_objects::UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUse)},
+        { 50, -1, -1, sizeof(::communicator_objects::UnrealRLOutputProto)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
     &::communicator_objects::_UnrealRLOutputProto_ListAgentInfoProto_default_instance_._instance,
+    &::communicator_objects::_UnrealRLOutputProto_PackedAgentInfoProto_default_instance_._instance,
     &::communicator_objects::_UnrealRLOutputProto_AgentInfosEntry_DoNotUse_default_instance_._instance,
+    &::communicator_objects::_UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUse_default_instance_._instance,
     &::communicator_objects::_UnrealRLOutputProto_default_instance_._instance,
 };
 const char descriptor_table_protodef_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5frl_5foutput_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
     "\n9ueagents_envs/communicator_objects/unr"
     "eal_rl_output.proto\022\024communicator_object"
     "s\0323ueagents_envs/communicator_objects/ag"
-    "ent_info.proto\"\266\002\n\023UnrealRLOutputProto\022M"
-    "\n\nagentInfos\030\001 \003(\01329.communicator_object"
-    "s.UnrealRLOutputProto.AgentInfosEntry\022\024\n"
-    "\014side_channel\030\002 \001(\014\032I\n\022ListAgentInfoProt"
-    "o\0223\n\005value\030\001 \003(\0132$.communicator_objects."
-    "AgentInfoProto\032o\n\017AgentInfosEntry\022\013\n\003key"
-    "\030\001 \001(\t\022K\n\005value\030\002 \001(\0132<.communicator_obj"
-    "ects.UnrealRLOutputProto.ListAgentInfoPr"
-    "oto:\0028\001b\006proto3"
+    "ent_info.proto\0324ueagents_envs/communicat"
+    "or_objects/observation.proto\"\224\006\n\023UnrealR"
+    "LOutputProto\022M\n\nagentInfos\030\001 \003(\01329.commu"
+    "nicator_objects.UnrealRLOutputProto.Agen"
+    "tInfosEntry\022\024\n\014side_channel\030\002 \001(\014\022Y\n\020pac"
+    "kedAgentInfos\030\003 \003(\0132\?.communicator_objec"
+    "ts.UnrealRLOutputProto.PackedAgentInfosE"
+    "ntry\032I\n\022ListAgentInfoProto\0223\n\005value\030\001 \003("
+    "\0132$.communicator_objects.AgentInfoProto\032"
+    "\207\002\n\024PackedAgentInfoProto\022\022\n\nnum_agents\030\001"
+    " \001(\005\022\013\n\003ids\030\002 \001(\014\022\017\n\007rewards\030\003 \001(\014\022\r\n\005do"
+    "nes\030\004 \001(\014\022\030\n\020max_step_reached\030\005 \001(\014\022\021\n\tg"
+    "roup_ids\030\006 \001(\014\022\025\n\rgroup_rewards\030\007 \001(\014\022\024\n"
+    "\014action_masks\030\010 \001(\014\022<\n\014observations\030\t \003("
+    "\0132&.communicator_objects.ObservationProt"
+    "o\022\026\n\016consumed_steps\030\n \001(\014\032o\n\017AgentInfosE"
+    "ntry\022\013\n\003key\030\001 \001(\t\022K\n\005value\030\002 \001(\0132<.commu"
+    "nicator_objects.UnrealRLOutputProto.List"
+    "AgentInfoProto:\0028\001\032w\n\025PackedAgentInfosEn"
+    "try\022\013\n\003key\030\001 \001(\t\022M\n\005value\030\002 \001(\0132>.commun"
+    "icator_objects.UnrealRLOutputProto.Packe"
+    "dAgentInfoProto:\0028\001b\006proto3"
 };
-static const ::_pbi::DescriptorTable* const descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5frl_5foutput_2eproto_deps[1] =
+static const ::_pbi::DescriptorTable* const descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5frl_5foutput_2eproto_deps[2] =
     {
         &::descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2fagent_5finfo_2eproto,
+        &::descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2fobservation_2eproto,
 };
 static ::absl::once_flag descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5frl_5foutput_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5frl_5foutput_2eproto = {
     false,
     false,
-    455,
+    987,
     descriptor_table_protodef_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5frl_5foutput_2eproto,
     "ueagents_envs/communicator_objects/unreal_rl_output.proto",
     &descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5frl_5foutput_2eproto_once,
     descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5frl_5foutput_2eproto_deps,
-    1,
-    3,
+    2,
+    5,
     schemas,
     file_default_instances,
     TableStruct_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5frl_5foutput_2eproto::offsets,
@@ -365,6 +477,578 @@ void UnrealRLOutputProto_ListAgentInfoProto::InternalSwap(UnrealRLOutputProto_Li
 }
 // ===================================================================
 
+class UnrealRLOutputProto_PackedAgentInfoProto::_Internal {
+ public:
+};
+
+void UnrealRLOutputProto_PackedAgentInfoProto::clear_observations() {
+  _internal_mutable_observations()->Clear();
+}
+UnrealRLOutputProto_PackedAgentInfoProto::UnrealRLOutputProto_PackedAgentInfoProto(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto)
+}
+UnrealRLOutputProto_PackedAgentInfoProto::UnrealRLOutputProto_PackedAgentInfoProto(const UnrealRLOutputProto_PackedAgentInfoProto& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UnrealRLOutputProto_PackedAgentInfoProto* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.observations_){from._impl_.observations_}
+    , decltype(_impl_.ids_) {}
+
+    , decltype(_impl_.rewards_) {}
+
+    , decltype(_impl_.dones_) {}
+
+    , decltype(_impl_.max_step_reached_) {}
+
+    , decltype(_impl_.group_ids_) {}
+
+    , decltype(_impl_.group_rewards_) {}
+
+    , decltype(_impl_.action_masks_) {}
+
+    , decltype(_impl_.consumed_steps_) {}
+
+    , decltype(_impl_.num_agents_) {}
+
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.ids_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        _impl_.ids_.Set("", GetArenaForAllocation());
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_ids().empty()) {
+    _this->_impl_.ids_.Set(from._internal_ids(), _this->GetArenaForAllocation());
+  }
+  _impl_.rewards_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        _impl_.rewards_.Set("", GetArenaForAllocation());
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_rewards().empty()) {
+    _this->_impl_.rewards_.Set(from._internal_rewards(), _this->GetArenaForAllocation());
+  }
+  _impl_.dones_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        _impl_.dones_.Set("", GetArenaForAllocation());
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_dones().empty()) {
+    _this->_impl_.dones_.Set(from._internal_dones(), _this->GetArenaForAllocation());
+  }
+  _impl_.max_step_reached_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        _impl_.max_step_reached_.Set("", GetArenaForAllocation());
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_max_step_reached().empty()) {
+    _this->_impl_.max_step_reached_.Set(from._internal_max_step_reached(), _this->GetArenaForAllocation());
+  }
+  _impl_.group_ids_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        _impl_.group_ids_.Set("", GetArenaForAllocation());
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_group_ids().empty()) {
+    _this->_impl_.group_ids_.Set(from._internal_group_ids(), _this->GetArenaForAllocation());
+  }
+  _impl_.group_rewards_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        _impl_.group_rewards_.Set("", GetArenaForAllocation());
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_group_rewards().empty()) {
+    _this->_impl_.group_rewards_.Set(from._internal_group_rewards(), _this->GetArenaForAllocation());
+  }
+  _impl_.action_masks_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        _impl_.action_masks_.Set("", GetArenaForAllocation());
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_action_masks().empty()) {
+    _this->_impl_.action_masks_.Set(from._internal_action_masks(), _this->GetArenaForAllocation());
+  }
+  _impl_.consumed_steps_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        _impl_.consumed_steps_.Set("", GetArenaForAllocation());
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_consumed_steps().empty()) {
+    _this->_impl_.consumed_steps_.Set(from._internal_consumed_steps(), _this->GetArenaForAllocation());
+  }
+  _this->_impl_.num_agents_ = from._impl_.num_agents_;
+  // @@protoc_insertion_point(copy_constructor:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto)
+}
+
+inline void UnrealRLOutputProto_PackedAgentInfoProto::SharedCtor(::_pb::Arena* arena) {
+  (void)arena;
+  new (&_impl_) Impl_{
+      decltype(_impl_.observations_){arena}
+    , decltype(_impl_.ids_) {}
+
+    , decltype(_impl_.rewards_) {}
+
+    , decltype(_impl_.dones_) {}
+
+    , decltype(_impl_.max_step_reached_) {}
+
+    , decltype(_impl_.group_ids_) {}
+
+    , decltype(_impl_.group_rewards_) {}
+
+    , decltype(_impl_.action_masks_) {}
+
+    , decltype(_impl_.consumed_steps_) {}
+
+    , decltype(_impl_.num_agents_) { 0 }
+
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.ids_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        _impl_.ids_.Set("", GetArenaForAllocation());
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.rewards_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        _impl_.rewards_.Set("", GetArenaForAllocation());
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.dones_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        _impl_.dones_.Set("", GetArenaForAllocation());
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.max_step_reached_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        _impl_.max_step_reached_.Set("", GetArenaForAllocation());
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.group_ids_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        _impl_.group_ids_.Set("", GetArenaForAllocation());
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.group_rewards_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        _impl_.group_rewards_.Set("", GetArenaForAllocation());
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.action_masks_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        _impl_.action_masks_.Set("", GetArenaForAllocation());
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.consumed_steps_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        _impl_.consumed_steps_.Set("", GetArenaForAllocation());
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+UnrealRLOutputProto_PackedAgentInfoProto::~UnrealRLOutputProto_PackedAgentInfoProto() {
+  // @@protoc_insertion_point(destructor:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void UnrealRLOutputProto_PackedAgentInfoProto::SharedDtor() {
+  ABSL_DCHECK(GetArenaForAllocation() == nullptr);
+  _internal_mutable_observations()->~RepeatedPtrField();
+  _impl_.ids_.Destroy();
+  _impl_.rewards_.Destroy();
+  _impl_.dones_.Destroy();
+  _impl_.max_step_reached_.Destroy();
+  _impl_.group_ids_.Destroy();
+  _impl_.group_rewards_.Destroy();
+  _impl_.action_masks_.Destroy();
+  _impl_.consumed_steps_.Destroy();
+}
+
+void UnrealRLOutputProto_PackedAgentInfoProto::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void UnrealRLOutputProto_PackedAgentInfoProto::Clear() {
+// @@protoc_insertion_point(message_clear_start:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto)
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _internal_mutable_observations()->Clear();
+  _impl_.ids_.ClearToEmpty();
+  _impl_.rewards_.ClearToEmpty();
+  _impl_.dones_.ClearToEmpty();
+  _impl_.max_step_reached_.ClearToEmpty();
+  _impl_.group_ids_.ClearToEmpty();
+  _impl_.group_rewards_.ClearToEmpty();
+  _impl_.action_masks_.ClearToEmpty();
+  _impl_.consumed_steps_.ClearToEmpty();
+  _impl_.num_agents_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UnrealRLOutputProto_PackedAgentInfoProto::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 num_agents = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 8)) {
+          _impl_.num_agents_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else {
+          goto handle_unusual;
+        }
+        continue;
+      // bytes ids = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_ids();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else {
+          goto handle_unusual;
+        }
+        continue;
+      // bytes rewards = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_rewards();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else {
+          goto handle_unusual;
+        }
+        continue;
+      // bytes dones = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_dones();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else {
+          goto handle_unusual;
+        }
+        continue;
+      // bytes max_step_reached = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_max_step_reached();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else {
+          goto handle_unusual;
+        }
+        continue;
+      // bytes group_ids = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_group_ids();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else {
+          goto handle_unusual;
+        }
+        continue;
+      // bytes group_rewards = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_group_rewards();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else {
+          goto handle_unusual;
+        }
+        continue;
+      // bytes action_masks = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 66)) {
+          auto str = _internal_mutable_action_masks();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else {
+          goto handle_unusual;
+        }
+        continue;
+      // repeated .communicator_objects.ObservationProto observations = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 74)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_observations(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<74>(ptr));
+        } else {
+          goto handle_unusual;
+        }
+        continue;
+      // bytes consumed_steps = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 82)) {
+          auto str = _internal_mutable_consumed_steps();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else {
+          goto handle_unusual;
+        }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+::uint8_t* UnrealRLOutputProto_PackedAgentInfoProto::_InternalSerialize(
+    ::uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto)
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 num_agents = 1;
+  if (this->_internal_num_agents() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(
+        1, this->_internal_num_agents(), target);
+  }
+
+  // bytes ids = 2;
+  if (!this->_internal_ids().empty()) {
+    const std::string& _s = this->_internal_ids();
+    target = stream->WriteBytesMaybeAliased(2, _s, target);
+  }
+
+  // bytes rewards = 3;
+  if (!this->_internal_rewards().empty()) {
+    const std::string& _s = this->_internal_rewards();
+    target = stream->WriteBytesMaybeAliased(3, _s, target);
+  }
+
+  // bytes dones = 4;
+  if (!this->_internal_dones().empty()) {
+    const std::string& _s = this->_internal_dones();
+    target = stream->WriteBytesMaybeAliased(4, _s, target);
+  }
+
+  // bytes max_step_reached = 5;
+  if (!this->_internal_max_step_reached().empty()) {
+    const std::string& _s = this->_internal_max_step_reached();
+    target = stream->WriteBytesMaybeAliased(5, _s, target);
+  }
+
+  // bytes group_ids = 6;
+  if (!this->_internal_group_ids().empty()) {
+    const std::string& _s = this->_internal_group_ids();
+    target = stream->WriteBytesMaybeAliased(6, _s, target);
+  }
+
+  // bytes group_rewards = 7;
+  if (!this->_internal_group_rewards().empty()) {
+    const std::string& _s = this->_internal_group_rewards();
+    target = stream->WriteBytesMaybeAliased(7, _s, target);
+  }
+
+  // bytes action_masks = 8;
+  if (!this->_internal_action_masks().empty()) {
+    const std::string& _s = this->_internal_action_masks();
+    target = stream->WriteBytesMaybeAliased(8, _s, target);
+  }
+
+  // repeated .communicator_objects.ObservationProto observations = 9;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_observations_size()); i < n; i++) {
+    const auto& repfield = this->_internal_observations(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(9, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // bytes consumed_steps = 10;
+  if (!this->_internal_consumed_steps().empty()) {
+    const std::string& _s = this->_internal_consumed_steps();
+    target = stream->WriteBytesMaybeAliased(10, _s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto)
+  return target;
+}
+
+::size_t UnrealRLOutputProto_PackedAgentInfoProto::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .communicator_objects.ObservationProto observations = 9;
+  total_size += 1UL * this->_internal_observations_size();
+  for (const auto& msg : this->_internal_observations()) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // bytes ids = 2;
+  if (!this->_internal_ids().empty()) {
+    total_size += 1 + ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+                                    this->_internal_ids());
+  }
+
+  // bytes rewards = 3;
+  if (!this->_internal_rewards().empty()) {
+    total_size += 1 + ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+                                    this->_internal_rewards());
+  }
+
+  // bytes dones = 4;
+  if (!this->_internal_dones().empty()) {
+    total_size += 1 + ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+                                    this->_internal_dones());
+  }
+
+  // bytes max_step_reached = 5;
+  if (!this->_internal_max_step_reached().empty()) {
+    total_size += 1 + ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+                                    this->_internal_max_step_reached());
+  }
+
+  // bytes group_ids = 6;
+  if (!this->_internal_group_ids().empty()) {
+    total_size += 1 + ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+                                    this->_internal_group_ids());
+  }
+
+  // bytes group_rewards = 7;
+  if (!this->_internal_group_rewards().empty()) {
+    total_size += 1 + ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+                                    this->_internal_group_rewards());
+  }
+
+  // bytes action_masks = 8;
+  if (!this->_internal_action_masks().empty()) {
+    total_size += 1 + ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+                                    this->_internal_action_masks());
+  }
+
+  // bytes consumed_steps = 10;
+  if (!this->_internal_consumed_steps().empty()) {
+    total_size += 1 + ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+                                    this->_internal_consumed_steps());
+  }
+
+  // int32 num_agents = 1;
+  if (this->_internal_num_agents() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+        this->_internal_num_agents());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UnrealRLOutputProto_PackedAgentInfoProto::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UnrealRLOutputProto_PackedAgentInfoProto::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UnrealRLOutputProto_PackedAgentInfoProto::GetClassData() const { return &_class_data_; }
+
+
+void UnrealRLOutputProto_PackedAgentInfoProto::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UnrealRLOutputProto_PackedAgentInfoProto*>(&to_msg);
+  auto& from = static_cast<const UnrealRLOutputProto_PackedAgentInfoProto&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_internal_mutable_observations()->MergeFrom(from._internal_observations());
+  if (!from._internal_ids().empty()) {
+    _this->_internal_set_ids(from._internal_ids());
+  }
+  if (!from._internal_rewards().empty()) {
+    _this->_internal_set_rewards(from._internal_rewards());
+  }
+  if (!from._internal_dones().empty()) {
+    _this->_internal_set_dones(from._internal_dones());
+  }
+  if (!from._internal_max_step_reached().empty()) {
+    _this->_internal_set_max_step_reached(from._internal_max_step_reached());
+  }
+  if (!from._internal_group_ids().empty()) {
+    _this->_internal_set_group_ids(from._internal_group_ids());
+  }
+  if (!from._internal_group_rewards().empty()) {
+    _this->_internal_set_group_rewards(from._internal_group_rewards());
+  }
+  if (!from._internal_action_masks().empty()) {
+    _this->_internal_set_action_masks(from._internal_action_masks());
+  }
+  if (!from._internal_consumed_steps().empty()) {
+    _this->_internal_set_consumed_steps(from._internal_consumed_steps());
+  }
+  if (from._internal_num_agents() != 0) {
+    _this->_internal_set_num_agents(from._internal_num_agents());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void UnrealRLOutputProto_PackedAgentInfoProto::CopyFrom(const UnrealRLOutputProto_PackedAgentInfoProto& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool UnrealRLOutputProto_PackedAgentInfoProto::IsInitialized() const {
+  return true;
+}
+
+void UnrealRLOutputProto_PackedAgentInfoProto::InternalSwap(UnrealRLOutputProto_PackedAgentInfoProto* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _internal_mutable_observations()->InternalSwap(other->_internal_mutable_observations());
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.ids_, lhs_arena,
+                                       &other->_impl_.ids_, rhs_arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.rewards_, lhs_arena,
+                                       &other->_impl_.rewards_, rhs_arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.dones_, lhs_arena,
+                                       &other->_impl_.dones_, rhs_arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.max_step_reached_, lhs_arena,
+                                       &other->_impl_.max_step_reached_, rhs_arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.group_ids_, lhs_arena,
+                                       &other->_impl_.group_ids_, rhs_arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.group_rewards_, lhs_arena,
+                                       &other->_impl_.group_rewards_, rhs_arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.action_masks_, lhs_arena,
+                                       &other->_impl_.action_masks_, rhs_arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.consumed_steps_, lhs_arena,
+                                       &other->_impl_.consumed_steps_, rhs_arena);
+
+  swap(_impl_.num_agents_, other->_impl_.num_agents_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata UnrealRLOutputProto_PackedAgentInfoProto::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5frl_5foutput_2eproto_getter, &descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5frl_5foutput_2eproto_once,
+      file_level_metadata_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5frl_5foutput_2eproto[1]);
+}
+// ===================================================================
+
 UnrealRLOutputProto_AgentInfosEntry_DoNotUse::UnrealRLOutputProto_AgentInfosEntry_DoNotUse() {}
 UnrealRLOutputProto_AgentInfosEntry_DoNotUse::UnrealRLOutputProto_AgentInfosEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
     : SuperType(arena) {}
@@ -374,7 +1058,20 @@ void UnrealRLOutputProto_AgentInfosEntry_DoNotUse::MergeFrom(const UnrealRLOutpu
 ::PROTOBUF_NAMESPACE_ID::Metadata UnrealRLOutputProto_AgentInfosEntry_DoNotUse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5frl_5foutput_2eproto_getter, &descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5frl_5foutput_2eproto_once,
-      file_level_metadata_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5frl_5foutput_2eproto[1]);
+      file_level_metadata_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5frl_5foutput_2eproto[2]);
+}
+// ===================================================================
+
+UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUse::UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUse() {}
+UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUse::UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUse::MergeFrom(const UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5frl_5foutput_2eproto_getter, &descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5frl_5foutput_2eproto_once,
+      file_level_metadata_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5frl_5foutput_2eproto[3]);
 }
 // ===================================================================
 
@@ -392,12 +1089,14 @@ UnrealRLOutputProto::UnrealRLOutputProto(const UnrealRLOutputProto& from)
   UnrealRLOutputProto* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       /*decltype(_impl_.agentinfos_)*/{}
+    , /*decltype(_impl_.packedagentinfos_)*/{}
     , decltype(_impl_.side_channel_) {}
 
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _this->_impl_.agentinfos_.MergeFrom(from._impl_.agentinfos_);
+  _this->_impl_.packedagentinfos_.MergeFrom(from._impl_.packedagentinfos_);
   _impl_.side_channel_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
         _impl_.side_channel_.Set("", GetArenaForAllocation());
@@ -412,6 +1111,7 @@ inline void UnrealRLOutputProto::SharedCtor(::_pb::Arena* arena) {
   (void)arena;
   new (&_impl_) Impl_{
       /*decltype(_impl_.agentinfos_)*/{::_pbi::ArenaInitialized(), arena}
+    , /*decltype(_impl_.packedagentinfos_)*/{::_pbi::ArenaInitialized(), arena}
     , decltype(_impl_.side_channel_) {}
 
     , /*decltype(_impl_._cached_size_)*/{}
@@ -434,6 +1134,7 @@ UnrealRLOutputProto::~UnrealRLOutputProto() {
 inline void UnrealRLOutputProto::SharedDtor() {
   ABSL_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.agentinfos_.~MapField();
+  _impl_.packedagentinfos_.~MapField();
   _impl_.side_channel_.Destroy();
 }
 
@@ -448,6 +1149,7 @@ void UnrealRLOutputProto::Clear() {
   (void) cached_has_bits;
 
   _impl_.agentinfos_.Clear();
+  _impl_.packedagentinfos_.Clear();
   _impl_.side_channel_.ClearToEmpty();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
@@ -482,6 +1184,20 @@ const char* UnrealRLOutputProto::_InternalParse(const char* ptr, ::_pbi::ParseCo
           goto handle_unusual;
         }
         continue;
+      // map<string, .communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto> packedAgentInfos = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.packedagentinfos_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else {
+          goto handle_unusual;
+        }
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -542,6 +1258,31 @@ failure:
     target = stream->WriteBytesMaybeAliased(2, _s, target);
   }
 
+  // map<string, .communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto> packedAgentInfos = 3;
+  if (!this->_internal_packedagentinfos().empty()) {
+    using MapType = ::_pb::Map<std::string, ::communicator_objects::UnrealRLOutputProto_PackedAgentInfoProto>;
+    using WireHelper = UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_packedagentinfos();
+    auto check_utf8 = [](const MapType::value_type& entry) {
+      (void)entry;
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+          entry.first.data(), static_cast<int>(entry.first.length()),
+ ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE, "communicator_objects.UnrealRLOutputProto.packedAgentInfos");
+    };
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(3, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(3, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    }
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -567,6 +1308,15 @@ failure:
     total_size += UnrealRLOutputProto_AgentInfosEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
   }
 
+  // map<string, .communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto> packedAgentInfos = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_packedagentinfos_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::communicator_objects::UnrealRLOutputProto_PackedAgentInfoProto >::const_iterator
+      it = this->_internal_packedagentinfos().begin();
+      it != this->_internal_packedagentinfos().end(); ++it) {
+    total_size += UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
   // bytes side_channel = 2;
   if (!this->_internal_side_channel().empty()) {
     total_size += 1 + ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
@@ -592,6 +1342,7 @@ void UnrealRLOutputProto::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, co
   (void) cached_has_bits;
 
   _this->_impl_.agentinfos_.MergeFrom(from._impl_.agentinfos_);
+  _this->_impl_.packedagentinfos_.MergeFrom(from._impl_.packedagentinfos_);
   if (!from._internal_side_channel().empty()) {
     _this->_internal_set_side_channel(from._internal_side_channel());
   }
@@ -615,6 +1366,7 @@ void UnrealRLOutputProto::InternalSwap(UnrealRLOutputProto* other) {
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   _impl_.agentinfos_.InternalSwap(&other->_impl_.agentinfos_);
+  _impl_.packedagentinfos_.InternalSwap(&other->_impl_.packedagentinfos_);
   ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.side_channel_, lhs_arena,
                                        &other->_impl_.side_channel_, rhs_arena);
 }
@@ -622,7 +1374,7 @@ void UnrealRLOutputProto::InternalSwap(UnrealRLOutputProto* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata UnrealRLOutputProto::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5frl_5foutput_2eproto_getter, &descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5frl_5foutput_2eproto_once,
-      file_level_metadata_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5frl_5foutput_2eproto[2]);
+      file_level_metadata_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5frl_5foutput_2eproto[4]);
 }
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace communicator_objects
@@ -631,10 +1383,18 @@ template<> PROTOBUF_NOINLINE ::communicator_objects::UnrealRLOutputProto_ListAge
 Arena::CreateMaybeMessage< ::communicator_objects::UnrealRLOutputProto_ListAgentInfoProto >(Arena* arena) {
   return Arena::CreateMessageInternal< ::communicator_objects::UnrealRLOutputProto_ListAgentInfoProto >(arena);
 }
+template<> PROTOBUF_NOINLINE ::communicator_objects::UnrealRLOutputProto_PackedAgentInfoProto*
+Arena::CreateMaybeMessage< ::communicator_objects::UnrealRLOutputProto_PackedAgentInfoProto >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::communicator_objects::UnrealRLOutputProto_PackedAgentInfoProto >(arena);
+}
 template<> PROTOBUF_NOINLINE ::communicator_objects::UnrealRLOutputProto_AgentInfosEntry_DoNotUse*
 Arena::CreateMaybeMessage< ::communicator_objects::UnrealRLOutputProto_AgentInfosEntry_DoNotUse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::communicator_objects::UnrealRLOutputProto_AgentInfosEntry_DoNotUse >(arena);
 }
+template<> PROTOBUF_NOINLINE ::communicator_objects::UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::communicator_objects::UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::communicator_objects::UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUse >(arena);
+}
 template<> PROTOBUF_NOINLINE ::communicator_objects::UnrealRLOutputProto*
 Arena::CreateMaybeMessage< ::communicator_objects::UnrealRLOutputProto >(Arena* arena) {
   return Arena::CreateMessageInternal< ::communicator_objects::UnrealRLOutputProto >(arena);
@@ -37,6 +37,7 @@
 #include "google/protobuf/map_field_inl.h"
 #include "google/protobuf/unknown_field_set.h"
 #include "ueagents_envs/communicator_objects/agent_info.pb.h"
+#include "ueagents_envs/communicator_objects/observation.pb.h"
 // @@protoc_insertion_point(includes)
 
 // Must be included last.
@@ -66,6 +67,12 @@ extern UnrealRLOutputProto_AgentInfosEntry_DoNotUseDefaultTypeInternal _UnrealRL
 class UnrealRLOutputProto_ListAgentInfoProto;
 struct UnrealRLOutputProto_ListAgentInfoProtoDefaultTypeInternal;
 extern UnrealRLOutputProto_ListAgentInfoProtoDefaultTypeInternal _UnrealRLOutputProto_ListAgentInfoProto_default_instance_;
+class UnrealRLOutputProto_PackedAgentInfoProto;
+struct UnrealRLOutputProto_PackedAgentInfoProtoDefaultTypeInternal;
+extern UnrealRLOutputProto_PackedAgentInfoProtoDefaultTypeInternal _UnrealRLOutputProto_PackedAgentInfoProto_default_instance_;
+class UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUse;
+struct UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUseDefaultTypeInternal;
+extern UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUseDefaultTypeInternal _UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUse_default_instance_;
 }  // namespace communicator_objects
 PROTOBUF_NAMESPACE_OPEN
 template <>
@@ -74,6 +81,10 @@ template <>
 ::communicator_objects::UnrealRLOutputProto_AgentInfosEntry_DoNotUse* Arena::CreateMaybeMessage<::communicator_objects::UnrealRLOutputProto_AgentInfosEntry_DoNotUse>(Arena*);
 template <>
 ::communicator_objects::UnrealRLOutputProto_ListAgentInfoProto* Arena::CreateMaybeMessage<::communicator_objects::UnrealRLOutputProto_ListAgentInfoProto>(Arena*);
+template <>
+::communicator_objects::UnrealRLOutputProto_PackedAgentInfoProto* Arena::CreateMaybeMessage<::communicator_objects::UnrealRLOutputProto_PackedAgentInfoProto>(Arena*);
+template <>
+::communicator_objects::UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUse* Arena::CreateMaybeMessage<::communicator_objects::UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUse>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 
 namespace communicator_objects {
@@ -248,6 +259,359 @@ class UnrealRLOutputProto_ListAgentInfoProto final :
   friend struct ::TableStruct_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5frl_5foutput_2eproto;
 };// -------------------------------------------------------------------
 
+class UnrealRLOutputProto_PackedAgentInfoProto final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto) */ {
+ public:
+  inline UnrealRLOutputProto_PackedAgentInfoProto() : UnrealRLOutputProto_PackedAgentInfoProto(nullptr) {}
+  ~UnrealRLOutputProto_PackedAgentInfoProto() override;
+  template<typename = void>
+  explicit PROTOBUF_CONSTEXPR UnrealRLOutputProto_PackedAgentInfoProto(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UnrealRLOutputProto_PackedAgentInfoProto(const UnrealRLOutputProto_PackedAgentInfoProto& from);
+  UnrealRLOutputProto_PackedAgentInfoProto(UnrealRLOutputProto_PackedAgentInfoProto&& from) noexcept
+    : UnrealRLOutputProto_PackedAgentInfoProto() {
+    *this = ::std::move(from);
+  }
+
+  inline UnrealRLOutputProto_PackedAgentInfoProto& operator=(const UnrealRLOutputProto_PackedAgentInfoProto& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UnrealRLOutputProto_PackedAgentInfoProto& operator=(UnrealRLOutputProto_PackedAgentInfoProto&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UnrealRLOutputProto_PackedAgentInfoProto& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UnrealRLOutputProto_PackedAgentInfoProto* internal_default_instance() {
+    return reinterpret_cast<const UnrealRLOutputProto_PackedAgentInfoProto*>(
+               &_UnrealRLOutputProto_PackedAgentInfoProto_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(UnrealRLOutputProto_PackedAgentInfoProto& a, UnrealRLOutputProto_PackedAgentInfoProto& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UnrealRLOutputProto_PackedAgentInfoProto* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UnrealRLOutputProto_PackedAgentInfoProto* other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UnrealRLOutputProto_PackedAgentInfoProto* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UnrealRLOutputProto_PackedAgentInfoProto>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UnrealRLOutputProto_PackedAgentInfoProto& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UnrealRLOutputProto_PackedAgentInfoProto& from) {
+    UnrealRLOutputProto_PackedAgentInfoProto::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  ::size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::uint8_t* _InternalSerialize(
+      ::uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UnrealRLOutputProto_PackedAgentInfoProto* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::absl::string_view FullMessageName() {
+    return "communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto";
+  }
+  protected:
+  explicit UnrealRLOutputProto_PackedAgentInfoProto(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kObservationsFieldNumber = 9,
+    kIdsFieldNumber = 2,
+    kRewardsFieldNumber = 3,
+    kDonesFieldNumber = 4,
+    kMaxStepReachedFieldNumber = 5,
+    kGroupIdsFieldNumber = 6,
+    kGroupRewardsFieldNumber = 7,
+    kActionMasksFieldNumber = 8,
+    kConsumedStepsFieldNumber = 10,
+    kNumAgentsFieldNumber = 1,
+  };
+  // repeated .communicator_objects.ObservationProto observations = 9;
+  int observations_size() const;
+  private:
+  int _internal_observations_size() const;
+
+  public:
+  void clear_observations() ;
+  ::communicator_objects::ObservationProto* mutable_observations(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::communicator_objects::ObservationProto >*
+      mutable_observations();
+  private:
+  const ::communicator_objects::ObservationProto& _internal_observations(int index) const;
+  ::communicator_objects::ObservationProto* _internal_add_observations();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<::communicator_objects::ObservationProto>& _internal_observations() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<::communicator_objects::ObservationProto>* _internal_mutable_observations();
+  public:
+  const ::communicator_objects::ObservationProto& observations(int index) const;
+  ::communicator_objects::ObservationProto* add_observations();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::communicator_objects::ObservationProto >&
+      observations() const;
+  // bytes ids = 2;
+  void clear_ids() ;
+  const std::string& ids() const;
+
+
+
+
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_ids(Arg_&& arg, Args_... args);
+  std::string* mutable_ids();
+  PROTOBUF_NODISCARD std::string* release_ids();
+  void set_allocated_ids(std::string* ptr);
+
+  private:
+  const std::string& _internal_ids() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ids(
+      const std::string& value);
+  std::string* _internal_mutable_ids();
+
+  public:
+  // bytes rewards = 3;
+  void clear_rewards() ;
+  const std::string& rewards() const;
+
+
+
+
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_rewards(Arg_&& arg, Args_... args);
+  std::string* mutable_rewards();
+  PROTOBUF_NODISCARD std::string* release_rewards();
+  void set_allocated_rewards(std::string* ptr);
+
+  private:
+  const std::string& _internal_rewards() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_rewards(
+      const std::string& value);
+  std::string* _internal_mutable_rewards();
+
+  public:
+  // bytes dones = 4;
+  void clear_dones() ;
+  const std::string& dones() const;
+
+
+
+
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_dones(Arg_&& arg, Args_... args);
+  std::string* mutable_dones();
+  PROTOBUF_NODISCARD std::string* release_dones();
+  void set_allocated_dones(std::string* ptr);
+
+  private:
+  const std::string& _internal_dones() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_dones(
+      const std::string& value);
+  std::string* _internal_mutable_dones();
+
+  public:
+  // bytes max_step_reached = 5;
+  void clear_max_step_reached() ;
+  const std::string& max_step_reached() const;
+
+
+
+
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_max_step_reached(Arg_&& arg, Args_... args);
+  std::string* mutable_max_step_reached();
+  PROTOBUF_NODISCARD std::string* release_max_step_reached();
+  void set_allocated_max_step_reached(std::string* ptr);
+
+  private:
+  const std::string& _internal_max_step_reached() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_max_step_reached(
+      const std::string& value);
+  std::string* _internal_mutable_max_step_reached();
+
+  public:
+  // bytes group_ids = 6;
+  void clear_group_ids() ;
+  const std::string& group_ids() const;
+
+
+
+
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_group_ids(Arg_&& arg, Args_... args);
+  std::string* mutable_group_ids();
+  PROTOBUF_NODISCARD std::string* release_group_ids();
+  void set_allocated_group_ids(std::string* ptr);
+
+  private:
+  const std::string& _internal_group_ids() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_group_ids(
+      const std::string& value);
+  std::string* _internal_mutable_group_ids();
+
+  public:
+  // bytes group_rewards = 7;
+  void clear_group_rewards() ;
+  const std::string& group_rewards() const;
+
+
+
+
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_group_rewards(Arg_&& arg, Args_... args);
+  std::string* mutable_group_rewards();
+  PROTOBUF_NODISCARD std::string* release_group_rewards();
+  void set_allocated_group_rewards(std::string* ptr);
+
+  private:
+  const std::string& _internal_group_rewards() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_group_rewards(
+      const std::string& value);
+  std::string* _internal_mutable_group_rewards();
+
+  public:
+  // bytes action_masks = 8;
+  void clear_action_masks() ;
+  const std::string& action_masks() const;
+
+
+
+
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_action_masks(Arg_&& arg, Args_... args);
+  std::string* mutable_action_masks();
+  PROTOBUF_NODISCARD std::string* release_action_masks();
+  void set_allocated_action_masks(std::string* ptr);
+
+  private:
+  const std::string& _internal_action_masks() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_action_masks(
+      const std::string& value);
+  std::string* _internal_mutable_action_masks();
+
+  public:
+  // bytes consumed_steps = 10;
+  void clear_consumed_steps() ;
+  const std::string& consumed_steps() const;
+
+
+
+
+  template <typename Arg_ = const std::string&, typename... Args_>
+  void set_consumed_steps(Arg_&& arg, Args_... args);
+  std::string* mutable_consumed_steps();
+  PROTOBUF_NODISCARD std::string* release_consumed_steps();
+  void set_allocated_consumed_steps(std::string* ptr);
+
+  private:
+  const std::string& _internal_consumed_steps() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_consumed_steps(
+      const std::string& value);
+  std::string* _internal_mutable_consumed_steps();
+
+  public:
+  // int32 num_agents = 1;
+  void clear_num_agents() ;
+  ::int32_t num_agents() const;
+  void set_num_agents(::int32_t value);
+
+  private:
+  ::int32_t _internal_num_agents() const;
+  void _internal_set_num_agents(::int32_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::communicator_objects::ObservationProto > observations_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ids_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rewards_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr dones_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr max_step_reached_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr group_ids_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr group_rewards_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr action_masks_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr consumed_steps_;
+    ::int32_t num_agents_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5frl_5foutput_2eproto;
+};// -------------------------------------------------------------------
+
 class UnrealRLOutputProto_AgentInfosEntry_DoNotUse final : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<UnrealRLOutputProto_AgentInfosEntry_DoNotUse,
     std::string, ::communicator_objects::UnrealRLOutputProto_ListAgentInfoProto,
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
@@ -274,6 +638,32 @@ public:
 };
 // -------------------------------------------------------------------
 
+class UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUse final : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUse,
+    std::string, ::communicator_objects::UnrealRLOutputProto_PackedAgentInfoProto,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUse,
+    std::string, ::communicator_objects::UnrealRLOutputProto_PackedAgentInfoProto,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> SuperType;
+  UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUse();
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUse& other);
+  static const UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUse*>(&_UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "communicator_objects.UnrealRLOutputProto.PackedAgentInfosEntry.key");
+ }
+  static bool ValidateValue(void*) { return true; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5frl_5foutput_2eproto;
+};
+// -------------------------------------------------------------------
+
 class UnrealRLOutputProto final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:communicator_objects.UnrealRLOutputProto) */ {
  public:
@@ -330,7 +720,7 @@ class UnrealRLOutputProto final :
                &_UnrealRLOutputProto_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    2;
+    4;
 
   friend void swap(UnrealRLOutputProto& a, UnrealRLOutputProto& b) {
     a.Swap(&b);
@@ -400,11 +790,13 @@ class UnrealRLOutputProto final :
   // nested types ----------------------------------------------------
 
   typedef UnrealRLOutputProto_ListAgentInfoProto ListAgentInfoProto;
+  typedef UnrealRLOutputProto_PackedAgentInfoProto PackedAgentInfoProto;
 
   // accessors -------------------------------------------------------
 
   enum : int {
     kAgentInfosFieldNumber = 1,
+    kPackedAgentInfosFieldNumber = 3,
     kSideChannelFieldNumber = 2,
   };
   // map<string, .communicator_objects.UnrealRLOutputProto.ListAgentInfoProto> agentInfos = 1;
@@ -424,6 +816,23 @@ class UnrealRLOutputProto final :
       agentinfos() const;
   ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::communicator_objects::UnrealRLOutputProto_ListAgentInfoProto >*
       mutable_agentinfos();
+  // map<string, .communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto> packedAgentInfos = 3;
+  int packedagentinfos_size() const;
+  private:
+  int _internal_packedagentinfos_size() const;
+
+  public:
+  void clear_packedagentinfos() ;
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::communicator_objects::UnrealRLOutputProto_PackedAgentInfoProto >&
+      _internal_packedagentinfos() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::communicator_objects::UnrealRLOutputProto_PackedAgentInfoProto >*
+      _internal_mutable_packedagentinfos();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::communicator_objects::UnrealRLOutputProto_PackedAgentInfoProto >&
+      packedagentinfos() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::communicator_objects::UnrealRLOutputProto_PackedAgentInfoProto >*
+      mutable_packedagentinfos();
   // bytes side_channel = 2;
   void clear_side_channel() ;
   const std::string& side_channel() const;
@@ -457,6 +866,11 @@ class UnrealRLOutputProto final :
         std::string, ::communicator_objects::UnrealRLOutputProto_ListAgentInfoProto,
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> agentinfos_;
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        UnrealRLOutputProto_PackedAgentInfosEntry_DoNotUse,
+        std::string, ::communicator_objects::UnrealRLOutputProto_PackedAgentInfoProto,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> packedagentinfos_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr side_channel_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
@@ -527,6 +941,453 @@ UnrealRLOutputProto_ListAgentInfoProto::_internal_mutable_value() {
 
 // -------------------------------------------------------------------
 
+// UnrealRLOutputProto_PackedAgentInfoProto
+
+// int32 num_agents = 1;
+inline void UnrealRLOutputProto_PackedAgentInfoProto::clear_num_agents() {
+  _impl_.num_agents_ = 0;
+}
+inline ::int32_t UnrealRLOutputProto_PackedAgentInfoProto::num_agents() const {
+  // @@protoc_insertion_point(field_get:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.num_agents)
+  return _internal_num_agents();
+}
+inline void UnrealRLOutputProto_PackedAgentInfoProto::set_num_agents(::int32_t value) {
+  _internal_set_num_agents(value);
+  // @@protoc_insertion_point(field_set:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.num_agents)
+}
+inline ::int32_t UnrealRLOutputProto_PackedAgentInfoProto::_internal_num_agents() const {
+  return _impl_.num_agents_;
+}
+inline void UnrealRLOutputProto_PackedAgentInfoProto::_internal_set_num_agents(::int32_t value) {
+  ;
+  _impl_.num_agents_ = value;
+}
+
+// bytes ids = 2;
+inline void UnrealRLOutputProto_PackedAgentInfoProto::clear_ids() {
+  _impl_.ids_.ClearToEmpty();
+}
+inline const std::string& UnrealRLOutputProto_PackedAgentInfoProto::ids() const {
+  // @@protoc_insertion_point(field_get:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.ids)
+  return _internal_ids();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void UnrealRLOutputProto_PackedAgentInfoProto::set_ids(Arg_&& arg,
+                                                     Args_... args) {
+  ;
+  _impl_.ids_.SetBytes(static_cast<Arg_&&>(arg), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.ids)
+}
+inline std::string* UnrealRLOutputProto_PackedAgentInfoProto::mutable_ids() {
+  std::string* _s = _internal_mutable_ids();
+  // @@protoc_insertion_point(field_mutable:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.ids)
+  return _s;
+}
+inline const std::string& UnrealRLOutputProto_PackedAgentInfoProto::_internal_ids() const {
+  return _impl_.ids_.Get();
+}
+inline void UnrealRLOutputProto_PackedAgentInfoProto::_internal_set_ids(const std::string& value) {
+  ;
+
+
+  _impl_.ids_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UnrealRLOutputProto_PackedAgentInfoProto::_internal_mutable_ids() {
+  ;
+  return _impl_.ids_.Mutable( GetArenaForAllocation());
+}
+inline std::string* UnrealRLOutputProto_PackedAgentInfoProto::release_ids() {
+  // @@protoc_insertion_point(field_release:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.ids)
+  return _impl_.ids_.Release();
+}
+inline void UnrealRLOutputProto_PackedAgentInfoProto::set_allocated_ids(std::string* value) {
+  _impl_.ids_.SetAllocated(value, GetArenaForAllocation());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.ids_.IsDefault()) {
+          _impl_.ids_.Set("", GetArenaForAllocation());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.ids)
+}
+
+// bytes rewards = 3;
+inline void UnrealRLOutputProto_PackedAgentInfoProto::clear_rewards() {
+  _impl_.rewards_.ClearToEmpty();
+}
+inline const std::string& UnrealRLOutputProto_PackedAgentInfoProto::rewards() const {
+  // @@protoc_insertion_point(field_get:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.rewards)
+  return _internal_rewards();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void UnrealRLOutputProto_PackedAgentInfoProto::set_rewards(Arg_&& arg,
+                                                     Args_... args) {
+  ;
+  _impl_.rewards_.SetBytes(static_cast<Arg_&&>(arg), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.rewards)
+}
+inline std::string* UnrealRLOutputProto_PackedAgentInfoProto::mutable_rewards() {
+  std::string* _s = _internal_mutable_rewards();
+  // @@protoc_insertion_point(field_mutable:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.rewards)
+  return _s;
+}
+inline const std::string& UnrealRLOutputProto_PackedAgentInfoProto::_internal_rewards() const {
+  return _impl_.rewards_.Get();
+}
+inline void UnrealRLOutputProto_PackedAgentInfoProto::_internal_set_rewards(const std::string& value) {
+  ;
+
+
+  _impl_.rewards_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UnrealRLOutputProto_PackedAgentInfoProto::_internal_mutable_rewards() {
+  ;
+  return _impl_.rewards_.Mutable( GetArenaForAllocation());
+}
+inline std::string* UnrealRLOutputProto_PackedAgentInfoProto::release_rewards() {
+  // @@protoc_insertion_point(field_release:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.rewards)
+  return _impl_.rewards_.Release();
+}
+inline void UnrealRLOutputProto_PackedAgentInfoProto::set_allocated_rewards(std::string* value) {
+  _impl_.rewards_.SetAllocated(value, GetArenaForAllocation());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.rewards_.IsDefault()) {
+          _impl_.rewards_.Set("", GetArenaForAllocation());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.rewards)
+}
+
+// bytes dones = 4;
+inline void UnrealRLOutputProto_PackedAgentInfoProto::clear_dones() {
+  _impl_.dones_.ClearToEmpty();
+}
+inline const std::string& UnrealRLOutputProto_PackedAgentInfoProto::dones() const {
+  // @@protoc_insertion_point(field_get:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.dones)
+  return _internal_dones();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void UnrealRLOutputProto_PackedAgentInfoProto::set_dones(Arg_&& arg,
+                                                     Args_... args) {
+  ;
+  _impl_.dones_.SetBytes(static_cast<Arg_&&>(arg), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.dones)
+}
+inline std::string* UnrealRLOutputProto_PackedAgentInfoProto::mutable_dones() {
+  std::string* _s = _internal_mutable_dones();
+  // @@protoc_insertion_point(field_mutable:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.dones)
+  return _s;
+}
+inline const std::string& UnrealRLOutputProto_PackedAgentInfoProto::_internal_dones() const {
+  return _impl_.dones_.Get();
+}
+inline void UnrealRLOutputProto_PackedAgentInfoProto::_internal_set_dones(const std::string& value) {
+  ;
+
+
+  _impl_.dones_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UnrealRLOutputProto_PackedAgentInfoProto::_internal_mutable_dones() {
+  ;
+  return _impl_.dones_.Mutable( GetArenaForAllocation());
+}
+inline std::string* UnrealRLOutputProto_PackedAgentInfoProto::release_dones() {
+  // @@protoc_insertion_point(field_release:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.dones)
+  return _impl_.dones_.Release();
+}
+inline void UnrealRLOutputProto_PackedAgentInfoProto::set_allocated_dones(std::string* value) {
+  _impl_.dones_.SetAllocated(value, GetArenaForAllocation());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.dones_.IsDefault()) {
+          _impl_.dones_.Set("", GetArenaForAllocation());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.dones)
+}
+
+// bytes max_step_reached = 5;
+inline void UnrealRLOutputProto_PackedAgentInfoProto::clear_max_step_reached() {
+  _impl_.max_step_reached_.ClearToEmpty();
+}
+inline const std::string& UnrealRLOutputProto_PackedAgentInfoProto::max_step_reached() const {
+  // @@protoc_insertion_point(field_get:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.max_step_reached)
+  return _internal_max_step_reached();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void UnrealRLOutputProto_PackedAgentInfoProto::set_max_step_reached(Arg_&& arg,
+                                                     Args_... args) {
+  ;
+  _impl_.max_step_reached_.SetBytes(static_cast<Arg_&&>(arg), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.max_step_reached)
+}
+inline std::string* UnrealRLOutputProto_PackedAgentInfoProto::mutable_max_step_reached() {
+  std::string* _s = _internal_mutable_max_step_reached();
+  // @@protoc_insertion_point(field_mutable:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.max_step_reached)
+  return _s;
+}
+inline const std::string& UnrealRLOutputProto_PackedAgentInfoProto::_internal_max_step_reached() const {
+  return _impl_.max_step_reached_.Get();
+}
+inline void UnrealRLOutputProto_PackedAgentInfoProto::_internal_set_max_step_reached(const std::string& value) {
+  ;
+
+
+  _impl_.max_step_reached_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UnrealRLOutputProto_PackedAgentInfoProto::_internal_mutable_max_step_reached() {
+  ;
+  return _impl_.max_step_reached_.Mutable( GetArenaForAllocation());
+}
+inline std::string* UnrealRLOutputProto_PackedAgentInfoProto::release_max_step_reached() {
+  // @@protoc_insertion_point(field_release:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.max_step_reached)
+  return _impl_.max_step_reached_.Release();
+}
+inline void UnrealRLOutputProto_PackedAgentInfoProto::set_allocated_max_step_reached(std::string* value) {
+  _impl_.max_step_reached_.SetAllocated(value, GetArenaForAllocation());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.max_step_reached_.IsDefault()) {
+          _impl_.max_step_reached_.Set("", GetArenaForAllocation());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.max_step_reached)
+}
+
+// bytes group_ids = 6;
+inline void UnrealRLOutputProto_PackedAgentInfoProto::clear_group_ids() {
+  _impl_.group_ids_.ClearToEmpty();
+}
+inline const std::string& UnrealRLOutputProto_PackedAgentInfoProto::group_ids() const {
+  // @@protoc_insertion_point(field_get:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.group_ids)
+  return _internal_group_ids();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void UnrealRLOutputProto_PackedAgentInfoProto::set_group_ids(Arg_&& arg,
+                                                     Args_... args) {
+  ;
+  _impl_.group_ids_.SetBytes(static_cast<Arg_&&>(arg), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.group_ids)
+}
+inline std::string* UnrealRLOutputProto_PackedAgentInfoProto::mutable_group_ids() {
+  std::string* _s = _internal_mutable_group_ids();
+  // @@protoc_insertion_point(field_mutable:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.group_ids)
+  return _s;
+}
+inline const std::string& UnrealRLOutputProto_PackedAgentInfoProto::_internal_group_ids() const {
+  return _impl_.group_ids_.Get();
+}
+inline void UnrealRLOutputProto_PackedAgentInfoProto::_internal_set_group_ids(const std::string& value) {
+  ;
+
+
+  _impl_.group_ids_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UnrealRLOutputProto_PackedAgentInfoProto::_internal_mutable_group_ids() {
+  ;
+  return _impl_.group_ids_.Mutable( GetArenaForAllocation());
+}
+inline std::string* UnrealRLOutputProto_PackedAgentInfoProto::release_group_ids() {
+  // @@protoc_insertion_point(field_release:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.group_ids)
+  return _impl_.group_ids_.Release();
+}
+inline void UnrealRLOutputProto_PackedAgentInfoProto::set_allocated_group_ids(std::string* value) {
+  _impl_.group_ids_.SetAllocated(value, GetArenaForAllocation());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.group_ids_.IsDefault()) {
+          _impl_.group_ids_.Set("", GetArenaForAllocation());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.group_ids)
+}
+
+// bytes group_rewards = 7;
+inline void UnrealRLOutputProto_PackedAgentInfoProto::clear_group_rewards() {
+  _impl_.group_rewards_.ClearToEmpty();
+}
+inline const std::string& UnrealRLOutputProto_PackedAgentInfoProto::group_rewards() const {
+  // @@protoc_insertion_point(field_get:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.group_rewards)
+  return _internal_group_rewards();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void UnrealRLOutputProto_PackedAgentInfoProto::set_group_rewards(Arg_&& arg,
+                                                     Args_... args) {
+  ;
+  _impl_.group_rewards_.SetBytes(static_cast<Arg_&&>(arg), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.group_rewards)
+}
+inline std::string* UnrealRLOutputProto_PackedAgentInfoProto::mutable_group_rewards() {
+  std::string* _s = _internal_mutable_group_rewards();
+  // @@protoc_insertion_point(field_mutable:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.group_rewards)
+  return _s;
+}
+inline const std::string& UnrealRLOutputProto_PackedAgentInfoProto::_internal_group_rewards() const {
+  return _impl_.group_rewards_.Get();
+}
+inline void UnrealRLOutputProto_PackedAgentInfoProto::_internal_set_group_rewards(const std::string& value) {
+  ;
+
+
+  _impl_.group_rewards_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UnrealRLOutputProto_PackedAgentInfoProto::_internal_mutable_group_rewards() {
+  ;
+  return _impl_.group_rewards_.Mutable( GetArenaForAllocation());
+}
+inline std::string* UnrealRLOutputProto_PackedAgentInfoProto::release_group_rewards() {
+  // @@protoc_insertion_point(field_release:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.group_rewards)
+  return _impl_.group_rewards_.Release();
+}
+inline void UnrealRLOutputProto_PackedAgentInfoProto::set_allocated_group_rewards(std::string* value) {
+  _impl_.group_rewards_.SetAllocated(value, GetArenaForAllocation());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.group_rewards_.IsDefault()) {
+          _impl_.group_rewards_.Set("", GetArenaForAllocation());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.group_rewards)
+}
+
+// bytes action_masks = 8;
+inline void UnrealRLOutputProto_PackedAgentInfoProto::clear_action_masks() {
+  _impl_.action_masks_.ClearToEmpty();
+}
+inline const std::string& UnrealRLOutputProto_PackedAgentInfoProto::action_masks() const {
+  // @@protoc_insertion_point(field_get:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.action_masks)
+  return _internal_action_masks();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void UnrealRLOutputProto_PackedAgentInfoProto::set_action_masks(Arg_&& arg,
+                                                     Args_... args) {
+  ;
+  _impl_.action_masks_.SetBytes(static_cast<Arg_&&>(arg), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.action_masks)
+}
+inline std::string* UnrealRLOutputProto_PackedAgentInfoProto::mutable_action_masks() {
+  std::string* _s = _internal_mutable_action_masks();
+  // @@protoc_insertion_point(field_mutable:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.action_masks)
+  return _s;
+}
+inline const std::string& UnrealRLOutputProto_PackedAgentInfoProto::_internal_action_masks() const {
+  return _impl_.action_masks_.Get();
+}
+inline void UnrealRLOutputProto_PackedAgentInfoProto::_internal_set_action_masks(const std::string& value) {
+  ;
+
+
+  _impl_.action_masks_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UnrealRLOutputProto_PackedAgentInfoProto::_internal_mutable_action_masks() {
+  ;
+  return _impl_.action_masks_.Mutable( GetArenaForAllocation());
+}
+inline std::string* UnrealRLOutputProto_PackedAgentInfoProto::release_action_masks() {
+  // @@protoc_insertion_point(field_release:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.action_masks)
+  return _impl_.action_masks_.Release();
+}
+inline void UnrealRLOutputProto_PackedAgentInfoProto::set_allocated_action_masks(std::string* value) {
+  _impl_.action_masks_.SetAllocated(value, GetArenaForAllocation());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.action_masks_.IsDefault()) {
+          _impl_.action_masks_.Set("", GetArenaForAllocation());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.action_masks)
+}
+
+// bytes consumed_steps = 10;
+inline void UnrealRLOutputProto_PackedAgentInfoProto::clear_consumed_steps() {
+  _impl_.consumed_steps_.ClearToEmpty();
+}
+inline const std::string& UnrealRLOutputProto_PackedAgentInfoProto::consumed_steps() const {
+  // @@protoc_insertion_point(field_get:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.consumed_steps)
+  return _internal_consumed_steps();
+}
+template <typename Arg_, typename... Args_>
+inline PROTOBUF_ALWAYS_INLINE void UnrealRLOutputProto_PackedAgentInfoProto::set_consumed_steps(Arg_&& arg,
+                                                     Args_... args) {
+  ;
+  _impl_.consumed_steps_.SetBytes(static_cast<Arg_&&>(arg), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.consumed_steps)
+}
+inline std::string* UnrealRLOutputProto_PackedAgentInfoProto::mutable_consumed_steps() {
+  std::string* _s = _internal_mutable_consumed_steps();
+  // @@protoc_insertion_point(field_mutable:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.consumed_steps)
+  return _s;
+}
+inline const std::string& UnrealRLOutputProto_PackedAgentInfoProto::_internal_consumed_steps() const {
+  return _impl_.consumed_steps_.Get();
+}
+inline void UnrealRLOutputProto_PackedAgentInfoProto::_internal_set_consumed_steps(const std::string& value) {
+  ;
+
+
+  _impl_.consumed_steps_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UnrealRLOutputProto_PackedAgentInfoProto::_internal_mutable_consumed_steps() {
+  ;
+  return _impl_.consumed_steps_.Mutable( GetArenaForAllocation());
+}
+inline std::string* UnrealRLOutputProto_PackedAgentInfoProto::release_consumed_steps() {
+  // @@protoc_insertion_point(field_release:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.consumed_steps)
+  return _impl_.consumed_steps_.Release();
+}
+inline void UnrealRLOutputProto_PackedAgentInfoProto::set_allocated_consumed_steps(std::string* value) {
+  _impl_.consumed_steps_.SetAllocated(value, GetArenaForAllocation());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+        if (_impl_.consumed_steps_.IsDefault()) {
+          _impl_.consumed_steps_.Set("", GetArenaForAllocation());
+        }
+  #endif  // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.consumed_steps)
+}
+
+// repeated .communicator_objects.ObservationProto observations = 9;
+inline int UnrealRLOutputProto_PackedAgentInfoProto::_internal_observations_size() const {
+  return _impl_.observations_.size();
+}
+inline int UnrealRLOutputProto_PackedAgentInfoProto::observations_size() const {
+  return _internal_observations_size();
+}
+inline ::communicator_objects::ObservationProto* UnrealRLOutputProto_PackedAgentInfoProto::mutable_observations(int index) {
+  // @@protoc_insertion_point(field_mutable:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.observations)
+  return _internal_mutable_observations()->Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::communicator_objects::ObservationProto >*
+UnrealRLOutputProto_PackedAgentInfoProto::mutable_observations() {
+  // @@protoc_insertion_point(field_mutable_list:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.observations)
+  return _internal_mutable_observations();
+}
+inline const ::communicator_objects::ObservationProto& UnrealRLOutputProto_PackedAgentInfoProto::_internal_observations(int index) const {
+  return _internal_observations().Get(index);
+}
+inline const ::communicator_objects::ObservationProto& UnrealRLOutputProto_PackedAgentInfoProto::observations(int index) const {
+  // @@protoc_insertion_point(field_get:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.observations)
+  return _internal_observations(index);
+}
+inline ::communicator_objects::ObservationProto* UnrealRLOutputProto_PackedAgentInfoProto::_internal_add_observations() {
+  return _internal_mutable_observations()->Add();
+}
+inline ::communicator_objects::ObservationProto* UnrealRLOutputProto_PackedAgentInfoProto::add_observations() {
+  ::communicator_objects::ObservationProto* _add = _internal_add_observations();
+  // @@protoc_insertion_point(field_add:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.observations)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::communicator_objects::ObservationProto >&
+UnrealRLOutputProto_PackedAgentInfoProto::observations() const {
+  // @@protoc_insertion_point(field_list:communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto.observations)
+  return _internal_observations();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<::communicator_objects::ObservationProto>&
+UnrealRLOutputProto_PackedAgentInfoProto::_internal_observations() const {
+  return _impl_.observations_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<::communicator_objects::ObservationProto>*
+UnrealRLOutputProto_PackedAgentInfoProto::_internal_mutable_observations() {
+  return &_impl_.observations_;
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 // -------------------------------------------------------------------
 
 // UnrealRLOutputProto
@@ -607,6 +1468,35 @@ inline void UnrealRLOutputProto::set_allocated_side_channel(std::string* value)
   // @@protoc_insertion_point(field_set_allocated:communicator_objects.UnrealRLOutputProto.side_channel)
 }
 
+// map<string, .communicator_objects.UnrealRLOutputProto.PackedAgentInfoProto> packedAgentInfos = 3;
+inline int UnrealRLOutputProto::_internal_packedagentinfos_size() const {
+  return _impl_.packedagentinfos_.size();
+}
+inline int UnrealRLOutputProto::packedagentinfos_size() const {
+  return _internal_packedagentinfos_size();
+}
+inline void UnrealRLOutputProto::clear_packedagentinfos() {
+  _impl_.packedagentinfos_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::communicator_objects::UnrealRLOutputProto_PackedAgentInfoProto >&
+UnrealRLOutputProto::_internal_packedagentinfos() const {
+  return _impl_.packedagentinfos_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::communicator_objects::UnrealRLOutputProto_PackedAgentInfoProto >&
+UnrealRLOutputProto::packedagentinfos() const {
+  // @@protoc_insertion_point(field_map:communicator_objects.UnrealRLOutputProto.packedAgentInfos)
+  return _internal_packedagentinfos();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::communicator_objects::UnrealRLOutputProto_PackedAgentInfoProto >*
+UnrealRLOutputProto::_internal_mutable_packedagentinfos() {
+  return _impl_.packedagentinfos_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::communicator_objects::UnrealRLOutputProto_PackedAgentInfoProto >*
+UnrealRLOutputProto::mutable_packedagentinfos() {
+  // @@protoc_insertion_point(field_mutable_map:communicator_objects.UnrealRLOutputProto.packedAgentInfos)
+  return _internal_mutable_packedagentinfos();
+}
+
 #ifdef __GNUC__
 #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -27,6 +27,7 @@ namespace communicator_objects {
 
 static const char* UnrealToExternalProto_method_names[] = {
   "/communicator_objects.UnrealToExternalProto/Exchange",
+  "/communicator_objects.UnrealToExternalProto/ExchangeStream",
 };
 
 std::unique_ptr< UnrealToExternalProto::Stub> UnrealToExternalProto::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
@@ -37,6 +38,7 @@ std::unique_ptr< UnrealToExternalProto::Stub> UnrealToExternalProto::NewStub(con
 
 UnrealToExternalProto::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options)
   : channel_(channel), rpcmethod_Exchange_(UnrealToExternalProto_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_ExchangeStream_(UnrealToExternalProto_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::BIDI_STREAMING, channel)
   {}
 
 ::grpc::Status UnrealToExternalProto::Stub::Exchange(::grpc::ClientContext* context, const ::communicator_objects::UnrealMessageProto& request, ::communicator_objects::UnrealMessageProto* response) {
@@ -62,6 +64,22 @@ void UnrealToExternalProto::Stub::async::Exchange(::grpc::ClientContext* context
   return result;
 }
 
+::grpc::ClientReaderWriter< ::communicator_objects::UnrealMessageProto, ::communicator_objects::UnrealMessageProto>* UnrealToExternalProto::Stub::ExchangeStreamRaw(::grpc::ClientContext* context) {
+  return ::grpc::internal::ClientReaderWriterFactory< ::communicator_objects::UnrealMessageProto, ::communicator_objects::UnrealMessageProto>::Create(channel_.get(), rpcmethod_ExchangeStream_, context);
+}
+
+void UnrealToExternalProto::Stub::async::ExchangeStream(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::communicator_objects::UnrealMessageProto,::communicator_objects::UnrealMessageProto>* reactor) {
+  ::grpc::internal::ClientCallbackReaderWriterFactory< ::communicator_objects::UnrealMessageProto,::communicator_objects::UnrealMessageProto>::Create(stub_->channel_.get(), stub_->rpcmethod_ExchangeStream_, context, reactor);
+}
+
+::grpc::ClientAsyncReaderWriter< ::communicator_objects::UnrealMessageProto, ::communicator_objects::UnrealMessageProto>* UnrealToExternalProto::Stub::AsyncExchangeStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::communicator_objects::UnrealMessageProto, ::communicator_objects::UnrealMessageProto>::Create(channel_.get(), cq, rpcmethod_ExchangeStream_, context, true, tag);
+}
+
+::grpc::ClientAsyncReaderWriter< ::communicator_objects::UnrealMessageProto, ::communicator_objects::UnrealMessageProto>* UnrealToExternalProto::Stub::PrepareAsyncExchangeStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::communicator_objects::UnrealMessageProto, ::communicator_objects::UnrealMessageProto>::Create(channel_.get(), cq, rpcmethod_ExchangeStream_, context, false, nullptr);
+}
+
 UnrealToExternalProto::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       UnrealToExternalProto_method_names[0],
@@ -73,6 +91,16 @@ UnrealToExternalProto::Service::Service() {
              ::communicator_objects::UnrealMessageProto* resp) {
                return service->Exchange(ctx, req, resp);
              }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      UnrealToExternalProto_method_names[1],
+      ::grpc::internal::RpcMethod::BIDI_STREAMING,
+      new ::grpc::internal::BidiStreamingHandler< UnrealToExternalProto::Service, ::communicator_objects::UnrealMessageProto, ::communicator_objects::UnrealMessageProto>(
+          [](UnrealToExternalProto::Service* service,
+             ::grpc::ServerContext* ctx,
+             ::grpc::ServerReaderWriter<::communicator_objects::UnrealMessageProto,
+             ::communicator_objects::UnrealMessageProto>* stream) {
+               return service->ExchangeStream(ctx, stream);
+             }, this)));
 }
 
 UnrealToExternalProto::Service::~Service() {
@@ -85,5 +113,11 @@ UnrealToExternalProto::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status UnrealToExternalProto::Service::ExchangeStream(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::communicator_objects::UnrealMessageProto, ::communicator_objects::UnrealMessageProto>* stream) {
+  (void) context;
+  (void) stream;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 }  // namespace communicator_objects
@@ -45,12 +45,24 @@ class UnrealToExternalProto final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::communicator_objects::UnrealMessageProto>> PrepareAsyncExchange(::grpc::ClientContext* context, const ::communicator_objects::UnrealMessageProto& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::communicator_objects::UnrealMessageProto>>(PrepareAsyncExchangeRaw(context, request, cq));
     }
+    // Exchanges the step messages over one stream kept open for the whole session
+    std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::communicator_objects::UnrealMessageProto, ::communicator_objects::UnrealMessageProto>> ExchangeStream(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::communicator_objects::UnrealMessageProto, ::communicator_objects::UnrealMessageProto>>(ExchangeStreamRaw(context));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::communicator_objects::UnrealMessageProto, ::communicator_objects::UnrealMessageProto>> AsyncExchangeStream(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::communicator_objects::UnrealMessageProto, ::communicator_objects::UnrealMessageProto>>(AsyncExchangeStreamRaw(context, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::communicator_objects::UnrealMessageProto, ::communicator_objects::UnrealMessageProto>> PrepareAsyncExchangeStream(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::communicator_objects::UnrealMessageProto, ::communicator_objects::UnrealMessageProto>>(PrepareAsyncExchangeStreamRaw(context, cq));
+    }
     class async_interface {
      public:
       virtual ~async_interface() {}
       // Sends the academy parameters
       virtual void Exchange(::grpc::ClientContext* context, const ::communicator_objects::UnrealMessageProto* request, ::communicator_objects::UnrealMessageProto* response, std::function<void(::grpc::Status)>) = 0;
       virtual void Exchange(::grpc::ClientContext* context, const ::communicator_objects::UnrealMessageProto* request, ::communicator_objects::UnrealMessageProto* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // Exchanges the step messages over one stream kept open for the whole session
+      virtual void ExchangeStream(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::communicator_objects::UnrealMessageProto,::communicator_objects::UnrealMessageProto>* reactor) = 0;
     };
     typedef class async_interface experimental_async_interface;
     virtual class async_interface* async() { return nullptr; }
@@ -58,6 +70,9 @@ class UnrealToExternalProto final {
    private:
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::communicator_objects::UnrealMessageProto>* AsyncExchangeRaw(::grpc::ClientContext* context, const ::communicator_objects::UnrealMessageProto& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::communicator_objects::UnrealMessageProto>* PrepareAsyncExchangeRaw(::grpc::ClientContext* context, const ::communicator_objects::UnrealMessageProto& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderWriterInterface< ::communicator_objects::UnrealMessageProto, ::communicator_objects::UnrealMessageProto>* ExchangeStreamRaw(::grpc::ClientContext* context) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::communicator_objects::UnrealMessageProto, ::communicator_objects::UnrealMessageProto>* AsyncExchangeStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::communicator_objects::UnrealMessageProto, ::communicator_objects::UnrealMessageProto>* PrepareAsyncExchangeStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
@@ -69,11 +84,21 @@ class UnrealToExternalProto final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::communicator_objects::UnrealMessageProto>> PrepareAsyncExchange(::grpc::ClientContext* context, const ::communicator_objects::UnrealMessageProto& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::communicator_objects::UnrealMessageProto>>(PrepareAsyncExchangeRaw(context, request, cq));
     }
+    std::unique_ptr< ::grpc::ClientReaderWriter< ::communicator_objects::UnrealMessageProto, ::communicator_objects::UnrealMessageProto>> ExchangeStream(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriter< ::communicator_objects::UnrealMessageProto, ::communicator_objects::UnrealMessageProto>>(ExchangeStreamRaw(context));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::communicator_objects::UnrealMessageProto, ::communicator_objects::UnrealMessageProto>> AsyncExchangeStream(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::communicator_objects::UnrealMessageProto, ::communicator_objects::UnrealMessageProto>>(AsyncExchangeStreamRaw(context, cq, tag));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::communicator_objects::UnrealMessageProto, ::communicator_objects::UnrealMessageProto>> PrepareAsyncExchangeStream(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::communicator_objects::UnrealMessageProto, ::communicator_objects::UnrealMessageProto>>(PrepareAsyncExchangeStreamRaw(context, cq));
+    }
     class async final :
       public StubInterface::async_interface {
      public:
       void Exchange(::grpc::ClientContext* context, const ::communicator_objects::UnrealMessageProto* request, ::communicator_objects::UnrealMessageProto* response, std::function<void(::grpc::Status)>) override;
       void Exchange(::grpc::ClientContext* context, const ::communicator_objects::UnrealMessageProto* request, ::communicator_objects::UnrealMessageProto* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void ExchangeStream(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::communicator_objects::UnrealMessageProto,::communicator_objects::UnrealMessageProto>* reactor) override;
      private:
       friend class Stub;
       explicit async(Stub* stub): stub_(stub) { }
@@ -87,7 +112,11 @@ class UnrealToExternalProto final {
     class async async_stub_{this};
     ::grpc::ClientAsyncResponseReader< ::communicator_objects::UnrealMessageProto>* AsyncExchangeRaw(::grpc::ClientContext* context, const ::communicator_objects::UnrealMessageProto& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::communicator_objects::UnrealMessageProto>* PrepareAsyncExchangeRaw(::grpc::ClientContext* context, const ::communicator_objects::UnrealMessageProto& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReaderWriter< ::communicator_objects::UnrealMessageProto, ::communicator_objects::UnrealMessageProto>* ExchangeStreamRaw(::grpc::ClientContext* context) override;
+    ::grpc::ClientAsyncReaderWriter< ::communicator_objects::UnrealMessageProto, ::communicator_objects::UnrealMessageProto>* AsyncExchangeStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReaderWriter< ::communicator_objects::UnrealMessageProto, ::communicator_objects::UnrealMessageProto>* PrepareAsyncExchangeStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_Exchange_;
+    const ::grpc::internal::RpcMethod rpcmethod_ExchangeStream_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -97,6 +126,8 @@ class UnrealToExternalProto final {
     virtual ~Service();
     // Sends the academy parameters
     virtual ::grpc::Status Exchange(::grpc::ServerContext* context, const ::communicator_objects::UnrealMessageProto* request, ::communicator_objects::UnrealMessageProto* response);
+    // Exchanges the step messages over one stream kept open for the whole session
+    virtual ::grpc::Status ExchangeStream(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::communicator_objects::UnrealMessageProto, ::communicator_objects::UnrealMessageProto>* stream);
   };
   template <class BaseClass>
   class WithAsyncMethod_Exchange : public BaseClass {
@@ -118,7 +149,27 @@ class UnrealToExternalProto final {
       ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_Exchange<Service > AsyncService;
+  template <class BaseClass>
+  class WithAsyncMethod_ExchangeStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_ExchangeStream() {
+      ::grpc::Service::MarkMethodAsync(1);
+    }
+    ~WithAsyncMethod_ExchangeStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ExchangeStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::communicator_objects::UnrealMessageProto, ::communicator_objects::UnrealMessageProto>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestExchangeStream(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::communicator_objects::UnrealMessageProto, ::communicator_objects::UnrealMessageProto>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(1, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_Exchange<WithAsyncMethod_ExchangeStream<Service > > AsyncService;
   template <class BaseClass>
   class WithCallbackMethod_Exchange : public BaseClass {
    private:
@@ -146,7 +197,30 @@ class UnrealToExternalProto final {
     virtual ::grpc::ServerUnaryReactor* Exchange(
       ::grpc::CallbackServerContext* /*context*/, const ::communicator_objects::UnrealMessageProto* /*request*/, ::communicator_objects::UnrealMessageProto* /*response*/)  { return nullptr; }
   };
-  typedef WithCallbackMethod_Exchange<Service > CallbackService;
+  template <class BaseClass>
+  class WithCallbackMethod_ExchangeStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_ExchangeStream() {
+      ::grpc::Service::MarkMethodCallback(1,
+          new ::grpc::internal::CallbackBidiHandler< ::communicator_objects::UnrealMessageProto, ::communicator_objects::UnrealMessageProto>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->ExchangeStream(context); }));
+    }
+    ~WithCallbackMethod_ExchangeStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ExchangeStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::communicator_objects::UnrealMessageProto, ::communicator_objects::UnrealMessageProto>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::communicator_objects::UnrealMessageProto, ::communicator_objects::UnrealMessageProto>* ExchangeStream(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  typedef WithCallbackMethod_Exchange<WithCallbackMethod_ExchangeStream<Service > > CallbackService;
   typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_Exchange : public BaseClass {
@@ -166,6 +240,23 @@ class UnrealToExternalProto final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_ExchangeStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_ExchangeStream() {
+      ::grpc::Service::MarkMethodGeneric(1);
+    }
+    ~WithGenericMethod_ExchangeStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ExchangeStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::communicator_objects::UnrealMessageProto, ::communicator_objects::UnrealMessageProto>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_Exchange : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -186,6 +277,26 @@ class UnrealToExternalProto final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_ExchangeStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_ExchangeStream() {
+      ::grpc::Service::MarkMethodRaw(1);
+    }
+    ~WithRawMethod_ExchangeStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ExchangeStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::communicator_objects::UnrealMessageProto, ::communicator_objects::UnrealMessageProto>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestExchangeStream(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(1, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithRawCallbackMethod_Exchange : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -208,6 +319,29 @@ class UnrealToExternalProto final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_ExchangeStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_ExchangeStream() {
+      ::grpc::Service::MarkMethodRawCallback(1,
+          new ::grpc::internal::CallbackBidiHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->ExchangeStream(context); }));
+    }
+    ~WithRawCallbackMethod_ExchangeStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ExchangeStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::communicator_objects::UnrealMessageProto, ::communicator_objects::UnrealMessageProto>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* ExchangeStream(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_Exchange : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -35,10 +35,13 @@ const char descriptor_table_protodef_ueagents_5fenvs_2fcommunicator_5fobjects_2f
     "\n;ueagents_envs/communicator_objects/unr"
     "eal_to_external.proto\022\024communicator_obje"
     "cts\0327ueagents_envs/communicator_objects/"
-    "unreal_message.proto2y\n\025UnrealToExternal"
-    "Proto\022`\n\010Exchange\022(.communicator_objects"
-    ".UnrealMessageProto\032(.communicator_objec"
-    "ts.UnrealMessageProto\"\000b\006proto3"
+    "unreal_message.proto2\345\001\n\025UnrealToExterna"
+    "lProto\022`\n\010Exchange\022(.communicator_object"
+    "s.UnrealMessageProto\032(.communicator_obje"
+    "cts.UnrealMessageProto\"\000\022j\n\016ExchangeStre"
+    "am\022(.communicator_objects.UnrealMessageP"
+    "roto\032(.communicator_objects.UnrealMessag"
+    "eProto\"\000(\0010\001b\006proto3"
 };
 static const ::_pbi::DescriptorTable* const descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5fto_5fexternal_2eproto_deps[1] =
     {
@@ -48,7 +51,7 @@ static ::absl::once_flag descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjec
 const ::_pbi::DescriptorTable descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5fto_5fexternal_2eproto = {
     false,
     false,
-    271,
+    380,
     descriptor_table_protodef_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5fto_5fexternal_2eproto,
     "ueagents_envs/communicator_objects/unreal_to_external.proto",
     &descriptor_table_ueagents_5fenvs_2fcommunicator_5fobjects_2funreal_5fto_5fexternal_2eproto_once,
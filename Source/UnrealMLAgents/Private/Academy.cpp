@@ -1,6 +1,8 @@
 // Copyright © 2025 Stephane Capponi and individual contributors. All Rights Reserved.
 
 #include "UnrealMLAgents/Academy.h"
+#include "UnrealMLAgents/Communicator/SharedMemoryCommunicator.h"
+#include "UnrealMLAgents/SideChannels/SideChannelManager.h"
 
 #if WITH_EDITOR
 #include "Editor/EditorEngine.h"
@@ -97,6 +99,136 @@ void UAcademy::ParseCommandLineArgs()
 	{
 		UE_LOG(LogTemp, Log, TEXT("Using default mlAgentPort: %d"), Port);
 	}
+
+	if (FParse::Value(FCommandLine::Get(), *SocketPathCommandLineFlag, SocketPath))
+	{
+		UE_LOG(LogTemp, Log, TEXT("Using Unix domain socket: %s"), *SocketPath);
+	}
+
+	if (FParse::Param(FCommandLine::Get(), *ArenaCommandLineFlag))
+	{
+		bUseArenaMessages = true;
+		UE_LOG(LogTemp, Log, TEXT("Building communicator step messages on reusable arenas"));
+	}
+
+	if (FParse::Param(FCommandLine::Get(), *OverlapExchangeCommandLineFlag))
+	{
+		bOverlapExchange = true;
+		UE_LOG(LogTemp, Log, TEXT("Running communicator exchanges on a dedicated thread"));
+	}
+
+	if (FParse::Param(FCommandLine::Get(), *SharedMemoryCommandLineFlag))
+	{
+		bUseSharedMemory = true;
+		UE_LOG(LogTemp, Log, TEXT("Exchanging messages with the trainer through shared memory"));
+	}
+
+	FString ShardsString;
+	if (FParse::Value(FCommandLine::Get(), *ShardsCommandLineFlag, ShardsString, false))
+	{
+		TArray<FString> Shards;
+		ShardsString.ParseIntoArray(Shards, TEXT(","));
+		for (const FString& Shard : Shards)
+		{
+			FString BehaviorName;
+			FString ShardPortString;
+			Shard.Split(TEXT(":"), &BehaviorName, &ShardPortString, ESearchCase::IgnoreCase, ESearchDir::FromEnd);
+			const int32 ShardPort = FCString::Atoi(*ShardPortString);
+			if (BehaviorName.IsEmpty() || ShardPort <= 0)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("Ignoring the invalid behavior shard '%s', expected Name:Port."), *Shard);
+				continue;
+			}
+			if (ShardPort != Port)
+			{
+				BehaviorShardPorts.Add(BehaviorName, ShardPort);
+				UE_LOG(LogTemp, Log, TEXT("Behavior %s trains with the trainer on port %d"), *BehaviorName, ShardPort);
+			}
+		}
+	}
+
+	if (FParse::Param(FCommandLine::Get(), *ReconnectCommandLineFlag))
+	{
+		bReconnect = true;
+		UE_LOG(LogTemp, Log, TEXT("Waiting for a new trainer whenever the trainer is lost"));
+	}
+
+	FString MaxMessageSizeString;
+	if (FParse::Value(FCommandLine::Get(), *MaxMessageSizeCommandLineFlag, MaxMessageSizeString))
+	{
+		const int32 ParsedMaxMessageSize = FCString::Atoi(*MaxMessageSizeString);
+		if (ParsedMaxMessageSize < FCommunicatorInitParameters::MinMaxMessageSize)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Ignoring the max message size %s, it must be at least %d bytes."),
+				*MaxMessageSizeString, FCommunicatorInitParameters::MinMaxMessageSize);
+		}
+		else
+		{
+			MaxMessageSize = ParsedMaxMessageSize;
+			UE_LOG(LogTemp, Log, TEXT("Exchanging messages of up to %d bytes with the trainer"), MaxMessageSize);
+		}
+	}
+
+	FString ExchangeDeadlineString;
+	if (FParse::Value(FCommandLine::Get(), *ExchangeDeadlineCommandLineFlag, ExchangeDeadlineString))
+	{
+		const int32 DeadlineMs = FCString::Atoi(*ExchangeDeadlineString);
+		if (DeadlineMs <= 0)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Ignoring the exchange deadline %s, it must be a positive number of ms."),
+				*ExchangeDeadlineString);
+		}
+		else if (bOverlapExchange)
+		{
+			// The overlapped exchange already plays on while the trainer decides, a deadline would only stall it
+			UE_LOG(LogTemp, Warning, TEXT("Ignoring the exchange deadline %s, it cannot be combined with -%s."),
+				*ExchangeDeadlineString, *OverlapExchangeCommandLineFlag);
+		}
+		else
+		{
+			ExchangeDeadline = DeadlineMs / 1000.0f;
+			UE_LOG(LogTemp, Log, TEXT("Agents keep their last actions when the trainer takes more than %d ms"),
+				DeadlineMs);
+		}
+	}
+
+	FString MicroBatchesString;
+	if (FParse::Value(FCommandLine::Get(), *MicroBatchesCommandLineFlag, MicroBatchesString))
+	{
+		const int32 ParsedMicroBatches = FCString::Atoi(*MicroBatchesString);
+		if (ParsedMicroBatches < 1)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Ignoring the number of micro-batches %s, it must be at least 1."),
+				*MicroBatchesString);
+		}
+		else
+		{
+			MicroBatches = ParsedMicroBatches;
+			UE_LOG(LogTemp, Log, TEXT("Splitting the agents of each step into %d micro-batches"), MicroBatches);
+		}
+	}
+
+	FString GatewayIndexString;
+	if (FParse::Value(FCommandLine::Get(), *GatewayIndexCommandLineFlag, GatewayIndexString))
+	{
+		const int32 ParsedGatewayIndex = FCString::Atoi(*GatewayIndexString);
+		if (ParsedGatewayIndex < 0)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Ignoring the gateway index %s, it must not be negative."),
+				*GatewayIndexString);
+		}
+		else
+		{
+			GatewayIndex = ParsedGatewayIndex;
+			UE_LOG(LogTemp, Log, TEXT("Connecting to the communicator gateway as environment %d"), GatewayIndex);
+		}
+	}
+
+	if (FParse::Param(FCommandLine::Get(), *CommunicatorStatsCommandLineFlag))
+	{
+		bWriteCommunicatorStats = true;
+		UE_LOG(LogTemp, Log, TEXT("Writing the communicator step timings next to the log"));
+	}
 }
 
 void UAcademy::InitializeEnvironment()
@@ -105,20 +237,36 @@ void UAcademy::InitializeEnvironment()
 
 	bEnableStepping = true;
 	ParseCommandLineArgs();
+	GetStatsRecorder();
+	GetEnvironmentParameters();
 
-	RpcCommunicator = NewObject<URpcCommunicator>();
+	RpcCommunicator = bUseSharedMemory ? NewObject<USharedMemoryCommunicator>() : NewObject<URpcCommunicator>();
 
 	if (RpcCommunicator != nullptr)
 	{
 		bool						bInitSuccessful = false;
 		FCommunicatorInitParameters CommunicatorInitParams;
 		CommunicatorInitParams.Port = Port;
+		CommunicatorInitParams.SocketPath = SocketPath;
 		CommunicatorInitParams.UnrealCommunicationVersion = ApiVersion;
 		CommunicatorInitParams.UnrealPackageVersion = PackageVersion;
 		CommunicatorInitParams.Name = TEXT("AcademySingleton");
+		CommunicatorInitParams.bUseArenaMessages = bUseArenaMessages;
+		CommunicatorInitParams.bOverlapExchange = bOverlapExchange;
+		CommunicatorInitParams.bWriteStatsCsv = bWriteCommunicatorStats;
+		CommunicatorInitParams.bReconnect = bReconnect;
+		CommunicatorInitParams.MaxMessageSize = MaxMessageSize;
+		CommunicatorInitParams.ExchangeDeadline = ExchangeDeadline;
+		CommunicatorInitParams.MicroBatches = MicroBatches;
+		CommunicatorInitParams.GatewayIndex = GatewayIndex;
 
 		try
 		{
+			// The shards connect first, the main communicator only runs its exchanges alongside theirs once one of
+			// them is connected
+			InitializeShards(CommunicatorInitParams);
+			CommunicatorInitParams.bSharded = ShardCommunicators.Num() > 0;
+
 			FUnrealRLInitParameters UnrealRLInitParameters;
 			bInitSuccessful = RpcCommunicator->Initialize(CommunicatorInitParams, UnrealRLInitParameters);
 
@@ -127,6 +275,7 @@ void UAcademy::InitializeEnvironment()
 				FMath::SRandInit(UnrealRLInitParameters.Seed);
 				InferenceSeed = UnrealRLInitParameters.Seed;
 				NumAreas = UnrealRLInitParameters.NumAreas;
+				GroupShards();
 			}
 			else
 			{
@@ -145,13 +294,32 @@ void UAcademy::InitializeEnvironment()
 				UTF8_TO_TCHAR(Ex.what()));
 			RpcCommunicator = nullptr;
 		}
+
+		if (RpcCommunicator == nullptr)
+		{
+			// Inference runs without any trainer, the shards are let go as well
+			for (const TPair<int32, URpcCommunicator*>& Shard : ShardCommunicators)
+			{
+				Shard.Value->Dispose();
+			}
+			ShardCommunicators.Reset();
+		}
 	}
 
+	// Without a trainer nothing would ever send the statistics
+	StatsRecorder->SetEnabled(RpcCommunicator != nullptr);
+
 	if (RpcCommunicator != nullptr)
 	{
 		RpcCommunicator->OnQuitCommandReceived().AddDynamic(this, &UAcademy::OnQuitCommandReceived);
 		RpcCommunicator->OnResetCommandReceived().AddDynamic(this, &UAcademy::OnResetCommand);
 	}
+	for (const TPair<int32, URpcCommunicator*>& Shard : ShardCommunicators)
+	{
+		// Every trainer can quit or reset the environment, which is shared by all of them
+		Shard.Value->OnQuitCommandReceived().AddDynamic(this, &UAcademy::OnQuitCommandReceived);
+		Shard.Value->OnResetCommandReceived().AddDynamic(this, &UAcademy::OnResetCommand);
+	}
 
 	// If a communicator is enabled/provided, then we assume we are in
 	// training mode. In the absence of a communicator, we assume we are
@@ -160,6 +328,83 @@ void UAcademy::InitializeEnvironment()
 	ResetActions();
 }
 
+void UAcademy::InitializeShards(const FCommunicatorInitParameters& InitParameters)
+{
+	for (const TPair<FString, int32>& BehaviorShard : BehaviorShardPorts)
+	{
+		if (ShardCommunicators.Contains(BehaviorShard.Value))
+		{
+			continue;
+		}
+
+		URpcCommunicator* Shard = bUseSharedMemory ? NewObject<USharedMemoryCommunicator>()
+												   : NewObject<URpcCommunicator>();
+		FCommunicatorInitParameters ShardInitParameters = InitParameters;
+		ShardInitParameters.Port = BehaviorShard.Value;
+		// A socket path names a single endpoint, the shards are reached through their ports
+		ShardInitParameters.SocketPath.Empty();
+		// The side channels, such as the statistics, go to the main trainer only
+		ShardInitParameters.bSendSideChannels = false;
+		ShardInitParameters.bSharded = true;
+
+		bool bShardInitialized = false;
+		try
+		{
+			FUnrealRLInitParameters ShardRLInitParameters;
+			bShardInitialized = Shard->Initialize(ShardInitParameters, ShardRLInitParameters);
+		}
+		catch (const std::exception& Ex)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Unexpected exception when trying to initialize communication: %s"),
+				UTF8_TO_TCHAR(Ex.what()));
+		}
+		if (!bShardInitialized)
+		{
+			UE_LOG(LogTemp, Warning,
+				TEXT("Couldn't connect to the trainer on port %d, its behaviors train with the main trainer."),
+				BehaviorShard.Value);
+			continue;
+		}
+		ShardCommunicators.Add(BehaviorShard.Value, Shard);
+	}
+
+	if (BehaviorShardPorts.Num() > 0 && ShardCommunicators.Num() == 0)
+	{
+		UE_LOG(LogTemp, Warning,
+			TEXT("No behavior shard could be reached, every behavior trains with the main trainer."));
+	}
+}
+
+void UAcademy::GroupShards()
+{
+	if (ShardCommunicators.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<URpcCommunicator*> ShardGroup = { RpcCommunicator };
+	for (const TPair<int32, URpcCommunicator*>& Shard : ShardCommunicators)
+	{
+		ShardGroup.Add(Shard.Value);
+	}
+	for (URpcCommunicator* Shard : ShardGroup)
+	{
+		Shard->SetShardGroup(ShardGroup);
+	}
+}
+
+URpcCommunicator* UAcademy::GetCommunicator(const FString& BehaviorName) const
+{
+	if (const int32* ShardPort = BehaviorShardPorts.Find(BehaviorName))
+	{
+		if (URpcCommunicator* const* Shard = ShardCommunicators.Find(*ShardPort))
+		{
+			return *Shard;
+		}
+	}
+	return RpcCommunicator;
+}
+
 void UAcademy::EnvironmentStep()
 {
 
@@ -243,6 +488,22 @@ void UAcademy::Dispose(bool bIsSimulating)
 		RpcCommunicator->Dispose();
 		RpcCommunicator = nullptr;
 	}
+	for (const TPair<int32, URpcCommunicator*>& Shard : ShardCommunicators)
+	{
+		Shard.Value->Dispose();
+	}
+	ShardCommunicators.Reset();
+
+	if (StatsRecorder.IsValid())
+	{
+		FSideChannelManager::UnregisterSideChannel(StatsRecorder.ToSharedRef());
+		StatsRecorder.Reset();
+	}
+	if (EnvironmentParameters.IsValid())
+	{
+		FSideChannelManager::UnregisterSideChannel(EnvironmentParameters.ToSharedRef());
+		EnvironmentParameters.Reset();
+	}
 
 	// Clear out the actions so we're not keeping references to any old objects
 	ResetActions();
@@ -287,3 +548,23 @@ bool UAcademy::IsCommunicatorOn()
 {
 	return RpcCommunicator != nullptr;
 }
+
+FStatsRecorder& UAcademy::GetStatsRecorder()
+{
+	if (!StatsRecorder.IsValid())
+	{
+		StatsRecorder = MakeShared<FStatsRecorder>();
+		FSideChannelManager::RegisterSideChannel(StatsRecorder.ToSharedRef());
+	}
+	return *StatsRecorder;
+}
+
+FEnvironmentParameters& UAcademy::GetEnvironmentParameters()
+{
+	if (!EnvironmentParameters.IsValid())
+	{
+		EnvironmentParameters = MakeShared<FEnvironmentParameters>();
+		FSideChannelManager::RegisterSideChannel(EnvironmentParameters.ToSharedRef());
+	}
+	return *EnvironmentParameters;
+}
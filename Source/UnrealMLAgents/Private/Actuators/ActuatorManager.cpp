@@ -49,6 +49,7 @@ void UActuatorManager::ReadyActuatorsForExecution(const TArray<TScriptInterface<
 		(InNumContinuousActions == 0) ? FActionSegment<float>::Empty : FActionSegment<float>(ContinuousActionArray);
 
 	StoredActions = FActionBuffers(ContinuousActions, DiscreteActions);
+	ActionSequence = MakeShared<FActionSequence>();
 	CombinedActionSpec = CombineActionSpecs(InActuators);
 	DiscreteActionMask = NewObject<UActuatorDiscreteActionMask>();
 	DiscreteActionMask->Initialize(
@@ -103,6 +104,11 @@ FActionSpec UActuatorManager::GetCombinedActionSpec()
 void UActuatorManager::UpdateActions(const FActionBuffers& Actions)
 {
 	ReadyActuatorsForExecution();
+	if (Actions.IsEmpty())
+	{
+		// Without actions for the decision nothing is left of the sequence of the previous one
+		ActionSequence->Reset();
+	}
 	UpdateActionArray<float>(Actions.ContinuousActions, StoredActions.ContinuousActions);
 	UpdateActionArray<int32>(Actions.DiscreteActions, StoredActions.DiscreteActions);
 }
@@ -126,6 +132,12 @@ void UActuatorManager::UpdateActionArray(const FActionSegment<T>& SourceActionBu
 		// Ensure both source and destination arrays are valid
 		check(SourceActionBuffer.Array.IsValid() && Destination.Array.IsValid());
 
+		if (SourceActionBuffer == Destination)
+		{
+			// The actions were decoded straight into the stored actions
+			return;
+		}
+
 		// Perform memory copy
 		FMemory::Memcpy(Destination.Array->GetData() + Destination.Offset,
 			SourceActionBuffer.Array->GetData() + SourceActionBuffer.Offset, SourceActionBuffer.Length * sizeof(T));
@@ -206,6 +218,10 @@ void UActuatorManager::ApplyHeuristic(const FActionBuffers& ActionBuffersOut)
 void UActuatorManager::ExecuteActions()
 {
 	ReadyActuatorsForExecution();
+	if (ActionSequence->HasQueuedSteps())
+	{
+		PlayActionSequenceStep();
+	}
 
 	int32 ContinuousStart = 0;
 	int32 DiscreteStart = 0;
@@ -240,6 +256,22 @@ void UActuatorManager::ExecuteActions()
 	}
 }
 
+void UActuatorManager::PlayActionSequenceStep()
+{
+	auto PlayStep = [Step = ActionSequence->NumPlayed](const auto& Sequence, auto& Destination) {
+		if (Destination.Length <= 0)
+		{
+			return;
+		}
+		check(Sequence.Num() >= (Step + 1) * Destination.Length);
+		FMemory::Memcpy(Destination.Array->GetData() + Destination.Offset,
+			Sequence.GetData() + Step * Destination.Length, Destination.Length * sizeof(Sequence[0]));
+	};
+	PlayStep(ActionSequence->ContinuousActions, StoredActions.ContinuousActions);
+	PlayStep(ActionSequence->DiscreteActions, StoredActions.DiscreteActions);
+	ActionSequence->NumPlayed++;
+}
+
 void UActuatorManager::ResetData()
 {
 	if (!bReadyForExecution)
@@ -247,6 +279,7 @@ void UActuatorManager::ResetData()
 		return;
 	}
 	StoredActions.Clear();
+	ActionSequence->Reset();
 	for (int32 i = 0; i < Actuators.Num(); i++)
 	{
 		Actuators[i]->ResetData();
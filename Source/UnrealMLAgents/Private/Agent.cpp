@@ -91,6 +91,7 @@ void UAgent::NotifyAgentDone(EDoneReason DoneReason)
 	Info.bDone = true;
 	Info.bMaxStepReached = DoneReason == EDoneReason::MaxStepReached;
 	Info.GroupId = GroupId;
+	Info.ConsumedSteps = ActuatorManager ? ActuatorManager->GetNumPlayedSequenceSteps() : 0;
 	UpdateSensors();
 
 	// TODO CollectObservationChecker
@@ -268,6 +269,7 @@ void UAgent::SendInfoToBrain()
 	Info.bMaxStepReached = false;
 	Info.EpisodeId = EpisodeId;
 	Info.GroupId = GroupId;
+	Info.ConsumedSteps = ActuatorManager->GetNumPlayedSequenceSteps();
 
 	Brain->RequestDecision(Info, Sensors);
 }
@@ -359,7 +361,8 @@ void UAgent::AgentIncrementStep()
 
 void UAgent::AgentStep()
 {
-	if ((bRequestAction) && (Brain != nullptr))
+	// The steps of an action sequence are played even when the agent does not take actions between decisions
+	if ((Brain != nullptr) && (bRequestAction || ActuatorManager->HasQueuedActions()))
 	{
 		bRequestAction = false;
 		ActuatorManager->ExecuteActions();
@@ -0,0 +1,348 @@
+// Copyright © 2025 Stephane Capponi and individual contributors. All Rights Reserved.
+
+#include "UnrealMLAgents/Communicator/CommunicatorGateway.h"
+#include <algorithm>
+#include <chrono>
+
+FCommunicatorGateway::FCommunicatorGateway(const FCommunicatorGatewayParameters& InParameters)
+	: Parameters(InParameters)
+	, NumRequests(0)
+	, StepCount(0)
+	, MaxUpstreamMessageSize(0)
+	, bSessionEnded(false)
+	, bFailed(false)
+{
+	const int32 NumEnvironments = FMath::Max(Parameters.NumEnvironments, 1);
+	Parameters.NumEnvironments = NumEnvironments;
+	Requests.SetNum(NumEnvironments);
+	HasRequest.Init(false, NumEnvironments);
+	Responses.SetNum(NumEnvironments);
+	NumDecisions.SetNum(NumEnvironments);
+	Peers.SetNum(NumEnvironments);
+}
+
+bool FCommunicatorGateway::Run()
+{
+	grpc::ChannelArguments Arguments;
+	Arguments.SetMaxSendMessageSize(Parameters.MaxMessageSize);
+	Arguments.SetMaxReceiveMessageSize(Parameters.MaxMessageSize);
+	Channel = grpc::CreateCustomChannel(
+		TCHAR_TO_UTF8(*Parameters.TrainerAddress), grpc::InsecureChannelCredentials(), Arguments);
+	Stub = communicator_objects::UnrealToExternalProto::NewStub(Channel);
+
+	const std::string ListenAddress = "0.0.0.0:" + std::to_string(Parameters.Port);
+	grpc::ServerBuilder Builder;
+	Builder.AddListeningPort(ListenAddress, grpc::InsecureServerCredentials());
+	Builder.SetMaxReceiveMessageSize(Parameters.MaxMessageSize);
+	Builder.SetMaxSendMessageSize(Parameters.MaxMessageSize);
+	Builder.RegisterService(this);
+	Server = Builder.BuildAndStart();
+	if (Server == nullptr)
+	{
+		UE_LOG(LogTemp, Error, TEXT("The communicator gateway could not listen on port %d."), Parameters.Port);
+		return false;
+	}
+	UE_LOG(LogTemp, Log, TEXT("The communicator gateway waits for %d environments on port %d, trainer at %s."),
+		Parameters.NumEnvironments, Parameters.Port, *Parameters.TrainerAddress);
+
+	{
+		std::unique_lock<std::mutex> Lock(Mutex);
+		StepDone.wait(Lock, [this] { return bSessionEnded; });
+	}
+	// The environments got their last reply, the calls still open are cancelled
+	Server->Shutdown(std::chrono::system_clock::now() + std::chrono::seconds(1));
+	Server->Wait();
+	UE_LOG(LogTemp, Log, TEXT("The communicator gateway session ended after %lld steps."), StepCount);
+	return !bFailed;
+}
+
+grpc::Status FCommunicatorGateway::Exchange(grpc::ServerContext* Context,
+	const communicator_objects::UnrealMessageProto* Request, communicator_objects::UnrealMessageProto* Response)
+{
+	const int32 EnvIndex = FindEnvironment(*Context);
+	if (EnvIndex == INDEX_NONE)
+	{
+		return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+			"The environment sent no gateway index in range, start it with -mlAgentGatewayIndex");
+	}
+
+	std::unique_lock<std::mutex> Lock(Mutex);
+	if (bSessionEnded)
+	{
+		return grpc::Status(grpc::StatusCode::UNAVAILABLE, "The gateway session ended");
+	}
+	if (HasRequest[EnvIndex])
+	{
+		return grpc::Status(grpc::StatusCode::FAILED_PRECONDITION, "The environment already sent its step message");
+	}
+	const std::string Peer = Context->peer();
+	if (Peers[EnvIndex] != Peer)
+	{
+		UE_LOG(LogTemp, Log, TEXT("Environment %d %s the communicator gateway from %s."), EnvIndex,
+			Peers[EnvIndex].empty() ? TEXT("connected to") : TEXT("reconnected to"), UTF8_TO_TCHAR(Peer.c_str()));
+		Peers[EnvIndex] = Peer;
+	}
+	Requests[EnvIndex] = *Request;
+	HasRequest[EnvIndex] = true;
+	if (NumRequests++ == 0)
+	{
+		// The step is timed from its first message, a lost environment or trainer ends the session past it
+		StepDeadline = FStepClock::now()
+			+ std::chrono::duration_cast<FStepClock::duration>(std::chrono::duration<float>(Parameters.StepTimeout));
+	}
+
+	const int64 Step = StepCount;
+	if (NumRequests == Parameters.NumEnvironments)
+	{
+		// The last environment of the step exchanges with the trainer on behalf of every environment, without the
+		// lock so the others are still answered if the step times out
+		MergeRequests();
+		const FStepClock::time_point Deadline = StepDeadline;
+		Lock.unlock();
+		const bool bReceived = SendUpstream(Deadline);
+		Lock.lock();
+		if (!bSessionEnded)
+		{
+			if (bReceived)
+			{
+				SplitResponse();
+				StepCount++;
+			}
+			else
+			{
+				bFailed = true;
+				bSessionEnded = true;
+			}
+		}
+		NumRequests = 0;
+		for (bool& bHasRequest : HasRequest)
+		{
+			bHasRequest = false;
+		}
+		StepDone.notify_all();
+	}
+	else if (!StepDone.wait_until(Lock, StepDeadline, [this, Step] { return StepCount != Step || bSessionEnded; }))
+	{
+		UE_LOG(LogTemp, Error,
+			TEXT("Step %lld of the communicator gateway timed out after %.0f s, ending the session."), Step,
+			Parameters.StepTimeout);
+		bFailed = true;
+		bSessionEnded = true;
+		StepDone.notify_all();
+	}
+
+	if (StepCount == Step)
+	{
+		return grpc::Status(grpc::StatusCode::UNAVAILABLE, "The step did not complete");
+	}
+	Response->Swap(&Responses[EnvIndex]);
+	return grpc::Status::OK;
+}
+
+int32 FCommunicatorGateway::FindEnvironment(const grpc::ServerContext& Context) const
+{
+	const auto Entry = Context.client_metadata().find(FCommunicatorInitParameters::GatewayIndexMetadataKey);
+	if (Entry == Context.client_metadata().end())
+	{
+		return INDEX_NONE;
+	}
+	const std::string Value(Entry->second.data(), Entry->second.size());
+	const int32		  EnvIndex = FCString::Atoi(UTF8_TO_TCHAR(Value.c_str()));
+	return EnvIndex >= 0 && EnvIndex < Parameters.NumEnvironments ? EnvIndex : INDEX_NONE;
+}
+
+void FCommunicatorGateway::MergeRequests()
+{
+	MergedRequest.Clear();
+	communicator_objects::UnrealOutputProto& Output = *MergedRequest.mutable_unreal_output();
+	int32									 Status = 200;
+	for (int32 EnvIndex = 0; EnvIndex < Requests.Num(); EnvIndex++)
+	{
+		const communicator_objects::UnrealMessageProto& Request = Requests[EnvIndex];
+		// An environment leaving ends the session of every environment
+		if (Request.header().status() != 200)
+		{
+			Status = Request.header().status();
+		}
+		NumDecisions[EnvIndex].clear();
+		const communicator_objects::UnrealOutputProto& EnvOutput = Request.unreal_output();
+
+		if (EnvOutput.has_rl_initialization_output())
+		{
+			const communicator_objects::UnrealRLInitializationOutputProto& EnvInit =
+				EnvOutput.rl_initialization_output();
+			if (!Output.has_rl_initialization_output())
+			{
+				*Output.mutable_rl_initialization_output() = EnvInit;
+			}
+			else
+			{
+				// Every environment registers the same behaviors, the trainer only needs them once
+				communicator_objects::UnrealRLInitializationOutputProto& Init =
+					*Output.mutable_rl_initialization_output();
+				for (const communicator_objects::BrainParametersProto& Brain : EnvInit.brain_parameters())
+				{
+					const bool bKnown = std::any_of(Init.brain_parameters().begin(), Init.brain_parameters().end(),
+						[&Brain](const communicator_objects::BrainParametersProto& Known) {
+							return Known.brain_name() == Brain.brain_name();
+						});
+					if (!bKnown)
+					{
+						*Init.add_brain_parameters() = Brain;
+					}
+				}
+			}
+		}
+
+		if (EnvOutput.has_rl_output())
+		{
+			const communicator_objects::UnrealRLOutputProto& EnvRlOutput = EnvOutput.rl_output();
+			communicator_objects::UnrealRLOutputProto&		 RlOutput = *Output.mutable_rl_output();
+			const int32										 NumEnvironments = Parameters.NumEnvironments;
+			for (const auto& Pair : EnvRlOutput.agentinfos())
+			{
+				communicator_objects::UnrealRLOutputProto_ListAgentInfoProto& Agents =
+					(*RlOutput.mutable_agentinfos())[Pair.first];
+				int32&		Decisions = NumDecisions[EnvIndex][Pair.first];
+				const int32 FirstAgent = Agents.value_size();
+				for (const communicator_objects::AgentInfoProto& Info : Pair.second.value())
+				{
+					communicator_objects::AgentInfoProto& Agent = *Agents.add_value();
+					Agent = Info;
+					// Ids are interleaved so the ids of every environment stay unique and stable across steps
+					Agent.set_id(Info.id() * NumEnvironments + EnvIndex);
+					if (Info.group_id() != 0)
+					{
+						Agent.set_group_id(Info.group_id() * NumEnvironments + EnvIndex);
+					}
+					// Shared observations refer to an agent of the same environment, which now comes after the others
+					for (communicator_objects::ObservationProto& Observation : *Agent.mutable_observations())
+					{
+						if (Observation.shared_with() != 0)
+						{
+							Observation.set_shared_with(Observation.shared_with() + FirstAgent);
+						}
+					}
+					Decisions += Info.done() ? 0 : 1;
+				}
+			}
+			if (EnvRlOutput.packedagentinfos_size() > 0)
+			{
+				UE_LOG(LogTemp, Warning,
+					TEXT("Environment %d sent packed agents, the communicator gateway cannot merge them."), EnvIndex);
+			}
+			RlOutput.mutable_side_channel()->append(EnvRlOutput.side_channel());
+		}
+	}
+	MergedRequest.mutable_header()->set_status(Status);
+}
+
+void FCommunicatorGateway::SplitResponse()
+{
+	const communicator_objects::UnrealInputProto& Input = MergedResponse.unreal_input();
+	if (Input.has_rl_initialization_input())
+	{
+		const int32 TrainerMaxSize = Input.rl_initialization_input().max_message_size();
+		MaxUpstreamMessageSize =
+			TrainerMaxSize > ChunkOverheadBytes ? FMath::Min(TrainerMaxSize, Parameters.MaxMessageSize) : 0;
+	}
+
+	std::unordered_map<std::string, int32> ActionOffsets;
+	for (int32 EnvIndex = 0; EnvIndex < Responses.Num(); EnvIndex++)
+	{
+		communicator_objects::UnrealMessageProto& Response = Responses[EnvIndex];
+		Response.Clear();
+		*Response.mutable_header() = MergedResponse.header();
+		if (!MergedResponse.has_unreal_input())
+		{
+			continue;
+		}
+		communicator_objects::UnrealInputProto& EnvInput = *Response.mutable_unreal_input();
+
+		if (Input.has_rl_initialization_input())
+		{
+			communicator_objects::UnrealRLInitializationInputProto& Init = *EnvInput.mutable_rl_initialization_input();
+			Init = Input.rl_initialization_input();
+			// The trainer seeds one environment, each one behind the gateway gets its own seed
+			Init.set_seed(Init.seed() + EnvIndex);
+			// The messages of the environments are merged as they are, they must not be packed, streamed or chunked
+			Init.set_packed_observations(false);
+			Init.set_streaming_exchange(false);
+			Init.set_max_message_size(0);
+		}
+
+		if (Input.has_rl_input())
+		{
+			const communicator_objects::UnrealRLInputProto& RlInput = Input.rl_input();
+			communicator_objects::UnrealRLInputProto&		EnvRlInput = *EnvInput.mutable_rl_input();
+			EnvRlInput.set_command(RlInput.command());
+			EnvRlInput.set_side_channel(RlInput.side_channel());
+			// The actions of a behavior follow the order of its agents in the merged message
+			for (const std::pair<const std::string, int32>& Decisions : NumDecisions[EnvIndex])
+			{
+				const auto Actions = RlInput.agent_actions().find(Decisions.first);
+				if (Actions == RlInput.agent_actions().end())
+				{
+					continue;
+				}
+				communicator_objects::UnrealRLInputProto_ListAgentActionProto& EnvActions =
+					(*EnvRlInput.mutable_agent_actions())[Decisions.first];
+				int32&		Offset = ActionOffsets[Decisions.first];
+				const int32 End = FMath::Min(Offset + Decisions.second, Actions->second.value_size());
+				for (; Offset < End; Offset++)
+				{
+					*EnvActions.add_value() = Actions->second.value(Offset);
+				}
+			}
+		}
+	}
+
+	if (MergedRequest.header().status() != 200 || MergedResponse.header().status() != 200
+		|| Input.rl_input().command() == communicator_objects::QUIT)
+	{
+		bSessionEnded = true;
+	}
+}
+
+bool FCommunicatorGateway::SendUpstream(FStepClock::time_point Deadline)
+{
+	const size_t RequestBytes = MergedRequest.ByteSizeLong();
+	if (MaxUpstreamMessageSize <= 0 || RequestBytes <= static_cast<size_t>(MaxUpstreamMessageSize))
+	{
+		return CallTrainer(MergedRequest, MergedResponse, Deadline);
+	}
+
+	// The trainer acknowledges every slice but the last one, which gets the reply of the whole message
+	std::string Serialized;
+	MergedRequest.SerializeToString(&Serialized);
+	const size_t							 ChunkBytes = MaxUpstreamMessageSize - ChunkOverheadBytes;
+	communicator_objects::UnrealMessageProto Chunk;
+	for (size_t Offset = 0; Offset < Serialized.size(); Offset += ChunkBytes)
+	{
+		const size_t Length = FMath::Min(ChunkBytes, Serialized.size() - Offset);
+		Chunk.mutable_chunk()->assign(Serialized, Offset, Length);
+		Chunk.set_more_chunks(Offset + Length < Serialized.size());
+		if (!CallTrainer(Chunk, MergedResponse, Deadline))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool FCommunicatorGateway::CallTrainer(const communicator_objects::UnrealMessageProto& Request,
+	communicator_objects::UnrealMessageProto& Response, FStepClock::time_point Deadline)
+{
+	grpc::ClientContext Context;
+	// The environments may connect before the trainer listens, it is waited for until the end of the step
+	Context.set_wait_for_ready(true);
+	Context.set_deadline(Deadline);
+	const grpc::Status Status = Stub->Exchange(&Context, Request, &Response);
+	if (!Status.ok())
+	{
+		UE_LOG(LogTemp, Error, TEXT("The communicator gateway failed to exchange with the trainer: %s"),
+			UTF8_TO_TCHAR(Status.error_message().c_str()));
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,41 @@
+// Copyright © 2025 Stephane Capponi and individual contributors. All Rights Reserved.
+
+#include "UnrealMLAgents/Communicator/CommunicatorGatewayCommandlet.h"
+#include "UnrealMLAgents/Communicator/CommunicatorGateway.h"
+
+UCommunicatorGatewayCommandlet::UCommunicatorGatewayCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UCommunicatorGatewayCommandlet::Main(const FString& Params)
+{
+	FCommunicatorGatewayParameters Parameters;
+	FParse::Value(*Params, TEXT("mlAgentGatewayEnvs="), Parameters.NumEnvironments);
+	FParse::Value(*Params, TEXT("mlAgentPort="), Parameters.Port);
+	FParse::Value(*Params, TEXT("mlAgentTrainer="), Parameters.TrainerAddress);
+	FParse::Value(*Params, TEXT("mlAgentMaxMessageSize="), Parameters.MaxMessageSize);
+	FParse::Value(*Params, TEXT("mlAgentGatewayTimeout="), Parameters.StepTimeout);
+	if (Parameters.NumEnvironments < 1)
+	{
+		UE_LOG(LogTemp, Error, TEXT("The communicator gateway needs at least one environment."));
+		return 1;
+	}
+	if (Parameters.MaxMessageSize < FCommunicatorInitParameters::MinMaxMessageSize)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("The max message size %d is too small, using %d bytes."),
+			Parameters.MaxMessageSize, FCommunicatorInitParameters::MinMaxMessageSize);
+		Parameters.MaxMessageSize = FCommunicatorInitParameters::MinMaxMessageSize;
+	}
+	if (Parameters.StepTimeout <= 0.0f)
+	{
+		UE_LOG(LogTemp, Error, TEXT("The step timeout of the communicator gateway must be positive."));
+		return 1;
+	}
+
+	FCommunicatorGateway Gateway(Parameters);
+	return Gateway.Run() ? 0 : 1;
+}
@@ -0,0 +1,123 @@
+// Copyright © 2025 Stephane Capponi and individual contributors. All Rights Reserved.
+
+#include "UnrealMLAgents/Communicator/CommunicatorStats.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+
+FCommunicatorStats::FCommunicatorStats(int32 InWindowSize)
+	: WindowSize(FMath::Max(InWindowSize, 1)), NextIndex(0), NumSteps(0), NumPendingRows(0)
+{
+	Window.Reserve(WindowSize);
+}
+
+void FCommunicatorStats::RecordStep(const FCommunicatorStepTimings& Step)
+{
+	if (Window.Num() < WindowSize)
+	{
+		Window.Add(Step);
+	}
+	else
+	{
+		Window[NextIndex] = Step;
+		NextIndex = (NextIndex + 1) % WindowSize;
+	}
+
+	if (!CsvPath.IsEmpty())
+	{
+		PendingRows += FString::Printf(TEXT("%lld"), NumSteps);
+		for (int32 i = 0; i < static_cast<int32>(ECommunicatorPhase::Count); ++i)
+		{
+			PendingRows += FString::Printf(TEXT(",%.4f"), Step.Seconds[i] * 1000.0);
+		}
+		PendingRows += FString::Printf(TEXT(",%lld,%lld\n"), Step.BytesOut, Step.BytesIn);
+		if (++NumPendingRows >= CsvFlushInterval)
+		{
+			Flush();
+		}
+	}
+	NumSteps++;
+}
+
+FCommunicatorStatSummary FCommunicatorStats::GetPhaseSummary(ECommunicatorPhase Phase) const
+{
+	const int32 Index = static_cast<int32>(Phase);
+	return Summarize([Index](const FCommunicatorStepTimings& Step) { return Step.Seconds[Index] * 1000.0; });
+}
+
+FCommunicatorStatSummary FCommunicatorStats::GetStepSummary() const
+{
+	return Summarize([](const FCommunicatorStepTimings& Step) {
+		double Seconds = 0.0;
+		for (const double PhaseSeconds : Step.Seconds)
+		{
+			Seconds += PhaseSeconds;
+		}
+		return Seconds * 1000.0;
+	});
+}
+
+FCommunicatorStatSummary FCommunicatorStats::GetBytesOutSummary() const
+{
+	return Summarize([](const FCommunicatorStepTimings& Step) { return static_cast<double>(Step.BytesOut); });
+}
+
+FCommunicatorStatSummary FCommunicatorStats::GetBytesInSummary() const
+{
+	return Summarize([](const FCommunicatorStepTimings& Step) { return static_cast<double>(Step.BytesIn); });
+}
+
+FCommunicatorStatSummary FCommunicatorStats::Summarize(
+	TFunctionRef<double(const FCommunicatorStepTimings&)> Value) const
+{
+	FCommunicatorStatSummary Summary;
+	if (Window.Num() == 0)
+	{
+		return Summary;
+	}
+
+	TArray<double> Values;
+	Values.Reserve(Window.Num());
+	double Sum = 0.0;
+	for (const FCommunicatorStepTimings& Step : Window)
+	{
+		Values.Add(Value(Step));
+		Sum += Values.Last();
+	}
+	Values.Sort();
+
+	auto Percentile = [&Values](double Fraction) {
+		return Values[FMath::Min(FMath::FloorToInt32(Fraction * Values.Num()), Values.Num() - 1)];
+	};
+	Summary.Mean = Sum / Values.Num();
+	Summary.P50 = Percentile(0.5);
+	Summary.P90 = Percentile(0.9);
+	Summary.P99 = Percentile(0.99);
+	Summary.Max = Values.Last();
+	return Summary;
+}
+
+void FCommunicatorStats::SetCsvPath(const FString& InCsvPath)
+{
+	Flush();
+	CsvPath = InCsvPath;
+	if (!CsvPath.IsEmpty())
+	{
+		const FString Header = TEXT("step,build_ms,serialize_ms,exchange_ms,apply_ms,bytes_out,bytes_in\n");
+		if (!FFileHelper::SaveStringToFile(Header, *CsvPath))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Failed to write the communicator statistics to %s."), *CsvPath);
+			CsvPath.Empty();
+		}
+	}
+}
+
+void FCommunicatorStats::Flush()
+{
+	if (!CsvPath.IsEmpty() && NumPendingRows > 0)
+	{
+		FFileHelper::SaveStringToFile(PendingRows, *CsvPath, FFileHelper::EEncodingOptions::AutoDetect,
+			&IFileManager::Get(), FILEWRITE_Append);
+	}
+	PendingRows.Reset();
+	NumPendingRows = 0;
+}
@@ -0,0 +1,97 @@
+// Copyright © 2025 Stephane Capponi and individual contributors. All Rights Reserved.
+
+#include "UnrealMLAgents/Communicator/CommunicatorWorker.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/RunnableThread.h"
+
+FCommunicatorWorker::FCommunicatorWorker(FExchangeFunction InExchangeFunction)
+	: ExchangeFunction(MoveTemp(InExchangeFunction)), WorkEvent(FPlatformProcess::GetSynchEventFromPool(false)),
+	  ResultEvent(FPlatformProcess::GetSynchEventFromPool(false)), Thread(nullptr), bStopping(false)
+{
+}
+
+FCommunicatorWorker::~FCommunicatorWorker()
+{
+	Stop();
+	FPlatformProcess::ReturnSynchEventToPool(WorkEvent);
+	FPlatformProcess::ReturnSynchEventToPool(ResultEvent);
+}
+
+void FCommunicatorWorker::Start()
+{
+	if (Thread == nullptr)
+	{
+		Thread = FRunnableThread::Create(this, TEXT("MLAgentsCommunicator"), 0, TPri_AboveNormal);
+	}
+}
+
+void FCommunicatorWorker::Stop()
+{
+	if (Thread == nullptr)
+	{
+		return;
+	}
+	bStopping = true;
+	WorkEvent->Trigger();
+	Thread->WaitForCompletion();
+	delete Thread;
+	Thread = nullptr;
+}
+
+void FCommunicatorWorker::Submit(
+	const communicator_objects::UnrealMessageProto* Request, communicator_objects::UnrealMessageProto* Response)
+{
+	Jobs.Enqueue(FExchangeJob{ Request, Response });
+	WorkEvent->Trigger();
+}
+
+bool FCommunicatorWorker::TryGetResult(FExchangeResult& OutResult)
+{
+	return Results.Dequeue(OutResult);
+}
+
+FExchangeResult FCommunicatorWorker::WaitForResult()
+{
+	FExchangeResult Result;
+	while (!Results.Dequeue(Result))
+	{
+		ResultEvent->Wait();
+	}
+	return Result;
+}
+
+bool FCommunicatorWorker::WaitForResult(FExchangeResult& OutResult, double TimeoutSeconds)
+{
+	const double EndTime = FPlatformTime::Seconds() + TimeoutSeconds;
+	while (!Results.Dequeue(OutResult))
+	{
+		const double RemainingSeconds = EndTime - FPlatformTime::Seconds();
+		if (RemainingSeconds <= 0.0)
+		{
+			return false;
+		}
+		ResultEvent->Wait(static_cast<uint32>(FMath::CeilToInt(RemainingSeconds * 1000.0)));
+	}
+	return true;
+}
+
+uint32 FCommunicatorWorker::Run()
+{
+	while (!bStopping)
+	{
+		FExchangeJob Job;
+		if (!Jobs.Dequeue(Job))
+		{
+			WorkEvent->Wait();
+			continue;
+		}
+
+		// Serialization, the round trip to the trainer and parsing the reply all happen on this thread
+		FExchangeResult Result;
+		Result.bSucceeded = ExchangeFunction(*Job.Request, *Job.Response, Result.ErrorMessage, Result.Timings);
+		Results.Enqueue(MoveTemp(Result));
+		ResultEvent->Trigger();
+	}
+	return 0;
+}
@@ -0,0 +1,31 @@
+// Copyright © 2025 Stephane Capponi and individual contributors. All Rights Reserved.
+
+#include "UnrealMLAgents/Communicator/ReusableArena.h"
+
+FReusableArena::FReusableArena(int32 InitialBlockSize)
+{
+	Allocate(InitialBlockSize);
+}
+
+void FReusableArena::Reset()
+{
+	const uint64 SpaceAllocated = Arena->Reset();
+	if (SpaceAllocated > static_cast<uint64>(Block.Num()))
+	{
+		// The last step spilled into extra blocks, grow the retained block so the next one fits in it.
+		const uint64 NewSize = FMath::RoundUpToPowerOfTwo64(SpaceAllocated);
+		Allocate(static_cast<int32>(FMath::Min<uint64>(NewSize, MAX_int32)));
+	}
+}
+
+void FReusableArena::Allocate(int32 BlockSize)
+{
+	// The arena must be destroyed before the block it lives in is reallocated.
+	Arena.Reset();
+	Block.SetNumUninitialized(BlockSize);
+
+	google::protobuf::ArenaOptions Options;
+	Options.initial_block = reinterpret_cast<char*>(Block.GetData());
+	Options.initial_block_size = Block.Num();
+	Arena = MakeUnique<google::protobuf::Arena>(Options);
+}
@@ -1,18 +1,116 @@
 // Copyright © 2025 Stephane Capponi and individual contributors. All Rights Reserved.
 
 #include "UnrealMLAgents/Communicator/RpcCommunicator.h"
+#include "UnrealMLAgents/Academy.h"
+#include "UnrealMLAgents/SideChannels/SideChannelManager.h"
+#include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Misc/Compression.h"
 #include "Misc/CoreDelegates.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "HAL/PlatformOutputDevices.h"
 
 void URpcCommunicator::PostInitProperties()
 {
 	Super::PostInitProperties();
 	bIsOpen = false;
-	CurrentUnrealRlOutput = MakeUnique<communicator_objects::UnrealRLOutputProto>();
+	bUseArena = false;
+	bOverlapExchange = false;
+	bSharded = false;
+	ExchangeDeadline = 0.0f;
+	ExchangeContext = nullptr;
+	bExchangesCancelled = false;
+	QuitDeadline = 0.0;
+	NumMicroBatches = 1;
+	bMicroBatching = false;
+	MicroBatchSize = 0;
+	NumMicroBatchAgents = 0;
+	NumStepAgents = 0;
+	bSendSideChannels = true;
+	bReconnect = false;
+	bAwaitingTrainer = false;
+	NextReconnectTime = 0.0;
+	bCompressObservations = false;
+	bQuantizeObservations = false;
+	bDeltaObservations = false;
+	bPackObservations = false;
+	bActionSequences = false;
+	bSharedObservations = false;
+	bStreamExchange = false;
+	bRegisterObservationSpecs = false;
+	MaxStepMessageSize = 0;
+	bExchangeInFlight = false;
+	LastOverlappedStep = INDEX_NONE;
+	CreateStepBuffers();
 }
 
 bool URpcCommunicator::Initialize(
 	const FCommunicatorInitParameters& InitParameters, FUnrealRLInitParameters& InitParametersOut)
 {
+	if (InitParameters.bUseArenaMessages != bUseArena || InitParameters.bOverlapExchange != bOverlapExchange
+		|| InitParameters.bSharded != bSharded || InitParameters.ExchangeDeadline != ExchangeDeadline
+		|| InitParameters.MicroBatches != NumMicroBatches)
+	{
+		bUseArena = InitParameters.bUseArenaMessages;
+		bOverlapExchange = InitParameters.bOverlapExchange;
+		bSharded = InitParameters.bSharded;
+		ExchangeDeadline = InitParameters.ExchangeDeadline;
+		NumMicroBatches = FMath::Max(1, InitParameters.MicroBatches);
+		CreateStepBuffers();
+	}
+	bSendSideChannels = InitParameters.bSendSideChannels;
+	SocketPath = InitParameters.SocketPath;
+	if (InitParameters.bWriteStatsCsv)
+	{
+		// The statistics are written next to the log of the run, one file per shard
+		const FString LogFilename = FPlatformOutputDevices::GetAbsoluteLogFilename();
+		const FString Suffix = bSharded ? FString::Printf(TEXT("_CommunicatorStats_%d.csv"), InitParameters.Port)
+										: FString(TEXT("_CommunicatorStats.csv"));
+		Stats.SetCsvPath(
+			FPaths::Combine(FPaths::GetPath(LogFilename), FPaths::GetBaseFilename(LogFilename) + Suffix));
+	}
+	ConnectionParameters = InitParameters;
+	bReconnect = InitParameters.bReconnect;
+
+	communicator_objects::UnrealRLInputProto RlInput;
+	if (!Handshake(InitParametersOut, RlInput))
+	{
+		return false;
+	}
+	ProcessSideChannelData(RlInput);
+	SendCommandEvent(RlInput.command());
+
+	if (UsesWorker())
+	{
+		Worker = MakeUnique<FCommunicatorWorker>(
+			[this](const communicator_objects::UnrealMessageProto& Request,
+				communicator_objects::UnrealMessageProto& Response, std::string& OutErrorMessage,
+				FCommunicatorStepTimings& OutTimings) {
+				return TimedTransportExchange(Request, Response, OutErrorMessage, OutTimings);
+			});
+		Worker->Start();
+	}
+	else if (NumMicroBatches > 1)
+	{
+		// The micro-batches are written on the communicator thread while the game thread reads the replies
+		Worker = MakeUnique<FCommunicatorWorker>(
+			[this](const communicator_objects::UnrealMessageProto& Request,
+				communicator_objects::UnrealMessageProto& Response, std::string& OutErrorMessage,
+				FCommunicatorStepTimings& OutTimings) { return WriteMicroBatch(Request, OutErrorMessage, OutTimings); });
+		Worker->Start();
+	}
+
+	// Be sure to shut down the grpc channel when the application is quitting.
+	FCoreDelegates::OnPreExit.AddUObject(this, &URpcCommunicator::NotifyQuitAndShutDownChannel);
+
+	return true;
+}
+
+bool URpcCommunicator::Handshake(
+	FUnrealRLInitParameters& InitParametersOut, communicator_objects::UnrealRLInputProto& OutRlInput)
+{
+	const FCommunicatorInitParameters& InitParameters = ConnectionParameters;
 	communicator_objects::UnrealRLInitializationOutputProto AcademyParameters;
 	AcademyParameters.set_name(TCHAR_TO_UTF8(*InitParameters.Name));
 	AcademyParameters.set_package_version(TCHAR_TO_UTF8(*InitParameters.UnrealPackageVersion));
@@ -31,10 +129,14 @@ bool URpcCommunicator::Initialize(
 	}
 	catch (const std::exception& ex)
 	{
-		UE_LOG(LogTemp, Error, TEXT("Unexpected exception when trying to initialize communication: %s"),
-			UTF8_TO_TCHAR(ex.what()));
+		// Attempts to reach a new trainer fail quietly until one is listening
+		if (!bAwaitingTrainer)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Unexpected exception when trying to initialize communication: %s"),
+				UTF8_TO_TCHAR(ex.what()));
+		}
 		InitParametersOut = FUnrealRLInitParameters();
-		NotifyQuitAndShutDownChannel();
+		HandleDisconnect();
 		return false;
 	}
 
@@ -68,357 +170,1517 @@ bool URpcCommunicator::Initialize(
 		return false;
 	}
 
-	// UpdateEnvironmentWithInput(Input.rlinitializationinput()); // Implement this if needed
-	SendCommandEvent(Input.rl_input().command());
+	OutRlInput = Input.rl_input();
 	InitParametersOut.Seed = InitializationInput.rl_initialization_input().seed();
 	InitParametersOut.NumAreas = InitializationInput.rl_initialization_input().num_areas();
+	bCompressObservations = InitializationInput.rl_initialization_input().compressed_observations();
+	bQuantizeObservations = InitializationInput.rl_initialization_input().quantized_observations();
+	bDeltaObservations = InitializationInput.rl_initialization_input().delta_observations();
+	// Agents skipped past the deadline are flagged one by one, which the packed arrays have no room for
+	bPackObservations = InitializationInput.rl_initialization_input().packed_observations() && !UsesDeadline();
+	bActionSequences = InitializationInput.rl_initialization_input().action_sequences();
+	bSharedObservations = InitializationInput.rl_initialization_input().shared_observations();
+	bStreamExchange = InitializationInput.rl_initialization_input().streaming_exchange();
+	// The micro-batches are pipelined on the exchange stream, the other exchange modes send whole steps
+	bMicroBatching = NumMicroBatches > 1 && bStreamExchange && !UsesWorker();
+	if (NumMicroBatches > 1 && !bMicroBatching)
+	{
+		UE_LOG(LogTemp, Warning,
+			TEXT("Sending whole steps, micro-batches need a trainer serving the exchange stream and a synchronous "
+				 "exchange."));
+	}
+	bRegisterObservationSpecs = InitializationInput.rl_initialization_input().registered_observation_specs();
+	// Step messages are only split above what both ends accept, a chunk must also fit its own header
+	const int32 TrainerMaxSize = InitializationInput.rl_initialization_input().max_message_size();
+	MaxStepMessageSize =
+		TrainerMaxSize > ChunkOverheadBytes ? FMath::Min(TrainerMaxSize, InitParameters.MaxMessageSize) : 0;
 	InitParametersOut.PythonLibraryVersion =
 		UTF8_TO_TCHAR(InitializationInput.rl_initialization_input().package_version().c_str());
 	InitParametersOut.PythonCommunicationVersion =
 		UTF8_TO_TCHAR(InitializationInput.rl_initialization_input().communication_version().c_str());
+	return true;
+}
 
-	// Be sure to shut down the grpc channel when the application is quitting.
-	FCoreDelegates::OnPreExit.AddUObject(this, &URpcCommunicator::NotifyQuitAndShutDownChannel);
+bool URpcCommunicator::EstablishConnection(int32 Port)
+{
+	// A Unix domain socket avoids the loopback TCP stack when the trainer runs on the same host
+	std::string ServerAddress =
+		SocketPath.IsEmpty() ? "localhost:" + std::to_string(Port) : "unix:" + std::string(TCHAR_TO_UTF8(*SocketPath));
+	// A stream left by a previous trainer is released, the steps of the new one open their own
+	CloseStream();
+	bStreamExchange = false;
+	MaxStepMessageSize = 0;
+	grpc::ChannelArguments Arguments;
+	Arguments.SetMaxSendMessageSize(ConnectionParameters.MaxMessageSize);
+	Arguments.SetMaxReceiveMessageSize(ConnectionParameters.MaxMessageSize);
+	Channel = grpc::CreateCustomChannel(ServerAddress, grpc::InsecureChannelCredentials(), Arguments);
+	Stub = communicator_objects::UnrealToExternalProto::NewStub(Channel);
+	return Channel != nullptr && Stub != nullptr;
+}
+
+bool URpcCommunicator::TransportExchange(const communicator_objects::UnrealMessageProto& Request,
+	communicator_objects::UnrealMessageProto& Response, std::string& OutErrorMessage,
+	FCommunicatorStepTimings& OutTimings)
+{
+	const bool bChunked = PrepareRequest(Request, OutTimings);
+	const bool bReceived =
+		bChunked ? ExchangeChunks(Response, OutErrorMessage) : ExchangeMessage(Request, &Response, OutErrorMessage);
+	if (!bReceived)
+	{
+		return false;
+	}
+	OutTimings.BytesIn += Response.ByteSizeLong();
+	return true;
+}
+
+bool URpcCommunicator::PrepareRequest(
+	const communicator_objects::UnrealMessageProto& Request, FCommunicatorStepTimings& OutTimings)
+{
+	// gRPC encodes the request inside the call, only the sizing pass can be timed apart
+	FScopedCommunicatorTimer Timer(OutTimings, ECommunicatorPhase::Serialize);
+	const size_t			 RequestBytes = Request.ByteSizeLong();
+	OutTimings.BytesOut += RequestBytes;
+	// A request over the limit of the trainer is encoded here instead, once, then sent in slices
+	const bool bChunked = MaxStepMessageSize > 0 && RequestBytes > static_cast<size_t>(MaxStepMessageSize);
+	if (bChunked)
+	{
+		ChunkedRequest.resize(RequestBytes);
+		Request.SerializeWithCachedSizesToArray(reinterpret_cast<uint8*>(&ChunkedRequest[0]));
+	}
+	return bChunked;
+}
+
+bool URpcCommunicator::ExchangeMessage(const communicator_objects::UnrealMessageProto& Request,
+	communicator_objects::UnrealMessageProto* Response, std::string& OutErrorMessage)
+{
+	if (bStreamExchange)
+	{
+		return StreamExchange(Request, Response, OutErrorMessage);
+	}
+	grpc::ClientContext Context;
+	ApplyQuitDeadline(Context);
+	if (ConnectionParameters.GatewayIndex != INDEX_NONE)
+	{
+		// The gateway tells its environments apart by this index, their address changes when they reconnect
+		Context.AddMetadata(FCommunicatorInitParameters::GatewayIndexMetadataKey,
+			std::to_string(ConnectionParameters.GatewayIndex));
+	}
+	{
+		// Published so Dispose can cancel the call while the communicator thread waits on it
+		FScopeLock Lock(&StreamLock);
+		if (bExchangesCancelled)
+		{
+			OutErrorMessage = "The exchange was cancelled";
+			return false;
+		}
+		ExchangeContext = &Context;
+	}
+	grpc::Status Status = Stub->Exchange(&Context, Request, Response != nullptr ? Response : &ChunkAck);
+	{
+		FScopeLock Lock(&StreamLock);
+		ExchangeContext = nullptr;
+	}
+	if (!Status.ok())
+	{
+		OutErrorMessage = Status.error_message();
+		return false;
+	}
+	return true;
+}
+
+bool URpcCommunicator::ExchangeChunks(
+	communicator_objects::UnrealMessageProto& Response, std::string& OutErrorMessage)
+{
+	const size_t ChunkBytes = MaxStepMessageSize - ChunkOverheadBytes;
+	const size_t TotalBytes = ChunkedRequest.size();
+	for (size_t Offset = 0; Offset < TotalBytes; Offset += ChunkBytes)
+	{
+		const size_t Length = FMath::Min(ChunkBytes, TotalBytes - Offset);
+		const bool	 bLastChunk = Offset + Length == TotalBytes;
+		ChunkMessage.mutable_chunk()->assign(ChunkedRequest, Offset, Length);
+		ChunkMessage.set_more_chunks(!bLastChunk);
+		if (!ExchangeMessage(ChunkMessage, bLastChunk ? &Response : nullptr, OutErrorMessage))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool URpcCommunicator::WriteMicroBatch(const communicator_objects::UnrealMessageProto& Request,
+	std::string& OutErrorMessage, FCommunicatorStepTimings& OutTimings)
+{
+	const bool				 bChunked = PrepareRequest(Request, OutTimings);
+	FScopedCommunicatorTimer Timer(OutTimings, ECommunicatorPhase::Exchange);
+	bool					 bWritten = true;
+	if (bChunked)
+	{
+		const size_t ChunkBytes = MaxStepMessageSize - ChunkOverheadBytes;
+		const size_t TotalBytes = ChunkedRequest.size();
+		for (size_t Offset = 0; Offset < TotalBytes && bWritten; Offset += ChunkBytes)
+		{
+			const size_t Length = FMath::Min(ChunkBytes, TotalBytes - Offset);
+			ChunkMessage.mutable_chunk()->assign(ChunkedRequest, Offset, Length);
+			ChunkMessage.set_more_chunks(Offset + Length < TotalBytes);
+			bWritten = Stream->Write(ChunkMessage);
+		}
+	}
+	else
+	{
+		bWritten = Stream->Write(Request);
+	}
+	if (!bWritten)
+	{
+		// The game thread may be reading from the stream, it releases the stream once the reads fail
+		StreamContext->TryCancel();
+		OutErrorMessage = "The trainer ended the exchange stream";
+	}
+	return bWritten;
+}
+
+bool URpcCommunicator::OpenStream(std::string& OutErrorMessage)
+{
+	FScopeLock Lock(&StreamLock);
+	if (Stream == nullptr)
+	{
+		if (Stub == nullptr)
+		{
+			OutErrorMessage = "The channel to the trainer is shut down";
+			return false;
+		}
+		if (bExchangesCancelled)
+		{
+			OutErrorMessage = "The exchange was cancelled";
+			return false;
+		}
+		StreamContext = std::make_unique<grpc::ClientContext>();
+		ApplyQuitDeadline(*StreamContext);
+		Stream = Stub->ExchangeStream(StreamContext.get());
+	}
+	return true;
+}
+
+bool URpcCommunicator::StreamExchange(const communicator_objects::UnrealMessageProto& Request,
+	communicator_objects::UnrealMessageProto* Response, std::string& OutErrorMessage)
+{
+	if (!OpenStream(OutErrorMessage))
+	{
+		return false;
+	}
+	if (Stream->Write(Request) && (Response == nullptr || Stream->Read(Response)))
+	{
+		return true;
+	}
+
+	const grpc::Status Status = CloseStream();
+	OutErrorMessage = Status.ok() ? "The trainer ended the exchange stream" : Status.error_message();
+	return false;
+}
+
+grpc::Status URpcCommunicator::CloseStream()
+{
+	FScopeLock Lock(&StreamLock);
+	if (Stream == nullptr)
+	{
+		return grpc::Status::OK;
+	}
+	// Cancelling a call that already ended keeps its status, and unblocks Finish otherwise
+	StreamContext->TryCancel();
+	const grpc::Status Status = Stream->Finish();
+	Stream.reset();
+	StreamContext.reset();
+	return Status;
+}
+
+bool URpcCommunicator::TimedTransportExchange(const communicator_objects::UnrealMessageProto& Request,
+	communicator_objects::UnrealMessageProto& Response, std::string& OutErrorMessage,
+	FCommunicatorStepTimings& OutTimings)
+{
+	const double SerializeSeconds = OutTimings[ECommunicatorPhase::Serialize];
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	const bool	 bSucceeded = TransportExchange(Request, Response, OutErrorMessage, OutTimings);
+	const double TotalSeconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles);
+	OutTimings[ECommunicatorPhase::Exchange] +=
+		TotalSeconds - (OutTimings[ECommunicatorPhase::Serialize] - SerializeSeconds);
+	return bSucceeded;
+}
+
+bool URpcCommunicator::SendAndReceiveMessage(const communicator_objects::UnrealMessageProto& Request,
+	communicator_objects::UnrealMessageProto& Response, FCommunicatorStepTimings& OutTimings)
+{
+	std::string ErrorMessage;
+	if (!TimedTransportExchange(Request, Response, ErrorMessage, OutTimings))
+	{
+		HandleDisconnect();
+		throw std::runtime_error(ErrorMessage);
+	}
+
+	return Response.header().status() == 200;
+}
+
+void URpcCommunicator::CreateStepBuffers()
+{
+	CurrentStepBuffer = 0;
+	StepBuffers.SetNum(FMath::Max(UsesWorker() ? 2 : 1, NumMicroBatches));
+	for (FStepMessageBuffer& Buffer : StepBuffers)
+	{
+		Buffer.Create(bUseArena, BehaviorNames);
+	}
+	CurrentUnrealRlOutput = StepBuffers[CurrentStepBuffer].RlOutput;
+	BindBehaviorMessages();
+}
+
+communicator_objects::UnrealInputProto URpcCommunicator::Initialize(int32 Port,
+	const communicator_objects::UnrealOutputProto& UnrealOutput, communicator_objects::UnrealInputProto& UnrealInput)
+{
+	bIsOpen = true;
+
+	if (!EstablishConnection(Port))
+	{
+		throw std::runtime_error("Failed to establish connection");
+	}
+
+	communicator_objects::UnrealMessageProto Result;
+	communicator_objects::UnrealMessageProto InputMessage;
+	FCommunicatorStepTimings				 HandshakeTimings;
+
+	if (!SendAndReceiveMessage(WrapMessage(&UnrealOutput, 200), Result, HandshakeTimings))
+	{
+		throw std::runtime_error("Failed to receive proper response");
+	}
+
+	if (!SendAndReceiveMessage(WrapMessage(nullptr, 200), InputMessage, HandshakeTimings))
+	{
+		throw std::runtime_error("Failed to receive input message");
+	}
+
+	UnrealInput = InputMessage.unreal_input();
+
+	if (Result.header().status() != 200 || InputMessage.header().status() != 200)
+	{
+		HandleDisconnect();
+	}
+
+	return Result.unreal_input();
+}
+
+communicator_objects::UnrealMessageProto URpcCommunicator::WrapMessage(
+	const communicator_objects::UnrealOutputProto* Content, int32 Status)
+{
+	communicator_objects::UnrealMessageProto Message;
+	auto*									 Header = Message.mutable_header();
+	Header->set_status(Status);
+	if (Content != nullptr)
+	{
+		*Message.mutable_unreal_output() = *Content;
+	}
+	return Message;
+}
+
+bool URpcCommunicator::CheckCommunicationVersionAreCompatible(
+	const FString& UnrealCommunicationVersion, const FString& PythonApiVersion)
+{
+	TArray<FString> UnrealParts;
+	UnrealCommunicationVersion.ParseIntoArray(UnrealParts, TEXT("."));
+	int32 UnrealMajor = FCString::Atoi(*UnrealParts[0]);
+	int32 UnrealMinor = UnrealParts.Num() > 1 ? FCString::Atoi(*UnrealParts[1]) : 0;
+
+	TArray<FString> PythonParts;
+	PythonApiVersion.ParseIntoArray(PythonParts, TEXT("."));
+	int32 PythonMajor = FCString::Atoi(*PythonParts[0]);
+	int32 PythonMinor = PythonParts.Num() > 1 ? FCString::Atoi(*PythonParts[1]) : 0;
+
+	if (UnrealMajor == 0)
+	{
+		if (UnrealMajor != PythonMajor || UnrealMinor != PythonMinor)
+		{
+			return false;
+		}
+	}
+	else if (UnrealMajor != PythonMajor)
+	{
+		return false;
+	}
+	else if (UnrealMinor != PythonMinor)
+	{
+		// If a feature is used in Unreal but not supported in the trainer,
+		// we will warn at the point it's used. Don't warn here to avoid noise.
+	}
+
+	return true;
+}
+
+void URpcCommunicator::NotifyQuitAndShutDownChannel()
+{
+	QuitCommandReceived.Broadcast();
+	ShutDownChannel();
+}
+
+void URpcCommunicator::ShutDownChannel()
+{
+	try
+	{
+		// The stream may be in use by the communicator thread, it is only cancelled here and released by its owner
+		FScopeLock Lock(&StreamLock);
+		if (StreamContext != nullptr)
+		{
+			StreamContext->TryCancel();
+		}
+		Channel.reset();
+	}
+	catch (...)
+	{
+		// Catch all exceptions
+	}
+}
+
+void URpcCommunicator::HandleDisconnect()
+{
+	bIsOpen = false;
+	if (!bReconnect)
+	{
+		NotifyQuitAndShutDownChannel();
+		return;
+	}
+
+	ShutDownChannel();
+	if (!bAwaitingTrainer)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Lost the trainer on port %d, waiting for a new one."),
+			ConnectionParameters.Port);
+		bAwaitingTrainer = true;
+		NextReconnectTime = FPlatformTime::Seconds() + ReconnectIntervalSeconds;
+	}
+}
+
+void URpcCommunicator::TryReconnect()
+{
+	const double Now = FPlatformTime::Seconds();
+	if (Now < NextReconnectTime)
+	{
+		return;
+	}
+	NextReconnectTime = Now + ReconnectIntervalSeconds;
+
+	FUnrealRLInitParameters					 InitParametersOut;
+	communicator_objects::UnrealRLInputProto RlInput;
+	if (!Handshake(InitParametersOut, RlInput))
+	{
+		return;
+	}
+	UE_LOG(LogTemp, Log, TEXT("Connected to a new trainer on port %d, resuming from a reset."),
+		ConnectionParameters.Port);
+	bAwaitingTrainer = false;
+	ResetConnectionState();
+
+	// The new trainer expects a fresh environment whatever its first command, unless it asks to quit
+	ProcessSideChannelData(RlInput);
+	SendCommandEvent(
+		RlInput.command() == communicator_objects::QUIT ? communicator_objects::QUIT : communicator_objects::RESET);
+}
+
+void URpcCommunicator::ResetConnectionState()
+{
+	for (FBehaviorState& Behavior : BehaviorStates)
+	{
+		Behavior.OrderedAgents.Reset();
+		Behavior.InFlightAgents.Reset();
+		Behavior.MicroBatchAgents.Reset();
+		for (int32 Slot = 0; Slot < Behavior.SlotEpisodeIds.Num(); Slot++)
+		{
+			Behavior.HasActions[Slot] = false;
+			Behavior.StaleActions[Slot] = false;
+			Behavior.SkippedRewards[Slot] = 0.0f;
+			Behavior.SkippedGroupRewards[Slot] = 0.0f;
+			Behavior.DeltaBases[Slot].Reset();
+		}
+		// The new trainer only learns about the behaviors through their brain parameters
+		if (SentBrainKeys.Remove(Behavior.Name) > 0)
+		{
+			UnsentBrainKeys.Emplace(Behavior.Name, Behavior.ActionSpec);
+		}
+	}
+	SentBrainKeys.Reset();
+	bExchangeInFlight = false;
+	bNeedCommunicateThisStep = false;
+	MicroBatchSize = 0;
+	NumMicroBatchAgents = 0;
+	NumStepAgents = 0;
+	StepTimings = FCommunicatorStepTimings();
+	InFlightTimings = FCommunicatorStepTimings();
+	CreateStepBuffers();
+}
+
+FQuitCommandHandler& URpcCommunicator::OnQuitCommandReceived()
+{
+	return QuitCommandReceived;
+}
+
+FResetCommandHandler& URpcCommunicator::OnResetCommandReceived()
+{
+	return ResetCommandReceived;
+}
+
+FRLInputReceivedHandler& URpcCommunicator::OnRLInputReceived()
+{
+	return RLInputReceived;
+}
+
+int32 URpcCommunicator::SubscribeBrain(
+	const FString& Name, FActionSpec ActionSpec, const FActionBuffers& ActionBuffers, int32& OutAgentSlot)
+{
+	int32 Handle = BehaviorNames.IndexOfByKey(Name);
+	if (Handle == INDEX_NONE)
+	{
+		Handle = BehaviorNames.Add(Name);
+		FBehaviorState& Behavior = BehaviorStates.AddDefaulted_GetRef();
+		Behavior.Name = Name;
+		Behavior.Key = TCHAR_TO_UTF8(*Name);
+		Behavior.ActionMaskSize = ActionSpec.GetSumOfDiscreteBranchSizes();
+		Behavior.ActionSpec = ActionSpec;
+		Behavior.AgentInfos = &(*CurrentUnrealRlOutput->mutable_agentinfos())[Behavior.Key];
+		CacheActionSpec(Name, ActionSpec);
+	}
+	OutAgentSlot = AddAgentSlot(BehaviorStates[Handle], ActionSpec, ActionBuffers);
+	return Handle;
+}
+
+void URpcCommunicator::BindBehaviorMessages()
+{
+	for (FBehaviorState& Behavior : BehaviorStates)
+	{
+		Behavior.AgentInfos = &(*CurrentUnrealRlOutput->mutable_agentinfos())[Behavior.Key];
+		Behavior.PackedAgentInfos = nullptr;
+		Behavior.SharedObservations.Reset();
+	}
+	// The pending observations point into the previous step message
+	PendingObservations.Reset();
+}
+
+int32 URpcCommunicator::AddAgentSlot(
+	FBehaviorState& Behavior, const FActionSpec& ActionSpec, const FActionBuffers& ActionBuffers)
+{
+	FActionBuffers Actions = ActionBuffers;
+	if (Actions.ContinuousActions.Length != ActionSpec.NumContinuousActions
+		|| Actions.DiscreteActions.Length != ActionSpec.GetNumDiscreteActions())
+	{
+		// Agents without matching action storage get their own, allocated once
+		TSharedPtr<TArray<float>> ContinuousActions = MakeShared<TArray<float>>();
+		ContinuousActions->Init(0.0f, ActionSpec.NumContinuousActions);
+		TSharedPtr<TArray<int32>> DiscreteActions = MakeShared<TArray<int32>>();
+		DiscreteActions->Init(0, ActionSpec.GetNumDiscreteActions());
+		Actions = FActionBuffers(ContinuousActions, DiscreteActions);
+	}
+	Behavior.SlotEpisodeIds.Add(INDEX_NONE);
+	Behavior.HasActions.Add(false);
+	Behavior.ActionSequences.Add(nullptr);
+	Behavior.StaleActions.Add(false);
+	Behavior.SkippedRewards.Add(0.0f);
+	Behavior.SkippedGroupRewards.Add(0.0f);
+	Behavior.DeltaBases.AddDefaulted();
+	return Behavior.Actions.Add(Actions);
+}
+
+void URpcCommunicator::ResetAgentSlot(FBehaviorState& Behavior, int32 AgentSlot, int32 EpisodeId)
+{
+	Behavior.SlotEpisodeIds[AgentSlot] = EpisodeId;
+	Behavior.HasActions[AgentSlot] = false;
+	Behavior.StaleActions[AgentSlot] = false;
+	Behavior.SkippedRewards[AgentSlot] = 0.0f;
+	Behavior.SkippedGroupRewards[AgentSlot] = 0.0f;
+	Behavior.DeltaBases[AgentSlot].Reset();
+}
+
+void URpcCommunicator::CacheActionSpec(const FString& Name, FActionSpec ActionSpec)
+{
+	if (SentBrainKeys.Contains(Name))
+	{
+		return;
+	}
+	UnsentBrainKeys.Emplace(Name, ActionSpec);
+}
+
+void URpcCommunicator::PutObservations(
+	int32 BehaviorHandle, int32 AgentSlot, const FAgentInfo& Info, TArray<TScriptInterface<IISensor>>& Sensors)
+{
+	if (bAwaitingTrainer)
+	{
+		// Nobody would receive the observations until a new trainer connects
+		return;
+	}
+	if (!BehaviorStates.IsValidIndex(BehaviorHandle)
+		|| !BehaviorStates[BehaviorHandle].SlotEpisodeIds.IsValidIndex(AgentSlot))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Observations received for unknown agent %d of behavior handle %d."), AgentSlot,
+			BehaviorHandle);
+		return;
+	}
+	FBehaviorState& Behavior = BehaviorStates[BehaviorHandle];
+	const int32		Slot = AgentSlot;
+	if (Behavior.SlotEpisodeIds[Slot] != Info.EpisodeId)
+	{
+		// Nothing received or sent for the previous episode of the agent applies to the new one
+		ResetAgentSlot(Behavior, Slot, Info.EpisodeId);
+	}
+	if (UsesDeadline() && bExchangeInFlight && !Info.bDone)
+	{
+		// The reply of the trainer is late, the agent keeps acting on its last actions and its decision is skipped.
+		// Its rewards go out with its next observations, which are flagged so the trainer can discard them.
+		Behavior.StaleActions[Slot] = true;
+		Behavior.SkippedRewards[Slot] += Info.Reward;
+		Behavior.SkippedGroupRewards[Slot] += Info.GroupReward;
+		return;
+	}
+
+	FScopedCommunicatorTimer BuildTimer(StepTimings, ECommunicatorPhase::Build);
+	if (bPackObservations)
+	{
+		if (!PutPackedObservations(Behavior, BehaviorHandle, Info, Sensors))
+		{
+			// The agent is left out of the step, the trainer sends no actions for it
+			if (Info.bDone)
+			{
+				ResetAgentSlot(Behavior, Slot, INDEX_NONE);
+			}
+			return;
+		}
+	}
+	else
+	{
+		// Build the agent info directly inside the outgoing step message
+		communicator_objects::AgentInfoProto& AgentInfoProto = *Behavior.AgentInfos->add_value();
+		ToAgentInfoProto(Info, AgentInfoProto);
+		if (Behavior.StaleActions[Slot])
+		{
+			AgentInfoProto.set_stale_actions(true);
+			AgentInfoProto.set_reward(Info.Reward + Behavior.SkippedRewards[Slot]);
+			AgentInfoProto.set_group_reward(Info.GroupReward + Behavior.SkippedGroupRewards[Slot]);
+			Behavior.StaleActions[Slot] = false;
+			Behavior.SkippedRewards[Slot] = 0.0f;
+			Behavior.SkippedGroupRewards[Slot] = 0.0f;
+		}
+		AgentInfoProto.mutable_observations()->Reserve(Sensors.Num());
+		// The trainer forgets the agent once its episode ends, its last observations are sent in full
+		TArray<TArray<float>>* DeltaBases = bDeltaObservations && !Info.bDone ? &Behavior.DeltaBases[Slot] : nullptr;
+		if (DeltaBases)
+		{
+			DeltaBases->SetNum(Sensors.Num());
+		}
+		if (bRegisterObservationSpecs)
+		{
+			RegisterObservationSpecs(Behavior, Sensors);
+		}
+		const int32 AgentIndex = Behavior.AgentInfos->value_size() - 1;
+		for (int32 i = 0; i < Sensors.Num(); i++)
+		{
+			communicator_objects::ObservationProto& ObservationProto = *AgentInfoProto.add_observations();
+			const ESensorSharing Sharing = bSharedObservations ? Sensors[i]->GetSharing() : ESensorSharing::None;
+			FIntPoint			 SharedKey;
+			if (GetSharedObservationKey(Sharing, i, Info, SharedKey))
+			{
+				if (const int32* Owner = Behavior.SharedObservations.Find(SharedKey))
+				{
+					// Another agent of the step sent the observation, the trainer hands this agent its copy
+					ObservationProto.set_shared_with(*Owner + 1);
+					continue;
+				}
+				Behavior.SharedObservations.Add(SharedKey, AgentIndex);
+			}
+			// Shared sensors are always sent in full, the agent sending them changes from one step to the next
+			const bool bDelta = DeltaBases && Sharing == ESensorSharing::None
+				&& Sensors[i]->GetCompressionSpec().GetCompressionType() == ESensorCompressionType::Delta;
+			// The sensors of a finished agent are reset before the step message is sent, they write right away
+			if (!Info.bDone && Sensors[i]->IsThreadSafe())
+			{
+				PendingObservations.Add({ Sensors[i], &ObservationProto, BehaviorHandle, Slot, i, 0, bDelta });
+			}
+			else
+			{
+				GetObservationProto(Sensors[i], Scratch, ObservationProto, bDelta ? &(*DeltaBases)[i] : nullptr,
+					GetRegisteredSpec(Behavior, i));
+			}
+		}
+	}
+
+	bNeedCommunicateThisStep = true;
+	if (Info.bDone)
+	{
+		ResetAgentSlot(Behavior, Slot, INDEX_NONE);
+	}
+	else
+	{
+		Behavior.OrderedAgents.Add({ Slot, Info.EpisodeId });
+		if (!bOverlapExchange && !UsesDeadline())
+		{
+			// When the exchange is overlapped or has a deadline the agent keeps its last actions until the reply
+			// arrives
+			Behavior.HasActions[Slot] = false;
+		}
+	}
+
+	if (bMicroBatching)
+	{
+		// A full micro-batch goes out right away, the trainer decides for it while the next agents are put
+		NumStepAgents++;
+		NumMicroBatchAgents++;
+		if (bIsOpen && MicroBatchSize > 0 && NumMicroBatchAgents >= MicroBatchSize
+			&& CurrentStepBuffer < NumMicroBatches - 1)
+		{
+			// A micro-batch that cannot go out yet stays open, the step then fails at the decision instead
+			std::string ErrorMessage;
+			SubmitMicroBatch(false, ErrorMessage);
+		}
+	}
+}
+
+void URpcCommunicator::DecideBatch()
+{
+	if (bAwaitingTrainer)
+	{
+		TryReconnect();
+		return;
+	}
+	if (bOverlapExchange)
+	{
+		DecideBatchOverlapped();
+		return;
+	}
+	if (UsesDeadline())
+	{
+		DecideBatchWithDeadline();
+		return;
+	}
+	if (bSharded)
+	{
+		DecideShardBatches();
+		return;
+	}
+	if (bMicroBatching)
+	{
+		DecideMicroBatches();
+		return;
+	}
+	if (!bNeedCommunicateThisStep)
+	{
+		return;
+	}
+	bNeedCommunicateThisStep = false;
+	SendBatchedMessageHelper();
+}
+
+const FActionBuffers URpcCommunicator::GetActions(int32 BehaviorHandle, int32 AgentSlot)
+{
+	if (BehaviorStates.IsValidIndex(BehaviorHandle))
+	{
+		const FBehaviorState& Behavior = BehaviorStates[BehaviorHandle];
+		if (Behavior.HasActions.IsValidIndex(AgentSlot) && Behavior.HasActions[AgentSlot])
+		{
+			return Behavior.Actions[AgentSlot];
+		}
+	}
+	return FActionBuffers::Empty;
+}
+
+void URpcCommunicator::SetActionSequence(
+	int32 BehaviorHandle, int32 AgentSlot, const TSharedPtr<FActionSequence>& Sequence)
+{
+	if (!BehaviorStates.IsValidIndex(BehaviorHandle)
+		|| !BehaviorStates[BehaviorHandle].ActionSequences.IsValidIndex(AgentSlot))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("No agent in slot %d of behavior %d to register an action sequence for."),
+			AgentSlot, BehaviorHandle);
+		return;
+	}
+	BehaviorStates[BehaviorHandle].ActionSequences[AgentSlot] = Sequence;
+}
+
+void URpcCommunicator::SendBatchedMessageHelper()
+{
+	FStepMessageBuffer& Buffer = StepBuffers[CurrentStepBuffer];
+	TSharedPtr<communicator_objects::UnrealRLInitializationOutputProto> tempUnityRlInitializationOutput =
+		FinishStepMessage(Buffer, bSendSideChannels);
+
+	// The step message was built in place by PutObservations, it is sent as is
+	const communicator_objects::UnrealInputProto& Input = Exchange(Buffer);
+	UpdateSentActionSpec(tempUnityRlInitializationOutput.Get());
+	Buffer.ResetRequest(BehaviorNames);
+	CurrentUnrealRlOutput = Buffer.RlOutput;
+	BindBehaviorMessages();
+
+	ApplyRlInput(Input.rl_input(), false);
+	Stats.RecordStep(StepTimings);
+	StepTimings = FCommunicatorStepTimings();
+}
+
+TSharedPtr<communicator_objects::UnrealRLInitializationOutputProto> URpcCommunicator::FinishStepMessage(
+	FStepMessageBuffer& Buffer, bool bWithSideChannels)
+{
+	FScopedCommunicatorTimer BuildTimer(StepTimings, ECommunicatorPhase::Build);
+	WritePendingObservations();
+	PackObservations();
+	TSharedPtr<communicator_objects::UnrealRLInitializationOutputProto> InitializationOutput =
+		GetTempUnrealRlInitializationOutput();
+	if (InitializationOutput != nullptr)
+	{
+		*Buffer.Request->mutable_unreal_output()->mutable_rl_initialization_output() = *InitializationOutput.Get();
+	}
+	if (bWithSideChannels)
+	{
+		FSideChannelManager::GetSideChannelMessage(*Buffer.RlOutput->mutable_side_channel());
+	}
+	return InitializationOutput;
+}
 
+bool URpcCommunicator::SubmitMicroBatch(bool bLastOfStep, std::string& OutErrorMessage)
+{
+	// The stream is opened here so the game thread can read the replies of micro-batches still being written
+	if (!OpenStream(OutErrorMessage))
+	{
+		return false;
+	}
+	FStepMessageBuffer& Buffer = StepBuffers[CurrentStepBuffer];
+	TSharedPtr<communicator_objects::UnrealRLInitializationOutputProto> InitializationOutput =
+		FinishStepMessage(Buffer, bLastOfStep && bSendSideChannels);
+	Buffer.ResetResponse();
+	Worker->Submit(Buffer.Request, Buffer.Response);
+	UpdateSentActionSpec(InitializationOutput.Get());
+	NumMicroBatchAgents = 0;
+
+	// Keep the order of the agents of the micro-batch for its reply, and build the next one into the next buffer
+	for (FBehaviorState& Behavior : BehaviorStates)
+	{
+		Behavior.MicroBatchAgents.SetNum(StepBuffers.Num());
+		Swap(Behavior.MicroBatchAgents[CurrentStepBuffer], Behavior.OrderedAgents);
+		Behavior.OrderedAgents.Reset();
+	}
+	if (!bLastOfStep)
+	{
+		CurrentStepBuffer++;
+		CurrentUnrealRlOutput = StepBuffers[CurrentStepBuffer].RlOutput;
+		BindBehaviorMessages();
+	}
 	return true;
 }
 
-bool URpcCommunicator::EstablishConnection(int32 Port)
+void URpcCommunicator::DecideMicroBatches()
+{
+	if (!bNeedCommunicateThisStep)
+	{
+		return;
+	}
+	bNeedCommunicateThisStep = false;
+	// Every micro-batch before the current one was handed to the communicator thread
+	int32		NumSubmitted = CurrentStepBuffer;
+	std::string ErrorMessage;
+	bool		bFailed = !bIsOpen || !SubmitMicroBatch(true, ErrorMessage);
+	if (!bFailed)
+	{
+		NumSubmitted++;
+	}
+
+	// The trainer answers the micro-batches in order, each reply is applied while it decides for the next ones
+	bool bQuit = false;
+	for (int32 Batch = 0; Batch < NumSubmitted && !bFailed && !bQuit; Batch++)
+	{
+		FStepMessageBuffer& Buffer = StepBuffers[Batch];
+		{
+			FScopedCommunicatorTimer ExchangeTimer(StepTimings, ECommunicatorPhase::Exchange);
+			bFailed = !Stream->Read(Buffer.Response) || Buffer.Response->header().status() != 200;
+		}
+		if (bFailed)
+		{
+			break;
+		}
+		StepTimings.BytesIn += Buffer.Response->ByteSizeLong();
+		const communicator_objects::UnrealRLInputProto& RlInput = Buffer.Response->unreal_input().rl_input();
+		bQuit = RlInput.command() == communicator_objects::QUIT;
+		for (FBehaviorState& Behavior : BehaviorStates)
+		{
+			Swap(Behavior.InFlightAgents, Behavior.MicroBatchAgents[Batch]);
+		}
+		ApplyRlInput(RlInput, true);
+		StepTimings.Accumulate(InFlightTimings);
+		InFlightTimings = FCommunicatorStepTimings();
+	}
+
+	// Whatever is left to write would never be answered, the writes are cancelled before waiting for them
+	if (bFailed || bQuit)
+	{
+		FScopeLock Lock(&StreamLock);
+		if (StreamContext != nullptr)
+		{
+			StreamContext->TryCancel();
+		}
+	}
+	for (int32 Batch = 0; Batch < NumSubmitted; Batch++)
+	{
+		const FExchangeResult Result = Worker->WaitForResult();
+		StepTimings.Accumulate(Result.Timings);
+		if (!Result.bSucceeded && ErrorMessage.empty())
+		{
+			ErrorMessage = Result.ErrorMessage;
+		}
+	}
+
+	for (int32 Batch = 0; Batch <= CurrentStepBuffer; Batch++)
+	{
+		StepBuffers[Batch].ResetRequest(BehaviorNames);
+	}
+	for (FBehaviorState& Behavior : BehaviorStates)
+	{
+		Behavior.OrderedAgents.Reset();
+		Behavior.InFlightAgents.Reset();
+		for (TArray<FOrderedAgent>& Agents : Behavior.MicroBatchAgents)
+		{
+			Agents.Reset();
+		}
+	}
+	CurrentStepBuffer = 0;
+	CurrentUnrealRlOutput = StepBuffers[CurrentStepBuffer].RlOutput;
+	BindBehaviorMessages();
+	NumMicroBatchAgents = 0;
+	// The next step is split evenly from the agents of this one
+	MicroBatchSize = FMath::DivideAndRoundUp(NumStepAgents, NumMicroBatches);
+	NumStepAgents = 0;
+
+	if (bFailed || bQuit)
+	{
+		const grpc::Status Status = CloseStream();
+		if (bFailed && bIsOpen)
+		{
+			if (ErrorMessage.empty())
+			{
+				ErrorMessage = Status.ok() ? "The trainer ended the exchange stream" : Status.error_message();
+			}
+			UE_LOG(LogTemp, Error, TEXT("Communication Exception: %s. Disconnecting from trainer."),
+				UTF8_TO_TCHAR(ErrorMessage.c_str()));
+			HandleDisconnect();
+		}
+	}
+	Stats.RecordStep(StepTimings);
+	StepTimings = FCommunicatorStepTimings();
+}
+
+void URpcCommunicator::DecideBatchOverlapped()
+{
+	// Every remote policy calls DecideBatch, the exchange only runs on the first call of an Academy step
+	const int32 Step = UAcademy::GetInstance()->TotalStepCount;
+	if (Step == LastOverlappedStep)
+	{
+		return;
+	}
+	LastOverlappedStep = Step;
+
+	// The trainer answers requests in order, so new observations can only go out once the previous reply is in
+	if (bExchangeInFlight)
+	{
+		CollectBatchedMessage(bNeedCommunicateThisStep);
+	}
+
+	if (!bNeedCommunicateThisStep || !bIsOpen)
+	{
+		return;
+	}
+	bNeedCommunicateThisStep = false;
+	SubmitBatchedMessage();
+}
+
+void URpcCommunicator::DecideBatchWithDeadline()
+{
+	// Every remote policy calls DecideBatch, the exchange only runs on the first call of an Academy step
+	const int32 Step = UAcademy::GetInstance()->TotalStepCount;
+	if (Step == LastOverlappedStep)
+	{
+		return;
+	}
+	LastOverlappedStep = Step;
+
+	// A late reply is applied once it arrives, the step message waits for it since the trainer answers in order
+	if (bExchangeInFlight)
+	{
+		CollectBatchedMessage(false);
+		if (bExchangeInFlight)
+		{
+			return;
+		}
+	}
+
+	if (!bNeedCommunicateThisStep || !bIsOpen)
+	{
+		return;
+	}
+	bNeedCommunicateThisStep = false;
+	SubmitBatchedMessage();
+
+	FExchangeResult Result;
+	if (Worker->WaitForResult(Result, ExchangeDeadline))
+	{
+		ApplyExchangeResult(Result);
+		return;
+	}
+
+	// The agents in flight act on their last actions this step, the trainer learns it with their next observations
+	UE_LOG(LogTemp, Verbose, TEXT("The trainer missed the deadline of step %d, agents keep their last actions."), Step);
+	for (FBehaviorState& Behavior : BehaviorStates)
+	{
+		for (const FOrderedAgent& Agent : Behavior.InFlightAgents)
+		{
+			if (Behavior.SlotEpisodeIds[Agent.Slot] == Agent.EpisodeId)
+			{
+				Behavior.StaleActions[Agent.Slot] = true;
+			}
+		}
+	}
+}
+
+void URpcCommunicator::SetShardGroup(const TArray<URpcCommunicator*>& InShardGroup)
 {
-	std::string ServerAddress = "localhost:" + std::to_string(Port);
-	Channel = grpc::CreateChannel(ServerAddress, grpc::InsecureChannelCredentials());
-	Stub = communicator_objects::UnrealToExternalProto::NewStub(Channel);
-	return Channel != nullptr && Stub != nullptr;
+	ShardGroup.Reset();
+	for (URpcCommunicator* Shard : InShardGroup)
+	{
+		ShardGroup.Add(Shard);
+	}
 }
 
-bool URpcCommunicator::SendAndReceiveMessage(
-	const communicator_objects::UnrealMessageProto& Request, communicator_objects::UnrealMessageProto& Response)
+void URpcCommunicator::DecideShardBatches()
 {
-	grpc::ClientContext Context;
-	grpc::Status		Status = Stub->Exchange(&Context, Request, &Response);
-
-	if (!Status.ok())
+	// Every agent put its observations before the first decision of the step, so the first shard asked sends the
+	// step messages of the whole group and the others find nothing left to send
+	TArray<URpcCommunicator*, TInlineAllocator<8>> Submitted;
+	auto Submit = [&Submitted](URpcCommunicator* Shard) {
+		if (Shard != nullptr && Shard->bNeedCommunicateThisStep && Shard->bIsOpen && Shard->Worker.IsValid())
+		{
+			Shard->bNeedCommunicateThisStep = false;
+			Shard->SubmitBatchedMessage();
+			Submitted.Add(Shard);
+		}
+	};
+	if (ShardGroup.Num() == 0)
 	{
-		bIsOpen = false;
-		NotifyQuitAndShutDownChannel();
-		throw std::runtime_error(Status.error_message());
+		Submit(this);
+	}
+	for (const TWeakObjectPtr<URpcCommunicator>& Shard : ShardGroup)
+	{
+		Submit(Shard.Get());
 	}
 
-	return Response.header().status() == 200;
+	// The trainers work concurrently, the replies are applied as they are awaited
+	for (URpcCommunicator* Shard : Submitted)
+	{
+		Shard->CollectBatchedMessage(true);
+	}
 }
 
-communicator_objects::UnrealInputProto URpcCommunicator::Initialize(int32 Port,
-	const communicator_objects::UnrealOutputProto& UnrealOutput, communicator_objects::UnrealInputProto& UnrealInput)
+void URpcCommunicator::SubmitBatchedMessage()
 {
-	bIsOpen = true;
+	FStepMessageBuffer& Buffer = StepBuffers[CurrentStepBuffer];
+	TSharedPtr<communicator_objects::UnrealRLInitializationOutputProto> tempUnityRlInitializationOutput =
+		FinishStepMessage(Buffer, bSendSideChannels);
+
+	// The timings of the step follow it through the worker until its reply is applied
+	InFlightTimings = StepTimings;
+	StepTimings = FCommunicatorStepTimings();
+	Buffer.ResetResponse();
+	Worker->Submit(Buffer.Request, Buffer.Response);
+	bExchangeInFlight = true;
+	UpdateSentActionSpec(tempUnityRlInitializationOutput.Get());
 
-	if (!EstablishConnection(Port))
+	// Keep the order of the agents in flight for the reply, and build the next step into the other buffer
+	for (FBehaviorState& Behavior : BehaviorStates)
 	{
-		throw std::runtime_error("Failed to establish connection");
+		Swap(Behavior.InFlightAgents, Behavior.OrderedAgents);
+		Behavior.OrderedAgents.Reset();
 	}
+	CurrentStepBuffer = 1 - CurrentStepBuffer;
+	StepBuffers[CurrentStepBuffer].ResetRequest(BehaviorNames);
+	CurrentUnrealRlOutput = StepBuffers[CurrentStepBuffer].RlOutput;
+	BindBehaviorMessages();
+}
 
-	communicator_objects::UnrealMessageProto Result;
-	communicator_objects::UnrealMessageProto InputMessage;
-
-	if (!SendAndReceiveMessage(WrapMessage(&UnrealOutput, 200), Result))
+void URpcCommunicator::CollectBatchedMessage(bool bWait)
+{
+	FExchangeResult Result;
+	if (bWait)
 	{
-		throw std::runtime_error("Failed to receive proper response");
+		Result = Worker->WaitForResult();
 	}
-
-	if (!SendAndReceiveMessage(WrapMessage(nullptr, 200), InputMessage))
+	else if (!Worker->TryGetResult(Result))
 	{
-		throw std::runtime_error("Failed to receive input message");
+		return;
 	}
+	ApplyExchangeResult(Result);
+}
 
-	UnrealInput = InputMessage.unreal_input();
+void URpcCommunicator::ApplyExchangeResult(const FExchangeResult& Result)
+{
+	bExchangeInFlight = false;
 
-	if (Result.header().status() != 200 || InputMessage.header().status() != 200)
+	const FStepMessageBuffer& Buffer = StepBuffers[1 - CurrentStepBuffer];
+	if (!Result.bSucceeded || Buffer.Response->header().status() != 200)
 	{
-		bIsOpen = false;
-		NotifyQuitAndShutDownChannel();
+		UE_LOG(LogTemp, Error, TEXT("Communication Exception: %s. Disconnecting from trainer."),
+			UTF8_TO_TCHAR(Result.ErrorMessage.c_str()));
+		HandleDisconnect();
+		return;
 	}
 
-	return Result.unreal_input();
+	InFlightTimings.Accumulate(Result.Timings);
+	ApplyRlInput(Buffer.Response->unreal_input().rl_input(), true);
+	Stats.RecordStep(InFlightTimings);
+	InFlightTimings = FCommunicatorStepTimings();
 }
 
-communicator_objects::UnrealMessageProto URpcCommunicator::WrapMessage(
-	const communicator_objects::UnrealOutputProto* Content, int32 Status)
+void URpcCommunicator::ApplyRlInput(const communicator_objects::UnrealRLInputProto& RlInput, bool bInFlight)
 {
-	communicator_objects::UnrealMessageProto Message;
-	auto*									 Header = Message.mutable_header();
-	Header->set_status(Status);
-	if (Content != nullptr)
+	// Side channel messages may come with a reply that carries no actions, such as a reset
+	ProcessSideChannelData(RlInput);
+
+	// Check if AgentActions is present and not empty
+	if (RlInput.agent_actions().empty())
 	{
-		*Message.mutable_unreal_output() = *Content;
+		return;
 	}
-	return Message;
-}
-
-bool URpcCommunicator::CheckCommunicationVersionAreCompatible(
-	const FString& UnrealCommunicationVersion, const FString& PythonApiVersion)
-{
-	TArray<FString> UnrealParts;
-	UnrealCommunicationVersion.ParseIntoArray(UnrealParts, TEXT("."));
-	int32 UnrealMajor = FCString::Atoi(*UnrealParts[0]);
-	int32 UnrealMinor = UnrealParts.Num() > 1 ? FCString::Atoi(*UnrealParts[1]) : 0;
 
-	TArray<FString> PythonParts;
-	PythonApiVersion.ParseIntoArray(PythonParts, TEXT("."));
-	int32 PythonMajor = FCString::Atoi(*PythonParts[0]);
-	int32 PythonMinor = PythonParts.Num() > 1 ? FCString::Atoi(*PythonParts[1]) : 0;
+	SendCommandEvent(RlInput.command());
 
-	if (UnrealMajor == 0)
+	FScopedCommunicatorTimer ApplyTimer(bInFlight ? InFlightTimings : StepTimings, ECommunicatorPhase::Apply);
+	for (FBehaviorState& Behavior : BehaviorStates)
 	{
-		if (UnrealMajor != PythonMajor || UnrealMinor != PythonMinor)
+		TArray<FOrderedAgent>& Agents = bInFlight ? Behavior.InFlightAgents : Behavior.OrderedAgents;
+		const auto			   ActionsIt = RlInput.agent_actions().find(Behavior.Key);
+		if (ActionsIt != RlInput.agent_actions().end())
 		{
-			return false;
+			// Single pass over the reply, each agent's actions land in its own action storage
+			const auto& AgentActions = ActionsIt->second.value();
+			const int32 NumAgents = FMath::Min(Agents.Num(), AgentActions.size());
+			for (int32 i = 0; i < NumAgents; ++i)
+			{
+				// Agents whose episode ended while their observations were in flight no longer want these actions
+				const FOrderedAgent& Agent = Agents[i];
+				if (Behavior.SlotEpisodeIds[Agent.Slot] == Agent.EpisodeId)
+				{
+					FActionSequence* Sequence =
+						bActionSequences ? Behavior.ActionSequences[Agent.Slot].Get() : nullptr;
+					ScatterActions(AgentActions[i], Behavior.Actions[Agent.Slot], Sequence);
+					Behavior.HasActions[Agent.Slot] = true;
+				}
+			}
 		}
+		Agents.Reset();
 	}
-	else if (UnrealMajor != PythonMajor)
+}
+
+void URpcCommunicator::GetObservationProto(TScriptInterface<IISensor> Sensor, FObservationScratch& Scratch,
+	communicator_objects::ObservationProto& ObservationProto, TArray<float>* DeltaBase,
+	const FObservationSpec* RegisteredSpec) const
+{
+	ObservationWriter&						ObservationWriter = Scratch.Writer;
+	google::protobuf::RepeatedField<float>& ObservationScratch = Scratch.Floats;
+	const FObservationSpec		ObsSpec = Sensor->GetObservationSpec();
+	const FInplaceArray<int32>& Shape = ObsSpec.GetShape();
+	const int32					NumFloats = USensorExtensions::ObservationSize(ObsSpec);
+
+	const EObservationEncoding Encoding = bQuantizeObservations ? ObsSpec.GetEncoding() : EObservationEncoding::Float32;
+	const bool				   bCompress = bCompressObservations
+		&& Sensor->GetCompressionSpec().GetCompressionType() == ESensorCompressionType::Zlib
+		&& NumFloats * static_cast<int32>(sizeof(float)) >= MinCompressedObservationBytes;
+	if (DeltaBase)
 	{
-		return false;
+		ObservationScratch.Resize(NumFloats, 0.0f);
+		ObservationWriter.SetTarget(&ObservationScratch, Shape, 0);
+		Sensor->Write(ObservationWriter);
+
+		// Send the changed elements only while they are less than half of the observation, an index costs as much
+		// as the value it points to
+		int32 NumChanged = NumFloats;
+		if (DeltaBase->Num() == NumFloats)
+		{
+			NumChanged = 0;
+			for (int32 i = 0; i < NumFloats && NumChanged * 2 < NumFloats; i++)
+			{
+				NumChanged += ObservationScratch[i] != (*DeltaBase)[i] ? 1 : 0;
+			}
+		}
+		google::protobuf::RepeatedField<float>* FloatData = ObservationProto.mutable_float_data()->mutable_data();
+		if (NumChanged * 2 < NumFloats)
+		{
+			ObservationProto.set_is_delta(true);
+			ObservationProto.mutable_delta_indices()->Reserve(NumChanged);
+			FloatData->Reserve(NumChanged);
+			for (int32 i = 0; i < NumFloats; i++)
+			{
+				if (ObservationScratch[i] != (*DeltaBase)[i])
+				{
+					ObservationProto.add_delta_indices(i);
+					FloatData->Add(ObservationScratch[i]);
+				}
+			}
+		}
+		else
+		{
+			FloatData->Assign(ObservationScratch.begin(), ObservationScratch.end());
+		}
+		DeltaBase->SetNumUninitialized(NumFloats);
+		FMemory::Memcpy(DeltaBase->GetData(), ObservationScratch.data(), NumFloats * sizeof(float));
 	}
-	else if (UnrealMinor != PythonMinor)
+	else if (!bCompress && Encoding == EObservationEncoding::Float32)
 	{
-		// If a feature is used in Unreal but not supported in the trainer,
-		// we will warn at the point it's used. Don't warn here to avoid noise.
+		// Size the outgoing float buffer once and let the sensor write straight into it
+		google::protobuf::RepeatedField<float>* FloatData = ObservationProto.mutable_float_data()->mutable_data();
+		FloatData->Resize(NumFloats, 0.0f);
+		ObservationWriter.SetTarget(FloatData, Shape, 0);
+		Sensor->Write(ObservationWriter);
 	}
-
-	return true;
-}
-
-void URpcCommunicator::NotifyQuitAndShutDownChannel()
-{
-	QuitCommandReceived.Broadcast();
-	try
+	else
 	{
-		Channel.reset();
+		// The sensor writes into a scratch buffer that is encoded and compressed into the message
+		ObservationScratch.Resize(NumFloats, 0.0f);
+		ObservationWriter.SetTarget(&ObservationScratch, Shape, 0);
+		Sensor->Write(ObservationWriter);
+		if (Encoding == EObservationEncoding::Float32)
+		{
+			const int32 NumBytes = NumFloats * static_cast<int32>(sizeof(float));
+			if (!CompressObservation(ObservationScratch.data(), NumBytes, ObservationProto))
+			{
+				ObservationProto.mutable_float_data()->mutable_data()->Assign(
+					ObservationScratch.begin(), ObservationScratch.end());
+			}
+		}
+		else
+		{
+			EncodeObservation(ObservationWriter, ObsSpec, bCompress, Scratch.Encoded, ObservationProto);
+		}
 	}
-	catch (...)
+
+	// The trainer already knows the layout of the observations matching their registered spec
+	if (RegisteredSpec == nullptr || !ObsSpec.HasSameLayout(*RegisteredSpec))
 	{
-		// Catch all exceptions
+		SetObservationMetadata(Sensor, ObsSpec, ObservationProto);
 	}
 }
 
-FQuitCommandHandler& URpcCommunicator::OnQuitCommandReceived()
+void URpcCommunicator::SetObservationMetadata(TScriptInterface<IISensor> Sensor, const FObservationSpec& ObsSpec,
+	communicator_objects::ObservationProto& ObservationProto)
 {
-	return QuitCommandReceived;
+	SetObservationMetadata(ObsSpec, Sensor->GetName(), ObservationProto);
 }
 
-FResetCommandHandler& URpcCommunicator::OnResetCommandReceived()
+void URpcCommunicator::SetObservationMetadata(
+	const FObservationSpec& ObsSpec, const FString& SensorName, communicator_objects::ObservationProto& ObservationProto)
 {
-	return ResetCommandReceived;
-}
+	const FInplaceArray<int32>& Shape = ObsSpec.GetShape();
 
-FRLInputReceivedHandler& URpcCommunicator::OnRLInputReceived()
-{
-	return RLInputReceived;
-}
+	// Add the dimension properties to the observationProto
+	const FInplaceArray<EDimensionProperty>& DimensionProperties = ObsSpec.GetDimensionProperties();
+	ObservationProto.mutable_dimension_properties()->Reserve(Shape.GetLength());
+	for (int i = 0; i < Shape.GetLength(); i++)
+	{
+		ObservationProto.mutable_dimension_properties()->Add((int)DimensionProperties[i]);
+	}
 
-void URpcCommunicator::SubscribeBrain(const FString& Name, FActionSpec ActionSpec)
-{
-	if (BehaviorNames.Contains(Name))
+	ObservationProto.mutable_shape()->Reserve(Shape.GetLength());
+	for (int i = 0; i < Shape.GetLength(); i++)
 	{
-		return;
+		ObservationProto.mutable_shape()->Add(Shape[i]);
+	}
+
+	if (!SensorName.IsEmpty())
+	{
+		ObservationProto.set_name(TCHAR_TO_UTF8(*SensorName));
 	}
-	BehaviorNames.Add(Name);
-	CurrentUnrealRlOutput->mutable_agentinfos()->insert(std::make_pair(
-		std::string(TCHAR_TO_UTF8(*Name)), communicator_objects::UnrealRLOutputProto_ListAgentInfoProto()));
-	CacheActionSpec(Name, ActionSpec);
 }
 
-void URpcCommunicator::CacheActionSpec(const FString& Name, FActionSpec ActionSpec)
+void URpcCommunicator::RegisterObservationSpecs(
+	FBehaviorState& Behavior, const TArray<TScriptInterface<IISensor>>& Sensors)
 {
-	if (SentBrainKeys.Contains(Name))
+	if (Behavior.ObservationSpecs.Num() > 0)
 	{
 		return;
 	}
-	UnsentBrainKeys.Emplace(Name, ActionSpec);
+	Behavior.ObservationSpecs.Reserve(Sensors.Num());
+	Behavior.ObservationNames.Reserve(Sensors.Num());
+	for (const TScriptInterface<IISensor>& Sensor : Sensors)
+	{
+		Behavior.ObservationSpecs.Add(Sensor->GetObservationSpec());
+		Behavior.ObservationNames.Add(Sensor->GetName());
+	}
 }
 
-void URpcCommunicator::PutObservations(
-	const FString& BehaviorName, const FAgentInfo& Info, TArray<TScriptInterface<IISensor>>& Sensors)
+bool URpcCommunicator::GetSharedObservationKey(
+	ESensorSharing Sharing, int32 SensorIndex, const FAgentInfo& Info, FIntPoint& OutKey)
 {
-	communicator_objects::AgentInfoProto AgentInfoProto = ToAgentInfoProto(Info);
-	for (auto& sensor : Sensors)
+	switch (Sharing)
 	{
-		communicator_objects::ObservationProto ObsProto = GetObservationProto(sensor, ObsWriter);
-		*AgentInfoProto.add_observations() = ObsProto;
+		case ESensorSharing::Group:
+			// Agents without a group have nobody to share with
+			OutKey = FIntPoint(SensorIndex, Info.GroupId);
+			return Info.GroupId != 0;
+		case ESensorSharing::Behavior:
+			OutKey = FIntPoint(SensorIndex, 0);
+			return true;
+		default:
+			return false;
 	}
+}
 
-	auto& agentInfosMap = *CurrentUnrealRlOutput->mutable_agentinfos();
-	*agentInfosMap[TCHAR_TO_UTF8(*BehaviorName)].add_value() = AgentInfoProto;
-
-	bNeedCommunicateThisStep = true;
-	if (!OrderedAgentsRequestingDecisions.Contains(BehaviorName))
+const FObservationSpec* URpcCommunicator::GetRegisteredSpec(const FBehaviorState& Behavior, int32 SensorIndex) const
+{
+	if (!bRegisterObservationSpecs || !Behavior.ObservationSpecs.IsValidIndex(SensorIndex))
 	{
-		TArray<int> IntArray;
-		OrderedAgentsRequestingDecisions.Add(BehaviorName, IntArray);
+		return nullptr;
 	}
-	if (!Info.bDone)
+	return &Behavior.ObservationSpecs[SensorIndex];
+}
+
+void URpcCommunicator::EncodeObservation(const ObservationWriter& Writer, const FObservationSpec& ObsSpec,
+	bool bCompress, std::string& EncodedScratch, communicator_objects::ObservationProto& ObservationProto)
+{
+	const EObservationEncoding Encoding = ObsSpec.GetEncoding();
+	ObservationProto.set_encoding(static_cast<communicator_objects::ObservationEncodingProto>(Encoding));
+	if (Encoding == EObservationEncoding::UInt8)
 	{
-		OrderedAgentsRequestingDecisions[BehaviorName].Add(Info.EpisodeId);
+		ObservationProto.set_quantization_scale(ObsSpec.GetQuantizationScale());
+		ObservationProto.set_quantization_offset(ObsSpec.GetQuantizationOffset());
 	}
-	if (!LastActionsReceived.Contains(BehaviorName))
+	if (!bCompress)
 	{
-		TMap<int32, FActionBuffers> DictActionReceived;
-		LastActionsReceived.Add(BehaviorName, DictActionReceived);
+		Writer.Encode(ObsSpec, *ObservationProto.mutable_quantized_data());
 	}
-	LastActionsReceived[BehaviorName].Add(Info.EpisodeId, FActionBuffers::Empty);
-	if (Info.bDone)
+	else
 	{
-		LastActionsReceived[BehaviorName].Remove(Info.EpisodeId);
+		Writer.Encode(ObsSpec, EncodedScratch);
+		const int32 NumBytes = static_cast<int32>(EncodedScratch.size());
+		if (!CompressObservation(EncodedScratch.data(), NumBytes, ObservationProto))
+		{
+			ObservationProto.set_quantized_data(EncodedScratch);
+		}
 	}
 }
 
-void URpcCommunicator::DecideBatch()
+bool URpcCommunicator::PutPackedObservations(FBehaviorState& Behavior, int32 BehaviorHandle, const FAgentInfo& Info,
+	TArray<TScriptInterface<IISensor>>& Sensors)
 {
-	if (!bNeedCommunicateThisStep)
+	TArray<FPackedSensorObservations>& SensorObservations = Behavior.PackedObservations;
+	if (Behavior.PackedAgentInfos == nullptr)
 	{
-		return;
+		Behavior.PackedAgentInfos = &(*CurrentUnrealRlOutput->mutable_packedagentinfos())[Behavior.Key];
 	}
-	bNeedCommunicateThisStep = false;
-	SendBatchedMessageHelper();
-}
-
-const FActionBuffers URpcCommunicator::GetActions(const FString& Key, int32 AgentId)
-{
-	if (LastActionsReceived.Contains(Key))
+	communicator_objects::UnrealRLOutputProto_PackedAgentInfoProto& Packed = *Behavior.PackedAgentInfos;
+	const int32 AgentIndex = Packed.num_agents();
+	if (AgentIndex == 0)
 	{
-		if (LastActionsReceived[Key].Contains(AgentId))
+		// The first agent of the step describes the sensors for the whole behavior
+		SensorObservations.SetNum(Sensors.Num());
+		Packed.mutable_observations()->Reserve(Sensors.Num());
+		for (int32 i = 0; i < Sensors.Num(); i++)
 		{
-			return LastActionsReceived[Key][AgentId];
+			FPackedSensorObservations& SensorObs = SensorObservations[i];
+			SensorObs.ObsSpec = Sensors[i]->GetObservationSpec();
+			SensorObs.bCompress = Sensors[i]->GetCompressionSpec().GetCompressionType() == ESensorCompressionType::Zlib;
+			SensorObs.Sharing = bSharedObservations ? Sensors[i]->GetSharing() : ESensorSharing::None;
+			SensorObs.NumRows = 0;
+			SensorObs.Data.Clear();
+			SetObservationMetadata(Sensors[i], SensorObs.ObsSpec, *Packed.add_observations());
 		}
 	}
-	return FActionBuffers::Empty;
-}
-
-void URpcCommunicator::SendBatchedMessageHelper()
-{
-	communicator_objects::UnrealOutputProto Message;
-	Message.mutable_rl_output()->CopyFrom(*CurrentUnrealRlOutput);
-
-	TSharedPtr<communicator_objects::UnrealRLInitializationOutputProto> tempUnityRlInitializationOutput =
-		GetTempUnrealRlInitializationOutput();
-	if (tempUnityRlInitializationOutput != nullptr)
+	else if (SensorObservations.Num() != Sensors.Num())
 	{
-		*Message.mutable_rl_initialization_output() = *tempUnityRlInitializationOutput.Get();
+		UE_LOG(LogTemp, Error, TEXT("Agent %d of behavior %s has %d sensors, expected %d to pack its observations."),
+			Info.EpisodeId, *Behavior.Name, Sensors.Num(), SensorObservations.Num());
+		return false;
 	}
-
-	communicator_objects::UnrealInputProto Input = Exchange(&Message);
-	UpdateSentActionSpec(tempUnityRlInitializationOutput.Get());
-
-	// Iterate through the agentInfos map
-	for (auto& agentInfoPair : *CurrentUnrealRlOutput->mutable_agentinfos())
+	Packed.set_num_agents(AgentIndex + 1);
+
+	// Fixed-size values are appended in memory order, every platform Unreal ships on is little-endian
+	auto Append = [](std::string* Bytes, const auto Value) {
+		Bytes->append(reinterpret_cast<const char*>(&Value), sizeof(Value));
+	};
+	Append(Packed.mutable_ids(), static_cast<int32>(Info.EpisodeId));
+	Append(Packed.mutable_rewards(), Info.Reward);
+	Append(Packed.mutable_dones(), static_cast<uint8>(Info.bDone));
+	Append(Packed.mutable_max_step_reached(), static_cast<uint8>(Info.bMaxStepReached));
+	Append(Packed.mutable_group_ids(), static_cast<int32>(Info.GroupId));
+	Append(Packed.mutable_group_rewards(), Info.GroupReward);
+	if (Info.ConsumedSteps != 0 || !Packed.consumed_steps().empty())
 	{
-		// Clear the repeated field `value` in ListAgentInfoProto
-		agentInfoPair.second.mutable_value()->Clear();
+		// Left empty until an agent of the step played a sequence of actions, the agents before it played none
+		std::string* ConsumedSteps = Packed.mutable_consumed_steps();
+		ConsumedSteps->resize(static_cast<size_t>(AgentIndex) * sizeof(int32), 0);
+		Append(ConsumedSteps, static_cast<int32>(Info.ConsumedSteps));
 	}
 
-	// Get the RlInput field
-	const communicator_objects::UnrealRLInputProto& RlInput = Input.rl_input();
-
-	// Check if AgentActions is present and not empty
-	if (RlInput.agent_actions().empty())
+	const int32 MaskSize = Behavior.ActionMaskSize;
+	if (MaskSize > 0)
 	{
-		return;
+		// Agents without masks leave every action available
+		std::string* Masks = Packed.mutable_action_masks();
+		const size_t Start = Masks->size();
+		Masks->resize(Start + MaskSize, 0);
+		if (Info.DiscreteActionMasks.Num() == MaskSize)
+		{
+			for (int32 i = 0; i < MaskSize; i++)
+			{
+				(*Masks)[Start + i] = Info.DiscreteActionMasks[i] ? 1 : 0;
+			}
+		}
 	}
 
-	SendCommandEvent(RlInput.command());
-
-	for (const auto& brainName : RlInput.agent_actions())
+	for (int32 i = 0; i < Sensors.Num(); i++)
 	{
-		const FString& Key = brainName.first.c_str();
-		if (OrderedAgentsRequestingDecisions.Find(Key)->IsEmpty())
+		FPackedSensorObservations& SensorObs = SensorObservations[i];
+		int32					   Row = INDEX_NONE;
+		FIntPoint				   SharedKey;
+		const bool				   bShared = GetSharedObservationKey(SensorObs.Sharing, i, Info, SharedKey);
+		if (bShared)
+		{
+			const int32* SharedRow = Behavior.SharedObservations.Find(SharedKey);
+			Row = SharedRow ? *SharedRow : INDEX_NONE;
+		}
+		const bool bWrite = Row == INDEX_NONE;
+		if (bWrite)
+		{
+			Row = SensorObs.NumRows++;
+			if (bShared)
+			{
+				Behavior.SharedObservations.Add(SharedKey, Row);
+			}
+		}
+		if (SensorObs.Sharing != ESensorSharing::None)
+		{
+			// Every agent of a shared sensor gets the row holding its observation, written by the first agent only
+			Append(Packed.mutable_observations(i)->mutable_shared_rows(), Row);
+		}
+		if (!bWrite)
 		{
 			continue;
 		}
 
-		if (brainName.second.value().empty())
+		const int32 NumFloats = USensorExtensions::ObservationSize(SensorObs.ObsSpec);
+		SensorObs.Data.Resize(SensorObs.NumRows * NumFloats, 0.0f);
+		if (!Info.bDone && Sensors[i]->IsThreadSafe())
 		{
+			// The buffer is sized for this row already, so the deferred write never grows it
+			PendingObservations.Add({ Sensors[i], nullptr, BehaviorHandle, INDEX_NONE, i, Row, false });
 			continue;
 		}
+		Scratch.Writer.SetTarget(&SensorObs.Data, SensorObs.ObsSpec.GetShape(), Row * NumFloats);
+		Sensors[i]->Write(Scratch.Writer);
+	}
+	return true;
+}
 
-		const auto& agentActions = ToAgentActionList(brainName.second);
-		int			numAgents = OrderedAgentsRequestingDecisions.Find(Key)->Num();
-		for (int i = 0; i < numAgents; ++i)
+void URpcCommunicator::PackObservations()
+{
+	for (FBehaviorState& Behavior : BehaviorStates)
+	{
+		if (Behavior.PackedAgentInfos == nullptr || Behavior.PackedAgentInfos->num_agents() == 0)
 		{
-			const auto& agentAction = agentActions[i];
-			int			agentId = (*OrderedAgentsRequestingDecisions.Find(Key))[i];
-			if (LastActionsReceived.Find(Key)->Contains(agentId))
+			continue;
+		}
+		communicator_objects::UnrealRLOutputProto_PackedAgentInfoProto& Packed = *Behavior.PackedAgentInfos;
+		for (int32 i = 0; i < Behavior.PackedObservations.Num(); i++)
+		{
+			FPackedSensorObservations&			  SensorObs = Behavior.PackedObservations[i];
+			communicator_objects::ObservationProto& ObservationProto = *Packed.mutable_observations(i);
+			const int32 NumBytes = static_cast<int32>(SensorObs.Data.size() * sizeof(float));
+			const bool	bCompress =
+				bCompressObservations && SensorObs.bCompress && NumBytes >= MinCompressedObservationBytes;
+			if (bQuantizeObservations && SensorObs.ObsSpec.GetEncoding() != EObservationEncoding::Float32)
+			{
+				Scratch.Writer.SetTarget(&SensorObs.Data, SensorObs.ObsSpec.GetShape(), 0);
+				EncodeObservation(Scratch.Writer, SensorObs.ObsSpec, bCompress, Scratch.Encoded, ObservationProto);
+			}
+			else if (!bCompress || !CompressObservation(SensorObs.Data.data(), NumBytes, ObservationProto))
 			{
-				LastActionsReceived[Key].Add(agentId, agentAction);
+				// Uncompressed 32-bit floats travel as raw bytes too, the trainer reads them without a copy
+				ObservationProto.mutable_quantized_data()->assign(
+					reinterpret_cast<const char*>(SensorObs.Data.data()), NumBytes);
 			}
+			SensorObs.Data.Clear();
 		}
 	}
-
-	for (TPair<FString, TArray<int32>>& Pair : OrderedAgentsRequestingDecisions)
-	{
-		Pair.Value.Empty();
-	}
 }
 
-communicator_objects::ObservationProto URpcCommunicator::GetObservationProto(
-	TScriptInterface<IISensor> Sensor, ObservationWriter& ObservationWriter)
+void URpcCommunicator::WritePendingObservations()
 {
-
-	FObservationSpec								  ObsSpec = Sensor->GetObservationSpec();
-	FInplaceArray<int32>							  Shape = ObsSpec.GetShape();
-	int												  NumFloats = USensorExtensions::ObservationSize(Sensor);
-	communicator_objects::ObservationProto::FloatData FloatDataProto;
-
-	// Resize the float array
-	for (int i = 0; i < NumFloats; ++i)
+	const int32 NumPending = PendingObservations.Num();
+	if (NumPending == 0)
 	{
-		FloatDataProto.add_data(0.0f);
+		return;
 	}
-
-	// Assume observationWriter is an instance of a class that has SetTarget() method
-	ObservationWriter.SetTarget(FloatDataProto.mutable_data(), Sensor->GetObservationSpec().GetShape(), 0);
-	Sensor->Write(ObservationWriter);
-
-	communicator_objects::ObservationProto ObservationProto;
-	*ObservationProto.mutable_float_data() = FloatDataProto;
-
-	// Add the dimension properties to the observationProto
-	FInplaceArray<EDimensionProperty> DimensionProperties = ObsSpec.GetDimensionProperties();
-	for (int i = 0; i < Shape.GetLength(); i++)
+	// Each task writes a contiguous range with its own scratch buffers, few observations stay on the game thread
+	const int32 MaxTasks = FTaskGraphInterface::Get().GetNumWorkerThreads() + 1;
+	const int32 NumTasks = FMath::Clamp(NumPending / MinObservationsPerTask, 1, MaxTasks);
+	if (TaskScratches.Num() < NumTasks)
 	{
-		ObservationProto.mutable_dimension_properties()->Add((int)DimensionProperties[i]);
+		TaskScratches.SetNum(NumTasks);
 	}
+	ParallelFor(
+		NumTasks,
+		[this, NumPending, NumTasks](int32 Task) {
+			const int32 Begin = static_cast<int32>(static_cast<int64>(NumPending) * Task / NumTasks);
+			const int32 End = static_cast<int32>(static_cast<int64>(NumPending) * (Task + 1) / NumTasks);
+			for (int32 i = Begin; i < End; i++)
+			{
+				WritePendingObservation(PendingObservations[i], TaskScratches[Task]);
+			}
+		},
+		NumTasks == 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+	PendingObservations.Reset();
+}
 
-	for (int i = 0; i < Shape.GetLength(); i++)
+void URpcCommunicator::WritePendingObservation(const FPendingObservation& Pending, FObservationScratch& TaskScratch)
+{
+	FBehaviorState& Behavior = BehaviorStates[Pending.BehaviorHandle];
+	if (Pending.ObservationProto == nullptr)
 	{
-		ObservationProto.mutable_shape()->Add(Shape[i]);
+		FPackedSensorObservations& SensorObs = Behavior.PackedObservations[Pending.SensorIndex];
+		const int32				   NumFloats = USensorExtensions::ObservationSize(SensorObs.ObsSpec);
+		TaskScratch.Writer.SetTarget(
+			&SensorObs.Data, SensorObs.ObsSpec.GetShape(), Pending.PackedRow * NumFloats);
+		Pending.Sensor->Write(TaskScratch.Writer);
+		return;
 	}
+	TArray<float>* DeltaBase = Pending.bDelta ? &Behavior.DeltaBases[Pending.Slot][Pending.SensorIndex] : nullptr;
+	const FObservationSpec* RegisteredSpec = GetRegisteredSpec(Behavior, Pending.SensorIndex);
+	GetObservationProto(Pending.Sensor, TaskScratch, *Pending.ObservationProto, DeltaBase, RegisteredSpec);
+}
 
-	FString SensorName = Sensor->GetName();
-	if (!SensorName.IsEmpty())
+bool URpcCommunicator::CompressObservation(
+	const void* Data, int32 UncompressedSize, communicator_objects::ObservationProto& ObservationProto)
+{
+	int32		 CompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, UncompressedSize);
+	std::string* CompressedData = ObservationProto.mutable_compressed_data();
+	CompressedData->resize(CompressedSize);
+	if (!FCompression::CompressMemory(NAME_Zlib, CompressedData->data(), CompressedSize, Data, UncompressedSize)
+		|| CompressedSize >= UncompressedSize)
 	{
-		ObservationProto.set_name(TCHAR_TO_UTF8(*SensorName));
+		// Incompressible data is cheaper to send as is
+		ObservationProto.clear_compressed_data();
+		return false;
 	}
-	return ObservationProto;
+	CompressedData->resize(CompressedSize);
+	ObservationProto.set_compression_type(communicator_objects::ZLIB);
+	return true;
 }
 
-communicator_objects::UnrealInputProto URpcCommunicator::Exchange(
-	const communicator_objects::UnrealOutputProto* UnrealOutput)
+const communicator_objects::UnrealInputProto& URpcCommunicator::Exchange(FStepMessageBuffer& Buffer)
 {
 
 	if (!bIsOpen)
 	{
-		return communicator_objects::UnrealInputProto();
+		return communicator_objects::UnrealInputProto::default_instance();
 	}
 
 	try
 	{
-
-		communicator_objects::UnrealMessageProto InputMessage;
-		if (!SendAndReceiveMessage(WrapMessage(UnrealOutput, 200), InputMessage))
+		Buffer.ResetResponse();
+		if (!SendAndReceiveMessage(*Buffer.Request, *Buffer.Response, StepTimings))
 		{
 			throw std::runtime_error("Failed to receive input message");
 		}
 
-		return InputMessage.unreal_input();
+		return Buffer.Response->unreal_input();
 	}
 	catch (const std::exception& Ex)
 	{
@@ -426,9 +1688,8 @@ communicator_objects::UnrealInputProto URpcCommunicator::Exchange(
 		UE_LOG(LogTemp, Error, TEXT("Communication Exception: %s. Disconnecting from trainer."), *FString(Ex.what()));
 	}
 
-	bIsOpen = false;
-	NotifyQuitAndShutDownChannel();
-	return communicator_objects::UnrealInputProto();
+	HandleDisconnect();
+	return communicator_objects::UnrealInputProto::default_instance();
 }
 
 TSharedPtr<communicator_objects::UnrealRLInitializationOutputProto>
@@ -444,13 +1705,29 @@ URpcCommunicator::GetTempUnrealRlInitializationOutput()
 		if (CurrentUnrealRlOutput->agentinfos().contains(TCHAR_TO_UTF8(*BehaviorName)))
 		{
 
-			if (CurrentUnrealRlOutput->agentinfos().at(TCHAR_TO_UTF8(*BehaviorName)).value_size() > 0)
+			const auto PackedIt = CurrentUnrealRlOutput->packedagentinfos().find(TCHAR_TO_UTF8(*BehaviorName));
+			const bool bHasPackedAgents =
+				PackedIt != CurrentUnrealRlOutput->packedagentinfos().end() && PackedIt->second.num_agents() > 0;
+			if (CurrentUnrealRlOutput->agentinfos().at(TCHAR_TO_UTF8(*BehaviorName)).value_size() > 0
+				|| bHasPackedAgents)
 			{
 				if (!Output.IsValid())
 				{ // TUniquePtr uses IsValid() to check for nullptr
 					Output = MakeShared<communicator_objects::UnrealRLInitializationOutputProto>();
 				}
-				Output->mutable_brain_parameters()->Add(ToBrainParametersProto(ActionSpec, BehaviorName, true));
+				communicator_objects::BrainParametersProto& BrainParameters = *Output->add_brain_parameters();
+				BrainParameters = ToBrainParametersProto(ActionSpec, BehaviorName, true);
+				// The specs are registered once, the step messages then only carry the observation data
+				const int32 Handle = BehaviorNames.IndexOfByKey(BehaviorName);
+				if (bRegisterObservationSpecs && Handle != INDEX_NONE)
+				{
+					const FBehaviorState& Behavior = BehaviorStates[Handle];
+					for (int32 i = 0; i < Behavior.ObservationSpecs.Num(); i++)
+					{
+						SetObservationMetadata(Behavior.ObservationSpecs[i], Behavior.ObservationNames[i],
+							*BrainParameters.add_observation_specs());
+					}
+				}
 			}
 		}
 	}
@@ -511,9 +1788,23 @@ void URpcCommunicator::SendCommandEvent(communicator_objects::CommandProto Comma
 	{
 		case communicator_objects::RESET:
 		{
-			for (auto& Elem : OrderedAgentsRequestingDecisions)
+			for (FBehaviorState& Behavior : BehaviorStates)
+			{
+				Behavior.OrderedAgents.Reset();
+				Behavior.InFlightAgents.Reset();
+				// The trainer drops its delta bases on reset, the next observations must be sent in full
+				for (TArray<TArray<float>>& DeltaBases : Behavior.DeltaBases)
+				{
+					DeltaBases.Reset();
+				}
+			}
+			if (bOverlapExchange || UsesDeadline())
 			{
-				Elem.Value.Empty(); // Clears the TArray
+				// The observations gathered for this step predate the reset, they must not reach the trainer
+				StepBuffers[CurrentStepBuffer].ResetRequest(BehaviorNames);
+				CurrentUnrealRlOutput = StepBuffers[CurrentStepBuffer].RlOutput;
+				BindBehaviorMessages();
+				bNeedCommunicateThisStep = false;
 			}
 			if (ResetCommandReceived.IsBound())
 			{
@@ -531,48 +1822,63 @@ void URpcCommunicator::SendCommandEvent(communicator_objects::CommandProto Comma
 	}
 }
 
-TArray<FActionBuffers> URpcCommunicator::ToAgentActionList(
-	const communicator_objects::UnrealRLInputProto_ListAgentActionProto Proto)
+void URpcCommunicator::ProcessSideChannelData(const communicator_objects::UnrealRLInputProto& RlInput)
 {
-	TArray<FActionBuffers> AgentActions;
-	AgentActions.Reserve(Proto.value_size());
-
-	for (const auto& Ap : Proto.value())
+	const std::string& Data = RlInput.side_channel();
+	if (!Data.empty())
 	{
-		AgentActions.Add(ToActionBuffers(Ap));
+		FSideChannelManager::ProcessSideChannelData(
+			TArrayView<const uint8>(reinterpret_cast<const uint8*>(Data.data()), static_cast<int32>(Data.size())));
 	}
-
-	return AgentActions;
 }
 
-FActionBuffers URpcCommunicator::ToActionBuffers(const communicator_objects::AgentActionProto& Proto)
+void URpcCommunicator::ScatterActions(
+	const communicator_objects::AgentActionProto& Proto, FActionBuffers& ActionBuffers, FActionSequence* Sequence)
 {
-	// Convert the continuous actions from Proto
-	TSharedPtr<TArray<float>> ContinuousActions = MakeShared<TArray<float>>();
-	for (int i = 0; i < Proto.continuous_actions_size(); ++i)
+	auto Copy = [](const auto& Source, auto* Values, int32 Length) {
+		const int32 Count = FMath::Min(static_cast<int32>(Source.size()), Length);
+		FMemory::Memcpy(Values, Source.data(), Count * sizeof(*Values));
+		FMemory::Memzero(Values + Count, (Length - Count) * sizeof(*Values));
+	};
+	auto Scatter = [&Copy](const auto& Source, auto& Segment) {
+		if (Segment.Length > 0)
+		{
+			Copy(Source, Segment.Array->GetData() + Segment.Offset, Segment.Length);
+		}
+	};
+	Scatter(Proto.continuous_actions(), ActionBuffers.ContinuousActions);
+	Scatter(Proto.discrete_actions(), ActionBuffers.DiscreteActions);
+	if (Sequence == nullptr)
 	{
-		ContinuousActions->Add(Proto.continuous_actions(i));
+		return;
 	}
 
-	// Convert the discrete actions from Proto
-	TSharedPtr<TArray<int32>> DiscreteActions = MakeShared<TArray<int32>>();
-	for (int i = 0; i < Proto.discrete_actions_size(); ++i)
+	const int32 NumSteps = Proto.num_steps();
+	if (NumSteps <= 1)
 	{
-		DiscreteActions->Add(Proto.discrete_actions(i));
+		Sequence->Reset();
+		return;
 	}
-
-	return FActionBuffers(ContinuousActions, DiscreteActions);
+	// The sequence arrays keep their allocation from one decision to the next
+	auto Queue = [&Copy, NumSteps](const auto& Source, const auto& Segment, auto& Steps) {
+		Steps.SetNumUninitialized(NumSteps * FMath::Max(Segment.Length, 0));
+		Copy(Source, Steps.GetData(), Steps.Num());
+	};
+	Queue(Proto.continuous_actions(), ActionBuffers.ContinuousActions, Sequence->ContinuousActions);
+	Queue(Proto.discrete_actions(), ActionBuffers.DiscreteActions, Sequence->DiscreteActions);
+	Sequence->NumSteps = NumSteps;
+	Sequence->NumPlayed = 0;
 }
 
-communicator_objects::AgentInfoProto URpcCommunicator::ToAgentInfoProto(const FAgentInfo& Info)
+void URpcCommunicator::ToAgentInfoProto(const FAgentInfo& Info, communicator_objects::AgentInfoProto& AgentInfoProto)
 {
-	communicator_objects::AgentInfoProto AgentInfoProto;
 	AgentInfoProto.set_reward(Info.Reward);
 	AgentInfoProto.set_group_reward(Info.GroupReward);
 	AgentInfoProto.set_max_step_reached(Info.bMaxStepReached);
 	AgentInfoProto.set_done(Info.bDone);
 	AgentInfoProto.set_id(Info.EpisodeId);
 	AgentInfoProto.set_group_id(Info.GroupId);
+	AgentInfoProto.set_consumed_steps(Info.ConsumedSteps);
 
 	if (Info.DiscreteActionMasks.Num() != 0)
 	{
@@ -581,21 +1887,64 @@ communicator_objects::AgentInfoProto URpcCommunicator::ToAgentInfoProto(const FA
 			AgentInfoProto.mutable_action_mask()->Add(MaskValue);
 		}
 	}
-	return AgentInfoProto;
+}
+
+bool URpcCommunicator::ShouldAbandonExchange() const
+{
+	return bExchangesCancelled || (QuitDeadline > 0.0 && FPlatformTime::Seconds() > QuitDeadline);
+}
+
+void URpcCommunicator::CancelExchanges()
+{
+	FScopeLock Lock(&StreamLock);
+	bExchangesCancelled = true;
+	if (ExchangeContext != nullptr)
+	{
+		ExchangeContext->TryCancel();
+	}
+	if (StreamContext != nullptr)
+	{
+		StreamContext->TryCancel();
+	}
+}
+
+void URpcCommunicator::ApplyQuitDeadline(grpc::ClientContext& Context) const
+{
+	if (QuitDeadline > 0.0)
+	{
+		const double RemainingSeconds = FMath::Max(0.0, QuitDeadline - FPlatformTime::Seconds());
+		Context.set_deadline(std::chrono::system_clock::now()
+			+ std::chrono::milliseconds(static_cast<int64>(RemainingSeconds * 1000.0)));
+	}
 }
 
 void URpcCommunicator::Dispose()
 {
+	Stats.Flush();
+	QuitDeadline = FPlatformTime::Seconds() + QuitTimeoutSeconds;
+	if (Worker.IsValid())
+	{
+		// The trainer may never answer the exchange in flight, waiting for the thread would freeze the game thread
+		CancelExchanges();
+		Worker->Stop();
+		Worker.Reset();
+		bExchangeInFlight = false;
+		// A cancelled stream cannot carry the quit message, it goes over a new one
+		CloseStream();
+		bExchangesCancelled = false;
+	}
 	if (!bIsOpen)
 	{
+		CloseStream();
 		return;
 	}
 	try
 	{
-		// Assuming Stub is initialized and WrapMessage returns a valid object
 		communicator_objects::UnrealMessageProto Response;
-		grpc::ClientContext						 Context;
-		grpc::Status Status = Stub->Exchange(&Context, WrapMessage(nullptr, 400), &Response);
+		std::string								 ErrorMessage;
+		FCommunicatorStepTimings				 QuitTimings;
+		TransportExchange(WrapMessage(nullptr, 400), Response, ErrorMessage, QuitTimings);
+		CloseStream();
 		bIsOpen = false;
 	}
 	catch (...)
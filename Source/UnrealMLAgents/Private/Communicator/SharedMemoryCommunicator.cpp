@@ -0,0 +1,145 @@
+// Copyright © 2025 Stephane Capponi and individual contributors. All Rights Reserved.
+
+#include "UnrealMLAgents/Communicator/SharedMemoryCommunicator.h"
+#include "HAL/PlatformAtomics.h"
+#include "HAL/PlatformProcess.h"
+
+void USharedMemoryCommunicator::BeginDestroy()
+{
+	UnmapRegion();
+	Super::BeginDestroy();
+}
+
+FString USharedMemoryCommunicator::GetRegionName(int32 Port)
+{
+	return FString::Printf(TEXT("ueagents_%d"), Port);
+}
+
+bool USharedMemoryCommunicator::EstablishConnection(int32 Port)
+{
+	UnmapRegion();
+
+	const FString RegionName = GetRegionName(Port);
+	const uint32  AccessMode = static_cast<uint32>(FPlatformMemory::ESharedMemoryAccess::Read)
+		| static_cast<uint32>(FPlatformMemory::ESharedMemoryAccess::Write);
+
+	// Map the header first to learn the size of the areas the trainer allocated
+	FPlatformMemory::FSharedMemoryRegion* HeaderRegion =
+		FPlatformMemory::MapNamedSharedMemoryRegion(RegionName, false, AccessMode, sizeof(FSharedMemoryHeader));
+	if (HeaderRegion == nullptr)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Shared memory region %s was not found."), *RegionName);
+		return false;
+	}
+	const FSharedMemoryHeader* PeekHeader = static_cast<const FSharedMemoryHeader*>(HeaderRegion->GetAddress());
+	const bool	 bValidHeader = PeekHeader->Magic == SharedMemoryMagic && PeekHeader->Version == SharedMemoryVersion;
+	const uint64 RegionCapacity = PeekHeader->Capacity;
+	FPlatformMemory::UnmapNamedSharedMemoryRegion(HeaderRegion);
+
+	if (!bValidHeader)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Shared memory region %s has an unexpected header."), *RegionName);
+		return false;
+	}
+
+	Region = FPlatformMemory::MapNamedSharedMemoryRegion(
+		RegionName, false, AccessMode, sizeof(FSharedMemoryHeader) + 2 * RegionCapacity);
+	if (Region == nullptr)
+	{
+		return false;
+	}
+
+	uint8* Base = static_cast<uint8*>(Region->GetAddress());
+	Header = reinterpret_cast<FSharedMemoryHeader*>(Base);
+	Capacity = RegionCapacity;
+	RequestData = Base + sizeof(FSharedMemoryHeader);
+	ResponseData = RequestData + Capacity;
+	LastResponseSequence = FPlatformAtomics::AtomicRead(&Header->ResponseSequence);
+
+	UE_LOG(LogTemp, Log, TEXT("Communicating with the trainer through shared memory region %s."), *RegionName);
+	return true;
+}
+
+bool USharedMemoryCommunicator::TransportExchange(const communicator_objects::UnrealMessageProto& Request,
+	communicator_objects::UnrealMessageProto& Response, std::string& OutErrorMessage,
+	FCommunicatorStepTimings& OutTimings)
+{
+	if (Header == nullptr)
+	{
+		OutErrorMessage = "Shared memory region is not mapped";
+		return false;
+	}
+
+	size_t RequestSize = 0;
+	{
+		FScopedCommunicatorTimer Timer(OutTimings, ECommunicatorPhase::Serialize);
+		RequestSize = Request.ByteSizeLong();
+		if (RequestSize > Capacity)
+		{
+			OutErrorMessage = "Message of " + std::to_string(RequestSize)
+				+ " bytes exceeds the shared memory capacity of " + std::to_string(Capacity) + " bytes";
+			return false;
+		}
+
+		// Serialize straight into the shared area, the sizes were cached by ByteSizeLong
+		Request.SerializeWithCachedSizesToArray(RequestData);
+	}
+	OutTimings.BytesOut += RequestSize;
+	FPlatformAtomics::AtomicStore(&Header->RequestSize, static_cast<int64>(RequestSize));
+	FPlatformAtomics::InterlockedIncrement(&Header->RequestSequence);
+
+	const int64 Sequence = LastResponseSequence + 1;
+	if (!WaitForResponse(Sequence))
+	{
+		OutErrorMessage = "Trainer process exited or stopped answering";
+		return false;
+	}
+	LastResponseSequence = Sequence;
+
+	const int64 ResponseSize = FPlatformAtomics::AtomicRead(&Header->ResponseSize);
+	if (ResponseSize < 0 || static_cast<uint64>(ResponseSize) > Capacity
+		|| !Response.ParseFromArray(ResponseData, static_cast<int>(ResponseSize)))
+	{
+		OutErrorMessage = "Failed to parse the response from shared memory";
+		return false;
+	}
+	OutTimings.BytesIn += ResponseSize;
+	return true;
+}
+
+bool USharedMemoryCommunicator::WaitForResponse(int64 Sequence) const
+{
+	for (int32 Poll = 0; FPlatformAtomics::AtomicRead(&Header->ResponseSequence) < Sequence; ++Poll)
+	{
+		if (Poll < SpinCount)
+		{
+			FPlatformProcess::Yield();
+			continue;
+		}
+
+		// The trainer may take a while to compute the actions, back off and make sure it is still alive
+		FPlatformProcess::SleepNoStats(0.0001f);
+		if (ShouldAbandonExchange())
+		{
+			return false;
+		}
+		if (Poll % SpinCount == 0 && !FPlatformProcess::IsApplicationRunning(Header->OwnerProcessId))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void USharedMemoryCommunicator::UnmapRegion()
+{
+	if (Region != nullptr)
+	{
+		FPlatformMemory::UnmapNamedSharedMemoryRegion(Region);
+		Region = nullptr;
+	}
+	Header = nullptr;
+	RequestData = nullptr;
+	ResponseData = nullptr;
+	Capacity = 0;
+}
@@ -0,0 +1,72 @@
+// Copyright © 2025 Stephane Capponi and individual contributors. All Rights Reserved.
+
+#include "UnrealMLAgents/Communicator/StepMessageBuffer.h"
+
+void FStepMessageBuffer::Create(bool bInUseArena, const TArray<FString>& BehaviorNames)
+{
+	bUseArena = bInUseArena;
+	if (bUseArena)
+	{
+		OutputArena = MakeUnique<FReusableArena>(InitialArenaBlockSize);
+		InputArena = MakeUnique<FReusableArena>(InitialArenaBlockSize);
+		Request = google::protobuf::Arena::CreateMessage<communicator_objects::UnrealMessageProto>(OutputArena->Get());
+		Response = google::protobuf::Arena::CreateMessage<communicator_objects::UnrealMessageProto>(InputArena->Get());
+		HeapRequest.Reset();
+		HeapResponse.Reset();
+	}
+	else
+	{
+		HeapRequest = MakeUnique<communicator_objects::UnrealMessageProto>();
+		HeapResponse = MakeUnique<communicator_objects::UnrealMessageProto>();
+		Request = HeapRequest.Get();
+		Response = HeapResponse.Get();
+		OutputArena.Reset();
+		InputArena.Reset();
+	}
+	InitRequest(BehaviorNames);
+}
+
+void FStepMessageBuffer::InitRequest(const TArray<FString>& BehaviorNames)
+{
+	Request->mutable_header()->set_status(200);
+	RlOutput = Request->mutable_unreal_output()->mutable_rl_output();
+	for (const FString& Name : BehaviorNames)
+	{
+		(*RlOutput->mutable_agentinfos())[TCHAR_TO_UTF8(*Name)];
+	}
+}
+
+void FStepMessageBuffer::ResetRequest(const TArray<FString>& BehaviorNames)
+{
+	if (bUseArena)
+	{
+		// Everything built during the step is released at once, the arena keeps its memory for the next step.
+		OutputArena->Reset();
+		Request = google::protobuf::Arena::CreateMessage<communicator_objects::UnrealMessageProto>(OutputArena->Get());
+		InitRequest(BehaviorNames);
+		return;
+	}
+
+	for (auto& AgentInfoPair : *RlOutput->mutable_agentinfos())
+	{
+		// Clearing the repeated field keeps the cleared AgentInfoProto objects around for reuse
+		AgentInfoPair.second.mutable_value()->Clear();
+	}
+	for (auto& PackedPair : *RlOutput->mutable_packedagentinfos())
+	{
+		PackedPair.second.Clear();
+	}
+	RlOutput->clear_side_channel();
+	Request->mutable_unreal_output()->clear_rl_initialization_output();
+}
+
+void FStepMessageBuffer::ResetResponse()
+{
+	if (bUseArena)
+	{
+		InputArena->Reset();
+		Response = google::protobuf::Arena::CreateMessage<communicator_objects::UnrealMessageProto>(InputArena->Get());
+		return;
+	}
+	Response->Clear();
+}
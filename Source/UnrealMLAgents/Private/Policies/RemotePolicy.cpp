@@ -7,20 +7,27 @@ void URemotePolicy::Initialize(
 	UActuatorManager* InActuatorManager, const FActionSpec& InActionSpec, const FString& InFullyQualifiedBehaviorName)
 {
 	FullyQualifiedBehaviorName = InFullyQualifiedBehaviorName;
-	Communicator = UAcademy::GetInstance()->RpcCommunicator;
+	Communicator = UAcademy::GetInstance()->GetCommunicator(FullyQualifiedBehaviorName);
 	if (Communicator)
 	{
-		Communicator->SubscribeBrain(FullyQualifiedBehaviorName, InActionSpec);
+		// The actions are decoded straight into the stored actions of the actuators
+		const FActionBuffers ActionBuffers =
+			InActuatorManager ? InActuatorManager->GetStoredActions() : FActionBuffers();
+		BehaviorHandle =
+			Communicator->SubscribeBrain(FullyQualifiedBehaviorName, InActionSpec, ActionBuffers, AgentSlot);
+		if (InActuatorManager)
+		{
+			Communicator->SetActionSequence(BehaviorHandle, AgentSlot, InActuatorManager->GetActionSequence());
+		}
 	}
 	ActionSpec = InActionSpec;
 }
 
 void URemotePolicy::RequestDecision(const FAgentInfo& Info, TArray<TScriptInterface<IISensor>>& Sensors)
 {
-	AgentId = Info.EpisodeId;
 	if (Communicator)
 	{
-		Communicator->PutObservations(FullyQualifiedBehaviorName, Info, Sensors);
+		Communicator->PutObservations(BehaviorHandle, AgentSlot, Info, Sensors);
 	}
 }
 
@@ -29,7 +36,7 @@ const FActionBuffers& URemotePolicy::DecideAction()
 	if (Communicator)
 	{
 		Communicator->DecideBatch();
-		const FActionBuffers Actions = Communicator->GetActions(FullyQualifiedBehaviorName, AgentId);
+		const FActionBuffers Actions = Communicator->GetActions(BehaviorHandle, AgentSlot);
 		LastActionBuffer = Actions.IsEmpty() ? FActionBuffers::Empty : Actions;
 	}
 	return LastActionBuffer;
@@ -24,9 +24,15 @@ FObservationSpec URaySensor::GetObservationSpec()
 	return _ObservationSpec;
 }
 
+FCompressionSpec URaySensor::GetCompressionSpec()
+{
+	return FCompressionSpec(_RayInput.CompressionType);
+}
+
 void URaySensor::SetNumObservations(int32 NumberObservations)
 {
 	_ObservationSpec = FObservationSpec::Vector(NumberObservations);
+	_ObservationSpec.SetEncoding(_RayInput.Encoding, _RayInput.QuantizationScale, _RayInput.QuantizationOffset);
 	_Observations.SetNum(NumberObservations);
 }
 
@@ -25,6 +25,10 @@ FRayInput URaySensorComponent::GetRayInput()
 	RayInput.RayAxis = RayAxis;
 	RayInput.StartOffset = StartOffset;
 	RayInput.YawOffset = YawOffset;
+	RayInput.CompressionType = CompressionType;
+	RayInput.Encoding = Encoding;
+	RayInput.QuantizationScale = QuantizationScale;
+	RayInput.QuantizationOffset = QuantizationOffset;
 	return RayInput;
 }
 
@@ -0,0 +1,122 @@
+// Copyright © 2025 Stephane Capponi and individual contributors. All Rights Reserved.
+
+#include "UnrealMLAgents/SideChannels/EnvironmentParameters.h"
+
+// 534c891e-810f-11ea-a9d0-822485860400, shared with the Python EnvironmentParametersChannel
+FEnvironmentParameters::FEnvironmentParameters() : FSideChannel(FGuid(0x534c891e, 0x810f11ea, 0xa9d08224, 0x85860400))
+{
+}
+
+float FEnvironmentParameters::GetWithDefault(const FString& Key, float DefaultValue)
+{
+	FParameter* Parameter = Parameters.Find(Key);
+	if (Parameter == nullptr)
+	{
+		return DefaultValue;
+	}
+	return Parameter->bSampled ? Sample(*Parameter) : Parameter->Value;
+}
+
+void FEnvironmentParameters::RegisterCallback(const FString& Key, TFunction<void(float)> Callback)
+{
+	Callbacks.Add(Key, MoveTemp(Callback));
+}
+
+TArray<FString> FEnvironmentParameters::ListParameters() const
+{
+	TArray<FString> Keys;
+	Parameters.GetKeys(Keys);
+	return Keys;
+}
+
+void FEnvironmentParameters::OnMessageReceived(FIncomingMessage& Message)
+{
+	const FString Key = Message.ReadString();
+	if (Key.IsEmpty())
+	{
+		UE_LOG(LogTemp, Error, TEXT("An environment parameter without a name was received from the trainer."));
+		return;
+	}
+	const EParameterType Type = static_cast<EParameterType>(Message.ReadInt32());
+	FParameter			 Parameter;
+	if (Type == EParameterType::Float)
+	{
+		Parameter.Value = Message.ReadFloat32();
+	}
+	else if (Type == EParameterType::Sampler)
+	{
+		Parameter.bSampled = true;
+		Parameter.Random.Initialize(Message.ReadInt32());
+		Parameter.Sampler = static_cast<ESamplerType>(Message.ReadInt32());
+		switch (Parameter.Sampler)
+		{
+			case ESamplerType::Uniform:
+			case ESamplerType::Gaussian:
+				Parameter.Value = Message.ReadFloat32();
+				Parameter.Spread = Message.ReadFloat32();
+				break;
+			case ESamplerType::MultiRangeUniform:
+				Parameter.Intervals = Message.ReadFloatList();
+				break;
+			default:
+				UE_LOG(LogTemp, Error, TEXT("Unknown sampler type %d received for the environment parameter %s."),
+					static_cast<int32>(Parameter.Sampler), *Key);
+				return;
+		}
+	}
+	else
+	{
+		UE_LOG(LogTemp, Error, TEXT("Unknown type %d received for the environment parameter %s."),
+			static_cast<int32>(Type), *Key);
+		return;
+	}
+
+	Parameters.Add(Key, MoveTemp(Parameter));
+	if (Type == EParameterType::Float)
+	{
+		if (const TFunction<void(float)>* Callback = Callbacks.Find(Key))
+		{
+			(*Callback)(Parameters[Key].Value);
+		}
+	}
+}
+
+float FEnvironmentParameters::Sample(FParameter& Parameter)
+{
+	FRandomStream& Random = Parameter.Random;
+	switch (Parameter.Sampler)
+	{
+		case ESamplerType::Uniform:
+			return Random.FRandRange(Parameter.Value, Parameter.Spread);
+		case ESamplerType::Gaussian:
+		{
+			// Box-Muller transform, the first uniform value is kept away from zero for the logarithm
+			const float U1 = 1.0f - Random.GetFraction();
+			const float U2 = Random.GetFraction();
+			const float Normal = FMath::Sqrt(-2.0f * FMath::Loge(U1)) * FMath::Cos(2.0f * PI * U2);
+			return Parameter.Value + Parameter.Spread * Normal;
+		}
+		case ESamplerType::MultiRangeUniform:
+		{
+			// A range is picked in proportion to its length, then a value is drawn uniformly inside it
+			const TArray<float>& Intervals = Parameter.Intervals;
+			float				 TotalLength = 0.0f;
+			for (int32 i = 0; i + 1 < Intervals.Num(); i += 2)
+			{
+				TotalLength += Intervals[i + 1] - Intervals[i];
+			}
+			float Position = Random.FRandRange(0.0f, TotalLength);
+			for (int32 i = 0; i + 1 < Intervals.Num(); i += 2)
+			{
+				const float Length = Intervals[i + 1] - Intervals[i];
+				if (Position <= Length || i + 3 >= Intervals.Num())
+				{
+					return Intervals[i] + FMath::Min(Position, Length);
+				}
+				Position -= Length;
+			}
+			return 0.0f;
+		}
+	}
+	return Parameter.Value;
+}
@@ -0,0 +1,70 @@
+// Copyright © 2025 Stephane Capponi and individual contributors. All Rights Reserved.
+
+#include "UnrealMLAgents/SideChannels/IncomingMessage.h"
+
+FIncomingMessage::FIncomingMessage(TArrayView<const uint8> InData) : Data(InData), Offset(0) {}
+
+bool FIncomingMessage::ReadBytes(void* OutValue, int32 Size)
+{
+	if (Offset + Size > Data.Num())
+	{
+		Offset = Data.Num();
+		return false;
+	}
+	// Values are written little-endian, like every platform Unreal ships on
+	FMemory::Memcpy(OutValue, Data.GetData() + Offset, Size);
+	Offset += Size;
+	return true;
+}
+
+bool FIncomingMessage::ReadBoolean(bool DefaultValue)
+{
+	uint8 Value = 0;
+	return ReadBytes(&Value, sizeof(Value)) ? Value != 0 : DefaultValue;
+}
+
+int32 FIncomingMessage::ReadInt32(int32 DefaultValue)
+{
+	int32 Value = 0;
+	return ReadBytes(&Value, sizeof(Value)) ? Value : DefaultValue;
+}
+
+float FIncomingMessage::ReadFloat32(float DefaultValue)
+{
+	float Value = 0.0f;
+	return ReadBytes(&Value, sizeof(Value)) ? Value : DefaultValue;
+}
+
+FString FIncomingMessage::ReadString(const FString& DefaultValue)
+{
+	if (IsAtEnd())
+	{
+		return DefaultValue;
+	}
+	const int32 Length = ReadInt32();
+	if (Length < 0 || Offset + Length > Data.Num())
+	{
+		Offset = Data.Num();
+		return DefaultValue;
+	}
+	const FString Value(Length, reinterpret_cast<const ANSICHAR*>(Data.GetData() + Offset));
+	Offset += Length;
+	return Value;
+}
+
+TArray<float> FIncomingMessage::ReadFloatList()
+{
+	TArray<float> Values;
+	if (IsAtEnd())
+	{
+		return Values;
+	}
+	const int32 Count = ReadInt32();
+	if (Count <= 0 || Offset + Count * static_cast<int32>(sizeof(float)) > Data.Num())
+	{
+		return Values;
+	}
+	Values.SetNumUninitialized(Count);
+	ReadBytes(Values.GetData(), Count * sizeof(float));
+	return Values;
+}
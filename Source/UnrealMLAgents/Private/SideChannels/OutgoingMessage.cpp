@@ -0,0 +1,44 @@
+// Copyright © 2025 Stephane Capponi and individual contributors. All Rights Reserved.
+
+#include "UnrealMLAgents/SideChannels/OutgoingMessage.h"
+
+void FOutgoingMessage::WriteBytes(const void* Value, int32 Size)
+{
+	// Values are written little-endian, like every platform Unreal ships on
+	Buffer.Append(static_cast<const uint8*>(Value), Size);
+}
+
+void FOutgoingMessage::WriteBoolean(bool Value)
+{
+	const uint8 Byte = Value ? 1 : 0;
+	WriteBytes(&Byte, sizeof(Byte));
+}
+
+void FOutgoingMessage::WriteInt32(int32 Value)
+{
+	WriteBytes(&Value, sizeof(Value));
+}
+
+void FOutgoingMessage::WriteFloat32(float Value)
+{
+	WriteBytes(&Value, sizeof(Value));
+}
+
+void FOutgoingMessage::WriteString(const FString& Value)
+{
+	const FTCHARToUTF8 Converted(*Value);
+	WriteInt32(Converted.Length());
+	WriteBytes(Converted.Get(), Converted.Length());
+}
+
+void FOutgoingMessage::WriteFloatList(TArrayView<const float> Values)
+{
+	WriteInt32(Values.Num());
+	WriteBytes(Values.GetData(), Values.Num() * sizeof(float));
+}
+
+void FOutgoingMessage::SetRawBytes(TArrayView<const uint8> Data)
+{
+	Buffer.Reset();
+	Buffer.Append(Data.GetData(), Data.Num());
+}
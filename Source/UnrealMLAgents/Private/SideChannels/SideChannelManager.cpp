@@ -0,0 +1,135 @@
+// Copyright © 2025 Stephane Capponi and individual contributors. All Rights Reserved.
+
+#include "UnrealMLAgents/SideChannels/SideChannelManager.h"
+
+TMap<FGuid, TSharedRef<FSideChannel>> FSideChannelManager::SideChannels;
+
+namespace
+{
+	/** The size of a channel identifier on the wire. */
+	constexpr int32 GuidSize = 16;
+
+	/**
+	 * Python writes identifiers with uuid.bytes_le: the first three fields are little-endian, the last eight bytes
+	 * keep their textual order.
+	 */
+	void GuidToBytes(const FGuid& Guid, uint8* Bytes)
+	{
+		const uint32 Fields[] = { Guid.A, Guid.B >> 16, Guid.B & 0xFFFF };
+		Bytes[0] = Fields[0] & 0xFF;
+		Bytes[1] = (Fields[0] >> 8) & 0xFF;
+		Bytes[2] = (Fields[0] >> 16) & 0xFF;
+		Bytes[3] = (Fields[0] >> 24) & 0xFF;
+		Bytes[4] = Fields[1] & 0xFF;
+		Bytes[5] = (Fields[1] >> 8) & 0xFF;
+		Bytes[6] = Fields[2] & 0xFF;
+		Bytes[7] = (Fields[2] >> 8) & 0xFF;
+		for (int32 i = 0; i < 4; i++)
+		{
+			Bytes[8 + i] = (Guid.C >> (24 - 8 * i)) & 0xFF;
+			Bytes[12 + i] = (Guid.D >> (24 - 8 * i)) & 0xFF;
+		}
+	}
+
+	FGuid BytesToGuid(const uint8* Bytes)
+	{
+		const uint32 A = Bytes[0] | (Bytes[1] << 8) | (Bytes[2] << 16) | (static_cast<uint32>(Bytes[3]) << 24);
+		const uint32 B = (static_cast<uint32>(Bytes[4] | (Bytes[5] << 8)) << 16) | Bytes[6] | (Bytes[7] << 8);
+		uint32		 C = 0;
+		uint32		 D = 0;
+		for (int32 i = 0; i < 4; i++)
+		{
+			C = (C << 8) | Bytes[8 + i];
+			D = (D << 8) | Bytes[12 + i];
+		}
+		return FGuid(A, B, C, D);
+	}
+} // namespace
+
+void FSideChannelManager::RegisterSideChannel(const TSharedRef<FSideChannel>& SideChannel)
+{
+	const FGuid& ChannelId = SideChannel->GetChannelId();
+	if (SideChannels.Contains(ChannelId))
+	{
+		UE_LOG(LogTemp, Error, TEXT("A side channel with id %s is already registered."),
+			*ChannelId.ToString(EGuidFormats::DigitsWithHyphensLower));
+		return;
+	}
+	SideChannels.Add(ChannelId, SideChannel);
+}
+
+void FSideChannelManager::UnregisterSideChannel(const TSharedRef<FSideChannel>& SideChannel)
+{
+	const TSharedRef<FSideChannel>* Registered = SideChannels.Find(SideChannel->GetChannelId());
+	if (Registered != nullptr && &Registered->Get() == &SideChannel.Get())
+	{
+		SideChannels.Remove(SideChannel->GetChannelId());
+	}
+}
+
+void FSideChannelManager::UnregisterAllSideChannels()
+{
+	SideChannels.Reset();
+}
+
+TSharedPtr<FSideChannel> FSideChannelManager::GetSideChannel(const FGuid& ChannelId)
+{
+	const TSharedRef<FSideChannel>* SideChannel = SideChannels.Find(ChannelId);
+	return SideChannel != nullptr ? TSharedPtr<FSideChannel>(*SideChannel) : nullptr;
+}
+
+void FSideChannelManager::ProcessSideChannelData(TArrayView<const uint8> Data)
+{
+	int32 Offset = 0;
+	while (Offset < Data.Num())
+	{
+		int32 MessageSize = 0;
+		if (Offset + GuidSize + static_cast<int32>(sizeof(MessageSize)) > Data.Num())
+		{
+			UE_LOG(LogTemp, Error, TEXT("The side channel data received from the trainer is truncated."));
+			return;
+		}
+		const FGuid ChannelId = BytesToGuid(Data.GetData() + Offset);
+		Offset += GuidSize;
+		FMemory::Memcpy(&MessageSize, Data.GetData() + Offset, sizeof(MessageSize));
+		Offset += sizeof(MessageSize);
+		if (MessageSize < 0 || Offset + MessageSize > Data.Num())
+		{
+			UE_LOG(LogTemp, Error, TEXT("The side channel message received for %s is truncated."),
+				*ChannelId.ToString(EGuidFormats::DigitsWithHyphensLower));
+			return;
+		}
+
+		if (const TSharedRef<FSideChannel>* SideChannel = SideChannels.Find(ChannelId))
+		{
+			FIncomingMessage Message(Data.Slice(Offset, MessageSize));
+			(*SideChannel)->OnMessageReceived(Message);
+		}
+		else
+		{
+			UE_LOG(LogTemp, Log, TEXT("Unknown side channel data received. Channel id: %s."),
+				*ChannelId.ToString(EGuidFormats::DigitsWithHyphensLower));
+		}
+		Offset += MessageSize;
+	}
+}
+
+void FSideChannelManager::GetSideChannelMessage(std::string& OutData)
+{
+	for (const TPair<FGuid, TSharedRef<FSideChannel>>& Pair : SideChannels)
+	{
+		FSideChannel& SideChannel = Pair.Value.Get();
+		SideChannel.OnCollectMessages();
+
+		uint8 ChannelId[GuidSize];
+		GuidToBytes(Pair.Key, ChannelId);
+		for (const TArray<uint8>& Message : SideChannel.MessageQueue)
+		{
+			const int32 MessageSize = Message.Num();
+			OutData.append(reinterpret_cast<const char*>(ChannelId), GuidSize);
+			OutData.append(reinterpret_cast<const char*>(&MessageSize), sizeof(MessageSize));
+			OutData.append(reinterpret_cast<const char*>(Message.GetData()), MessageSize);
+		}
+		SideChannel.MessageQueue.Reset();
+	}
+}
@@ -0,0 +1,99 @@
+// Copyright © 2025 Stephane Capponi and individual contributors. All Rights Reserved.
+
+#include "UnrealMLAgents/SideChannels/StatsRecorder.h"
+
+// uuid.uuid5(uuid.NAMESPACE_URL, "com.unity.ml-agents/StatsSideChannel"), shared with the Python StatsSideChannel
+FStatsRecorder::FStatsRecorder()
+	: FSideChannel(FGuid(0xa1d8f7b7, 0xcec850f9, 0xb78bd3e1, 0x65a78520))
+	, SummaryPeriod(DefaultSummaryPeriod)
+	, NumStepsSinceSummary(0)
+	, bEnabled(true)
+{
+}
+
+void FStatsRecorder::Add(const FString& Key, float Value, EStatAggregationMethod Method)
+{
+	if (!bEnabled)
+	{
+		return;
+	}
+	FAggregatedStat* Stat = Stats.Find(Key);
+	if (Stat == nullptr)
+	{
+		Stat = &Stats.Add(Key);
+		Stat->Method = Method;
+	}
+	else if (Stat->Count == 0)
+	{
+		Stat->Method = Method;
+	}
+
+	Stat->Sum += Value;
+	Stat->Count++;
+	Stat->MostRecent = Value;
+	if (Stat->Method == EStatAggregationMethod::Histogram)
+	{
+		Stat->Values.Add(Value);
+	}
+}
+
+void FStatsRecorder::WriteEntry(const FString& Key, float Value, EStatAggregationMethod Method, int32 Count)
+{
+	Summary.WriteString(Key);
+	Summary.WriteFloat32(Value);
+	Summary.WriteInt32(static_cast<int32>(Method));
+	Summary.WriteInt32(Count);
+}
+
+void FStatsRecorder::Flush()
+{
+	NumStepsSinceSummary = 0;
+	Summary.Reset();
+	for (TPair<FString, FAggregatedStat>& Pair : Stats)
+	{
+		FAggregatedStat& Stat = Pair.Value;
+		if (Stat.Count == 0)
+		{
+			continue;
+		}
+		switch (Stat.Method)
+		{
+			case EStatAggregationMethod::Average:
+				WriteEntry(Pair.Key, static_cast<float>(Stat.Sum / Stat.Count), Stat.Method, Stat.Count);
+				break;
+			case EStatAggregationMethod::Sum:
+				WriteEntry(Pair.Key, static_cast<float>(Stat.Sum), Stat.Method, 1);
+				break;
+			case EStatAggregationMethod::MostRecent:
+				WriteEntry(Pair.Key, Stat.MostRecent, Stat.Method, 1);
+				break;
+			case EStatAggregationMethod::Histogram:
+				for (const float Value : Stat.Values)
+				{
+					WriteEntry(Pair.Key, Value, Stat.Method, 1);
+				}
+				break;
+		}
+		// The entries are kept so that their memory is reused by the next summary period
+		Stat.Sum = 0.0;
+		Stat.Count = 0;
+		Stat.Values.Reset();
+	}
+	if (Summary.GetBuffer().Num() > 0)
+	{
+		QueueMessageToSend(Summary);
+	}
+}
+
+void FStatsRecorder::OnMessageReceived(FIncomingMessage& Message)
+{
+	UE_LOG(LogTemp, Warning, TEXT("The stats side channel received a message from the trainer, it is ignored."));
+}
+
+void FStatsRecorder::OnCollectMessages()
+{
+	if (++NumStepsSinceSummary >= SummaryPeriod)
+	{
+		Flush();
+	}
+}
@@ -8,6 +8,8 @@
 #include "Communicator/RpcCommunicator.h"
 #include "RecursionChecker.h"
 #include "UnrealMLAgents/Policies/RemotePolicy.h"
+#include "UnrealMLAgents/SideChannels/EnvironmentParameters.h"
+#include "UnrealMLAgents/SideChannels/StatsRecorder.h"
 #include "Tickable.h"
 #include "Academy.generated.h"
 
@@ -171,6 +173,26 @@ public:
 	 */
 	bool IsCommunicatorOn();
 
+	/**
+	 * @brief Returns the recorder of the custom statistics sent to the trainer.
+	 *
+	 * Statistics are aggregated in the engine and reach the trainer once per summary period, they are shown next
+	 * to the training statistics. Without a trainer the recorded values are dropped.
+	 *
+	 * @return The stats recorder of the Academy.
+	 */
+	FStatsRecorder& GetStatsRecorder();
+
+	/**
+	 * @brief Returns the environment parameters set by the trainer.
+	 *
+	 * Curriculum lessons and randomized values are applied as soon as the trainer sends them, without resetting
+	 * the environment. Agents read them when their episode begins.
+	 *
+	 * @return The environment parameters of the Academy.
+	 */
+	FEnvironmentParameters& GetEnvironmentParameters();
+
 	// Declare events related to agent and environment lifecycle.
 
 	/**
@@ -240,6 +262,72 @@ private:
 	/// Command line flag for specifying the port used for communication.
 	FString PortCommandLineFlag = "mlAgentPort=";
 
+	/// The command line Unix domain socket path used instead of the port, empty to communicate over TCP.
+	FString SocketPath;
+
+	/// Command line flag for specifying the Unix domain socket used for communication.
+	FString SocketPathCommandLineFlag = "mlAgentSocket=";
+
+	/// Command line switch enabling arena-backed communicator step messages.
+	FString ArenaCommandLineFlag = "mlAgentArena";
+
+	/// Whether the communicator builds its step messages on reusable arenas.
+	bool bUseArenaMessages = false;
+
+	/// Command line switch moving communicator exchanges to a dedicated thread.
+	FString OverlapExchangeCommandLineFlag = "mlAgentOverlapExchange";
+
+	/// Whether communicator exchanges overlap with the simulation.
+	bool bOverlapExchange = false;
+
+	/// Command line switch exchanging messages with the trainer through shared memory instead of gRPC.
+	FString SharedMemoryCommandLineFlag = "mlAgentSharedMemory";
+
+	/// Whether the communicator uses the shared memory transport.
+	bool bUseSharedMemory = false;
+
+	/// Command line switch writing the communicator step timings to a CSV file next to the log.
+	FString CommunicatorStatsCommandLineFlag = "mlAgentCommunicatorStats";
+
+	/// Whether the communicator writes its step timings to a CSV file.
+	bool bWriteCommunicatorStats = false;
+
+	/// Command line flag sending behaviors to their own trainers, as "BehaviorName:Port,BehaviorName:Port".
+	FString ShardsCommandLineFlag = "mlAgentShards=";
+
+	/// The port of the trainer of each behavior that does not train with the main trainer.
+	TMap<FString, int32> BehaviorShardPorts;
+
+	/// Command line switch keeping the environment running when the trainer is lost, until a new one connects.
+	FString ReconnectCommandLineFlag = "mlAgentReconnect";
+
+	/// Whether a lost trainer is waited for instead of quitting the environment.
+	bool bReconnect = false;
+
+	/// Command line flag for specifying the largest message exchanged with the trainer, in bytes.
+	FString MaxMessageSizeCommandLineFlag = "mlAgentMaxMessageSize=";
+
+	/// The largest message exchanged with the trainer, larger step messages are sent in chunks.
+	int32 MaxMessageSize = FCommunicatorInitParameters::DefaultMaxMessageSize;
+
+	/// Command line flag for specifying the longest a step waits for the trainer, in milliseconds.
+	FString ExchangeDeadlineCommandLineFlag = "mlAgentExchangeDeadline=";
+
+	/// The longest a step waits for the trainer in seconds, 0 to always wait. Ignored with the overlapped exchange.
+	float ExchangeDeadline = 0.0f;
+
+	/// Command line flag for specifying the number of micro-batches the agents of a step are split into.
+	FString MicroBatchesCommandLineFlag = "mlAgentMicroBatches=";
+
+	/// The number of micro-batches the agents of a step are split into, 1 to send each step in one message.
+	int32 MicroBatches = 1;
+
+	/// Command line flag for specifying the index of the environment behind a communicator gateway.
+	FString GatewayIndexCommandLineFlag = "mlAgentGatewayIndex=";
+
+	/// The index of the environment behind a communicator gateway, INDEX_NONE when the trainer is reached directly.
+	int32 GatewayIndex = INDEX_NONE;
+
 	/// The singleton instance of the Academy.
 	static UAcademy* Instance;
 
@@ -259,6 +347,16 @@ private:
 	UPROPERTY()
 	URpcCommunicator* RpcCommunicator;
 
+	/// Communicators of the trainers the behaviors are sharded to, by port.
+	UPROPERTY()
+	TMap<int32, URpcCommunicator*> ShardCommunicators;
+
+	/// Aggregates the custom statistics and sends them over the stats side channel.
+	TSharedPtr<FStatsRecorder> StatsRecorder;
+
+	/// Receives the environment parameters over the environment parameters side channel.
+	TSharedPtr<FEnvironmentParameters> EnvironmentParameters;
+
 	/// Whether stepping is driven by the physics fixed step.
 	bool bUsePhysicsStep = false;
 
@@ -290,6 +388,28 @@ private:
 	 */
 	void ParseCommandLineArgs();
 
+	/**
+	 * @brief Connects to the trainers of the sharded behaviors.
+	 *
+	 * A behavior whose trainer cannot be reached stays with the main trainer.
+	 *
+	 * @param InitParameters The initialization parameters of the main communicator.
+	 */
+	void InitializeShards(const FCommunicatorInitParameters& InitParameters);
+
+	/**
+	 * @brief Groups the communicators of the connected shards with the main one, so their exchanges run together.
+	 */
+	void GroupShards();
+
+	/**
+	 * @brief Returns the communicator exchanging the data of a behavior.
+	 *
+	 * @param BehaviorName The fully qualified name of the behavior.
+	 * @return The communicator of the trainer of the behavior, null without a trainer.
+	 */
+	URpcCommunicator* GetCommunicator(const FString& BehaviorName) const;
+
 	/**
 	 * @brief Forces a full reset of the environment and agents.
 	 */
@@ -0,0 +1,48 @@
+// Copyright © 2025 Stephane Capponi and individual contributors. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @struct FActionSequence
+ * @brief The actions a decision made for several steps, played back one step at a time by the actuator manager.
+ *
+ * The trainer may reply to a decision with the actions of the steps until the next decision, so the agent only asks
+ * for a decision once every few steps while its control stays as fine-grained as its step. The sequence is written by
+ * the communicator when the reply arrives and each action step of the agent plays its next step, the last one being
+ * held once the sequence is over. A new decision replaces the sequence, wherever it was.
+ *
+ * The decision period of the agent is best set to the number of steps of the sequences, the steps played before the
+ * next decision are reported to the trainer with it.
+ */
+struct FActionSequence
+{
+	/** @brief The continuous actions of every step of the sequence, the steps following each other. */
+	TArray<float> ContinuousActions;
+
+	/** @brief The discrete actions of every step of the sequence, the steps following each other. */
+	TArray<int32> DiscreteActions;
+
+	/** @brief The number of steps of the sequence, 0 when the last decision was for a single step. */
+	int32 NumSteps = 0;
+
+	/** @brief The number of steps of the sequence already played. */
+	int32 NumPlayed = 0;
+
+	/**
+	 * @brief Returns whether steps of the sequence are left to play.
+	 *
+	 * @return True if the sequence has steps that were not played yet.
+	 */
+	bool HasQueuedSteps() const { return NumPlayed < NumSteps; }
+
+	/**
+	 * @brief Forgets the sequence, the actions that follow are for a single step.
+	 */
+	void Reset()
+	{
+		NumSteps = 0;
+		NumPlayed = 0;
+	}
+};
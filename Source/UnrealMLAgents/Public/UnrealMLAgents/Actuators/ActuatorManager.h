@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "UnrealMLAgents/Actuators/IActuator.h"
 #include "UnrealMLAgents/Actuators/IActionReceiver.h"
+#include "UnrealMLAgents/Actuators/ActionSequence.h"
 #include "ActuatorDiscreteActionMask.h"
 #include "ActuatorManager.generated.h"
 
@@ -73,6 +74,27 @@ public:
 	 */
 	FActionBuffers& GetStoredActions() { return StoredActions; }
 
+	/**
+	 * @brief Retrieves the sequence of actions played back after the stored actions of a decision.
+	 *
+	 * @return The shared action sequence, the communicator writes the sequences of the trainer straight into it.
+	 */
+	const TSharedPtr<FActionSequence>& GetActionSequence() const { return ActionSequence; }
+
+	/**
+	 * @brief Returns whether the last decision left steps of its action sequence to play.
+	 *
+	 * @return True if the next action step plays a step of the action sequence.
+	 */
+	bool HasQueuedActions() const { return ActionSequence.IsValid() && ActionSequence->HasQueuedSteps(); }
+
+	/**
+	 * @brief Returns the number of steps of the action sequence of the last decision that were played.
+	 *
+	 * @return The number of steps played, 0 when the last decision was for a single step.
+	 */
+	int32 GetNumPlayedSequenceSteps() const { return ActionSequence.IsValid() ? ActionSequence->NumPlayed : 0; }
+
 	// Methods
 
 	/**
@@ -107,7 +129,7 @@ public:
 	void ApplyHeuristic(const FActionBuffers& ActionBuffersOut);
 
 	/**
-	 * @brief Executes the actions for each actuator.
+	 * @brief Executes the actions for each actuator, the next step of the action sequence if one is playing.
 	 */
 	void ExecuteActions();
 
@@ -252,6 +274,9 @@ private:
 	UPROPERTY()
 	FActionBuffers StoredActions;
 
+	/** @brief The actions of the steps that follow a decision made for several steps. */
+	TSharedPtr<FActionSequence> ActionSequence;
+
 	/** @brief Flag to indicate if actuators are ready for execution. */
 	bool bReadyForExecution;
 
@@ -307,6 +332,11 @@ private:
 	template <typename T>
 	static void UpdateActionArray(const FActionSegment<T>& SourceActionBuffer, FActionSegment<T>& Destination);
 
+	/**
+	 * @brief Copies the actions of the next step of the action sequence into the stored actions.
+	 */
+	void PlayActionSequenceStep();
+
 	/**
 	 * @brief Adds an actuator's action buffer sizes to the total.
 	 *
@@ -0,0 +1,189 @@
+// Copyright © 2025 Stephane Capponi and individual contributors. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UnrealMLAgents/Communicator/ICommunicator.h"
+#include "grpc++/grpc++.h"
+#include "ueagents_envs/communicator_objects/unreal_to_external.grpc.pb.h"
+#include "ueagents_envs/communicator_objects/unreal_message.pb.h"
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+// The generated gRPC files pull in headers that define GetObject on Windows
+#ifdef GetObject
+	#undef GetObject
+#endif
+
+/**
+ * @struct FCommunicatorGatewayParameters
+ * @brief The configuration of a communicator gateway.
+ */
+struct UNREALMLAGENTS_API FCommunicatorGatewayParameters
+{
+	/** @brief The number of environments that connect to the gateway, every step waits for all of them. */
+	int32 NumEnvironments = 1;
+
+	/** @brief The port the environments connect to, as given to them with -mlAgentPort. */
+	int32 Port = 5004;
+
+	/** @brief The address of the trainer, as host:port. */
+	FString TrainerAddress = TEXT("localhost:5005");
+
+	/** @brief The largest message the gateway sends or receives, in bytes. */
+	int32 MaxMessageSize = FCommunicatorInitParameters::DefaultMaxMessageSize;
+
+	/**
+	 * @brief The longest a step may take, from the first message of an environment to the reply of the trainer, in
+	 * seconds. Past it the session ends, so a lost environment or trainer does not hang the others.
+	 */
+	float StepTimeout = 120.0f;
+};
+
+/**
+ * @class FCommunicatorGateway
+ * @brief Serves many environments of a node to one trainer as if they were a single environment.
+ *
+ * The gateway stands in for the trainer towards the environments and for one environment towards the trainer.
+ * Once every environment sent its message of a step, the messages are merged into one: the agents of each behavior
+ * are concatenated in the order of the environments, with their agent and group ids remapped so they stay unique.
+ * The reply of the trainer is split back, each environment getting the actions of its own agents and the commands
+ * and side channel messages of the trainer. The trainer then pays for one connection whatever the number of environments.
+ *
+ * Environments are told by the handshake that the trainer does not read packed observations, does not stream the
+ * steps and does not reassemble chunks, so their messages can be merged as they are. The merged message is split
+ * in chunks when it is over the limit of the trainer. Environments are told apart by the index they are started
+ * with, -mlAgentGatewayIndex, which they send with every message and keep when they reconnect.
+ */
+class UNREALMLAGENTS_API FCommunicatorGateway final : public communicator_objects::UnrealToExternalProto::Service
+{
+public:
+	/**
+	 * @brief Creates a gateway, it does not listen before Run is called.
+	 *
+	 * @param InParameters The configuration of the gateway.
+	 */
+	explicit FCommunicatorGateway(const FCommunicatorGatewayParameters& InParameters);
+
+	/**
+	 * @brief Serves the environments until the trainer or an environment ends the session.
+	 *
+	 * @return True if the session ended normally, false if the gateway could not listen or reach the trainer.
+	 */
+	bool Run();
+
+	/**
+	 * @brief Receives the message of an environment for the current step and replies with its part of the reply.
+	 *
+	 * @param Context The context of the call, its metadata identifies the environment.
+	 * @param Request The message of the environment.
+	 * @param Response The part of the reply of the trainer for the environment.
+	 * @return The status of the call.
+	 */
+	virtual grpc::Status Exchange(grpc::ServerContext* Context, const communicator_objects::UnrealMessageProto* Request,
+		communicator_objects::UnrealMessageProto* Response) override;
+
+private:
+	/** The bytes reserved for the fields of a chunk message around its slice. */
+	static constexpr int32 ChunkOverheadBytes = 64;
+
+	/** The clock the steps are timed with. */
+	using FStepClock = std::chrono::system_clock;
+
+	/**
+	 * @brief Returns the index an environment sent with its message.
+	 *
+	 * @param Context The context of the call.
+	 * @return The index of the environment, INDEX_NONE when it sent none or one out of range.
+	 */
+	int32 FindEnvironment(const grpc::ServerContext& Context) const;
+
+	/**
+	 * @brief Merges the messages of every environment into the message sent to the trainer.
+	 */
+	void MergeRequests();
+
+	/**
+	 * @brief Splits the reply of the trainer into the reply of each environment.
+	 */
+	void SplitResponse();
+
+	/**
+	 * @brief Sends the merged message to the trainer, in chunks if it is over the limit of the trainer.
+	 *
+	 * @param Deadline The end of the step, the trainer must have replied by then.
+	 * @return True if the reply of the trainer was received.
+	 */
+	bool SendUpstream(FStepClock::time_point Deadline);
+
+	/**
+	 * @brief Sends one message to the trainer.
+	 *
+	 * @param Request The message to send.
+	 * @param Response Receives the reply of the trainer.
+	 * @param Deadline The end of the step, the trainer must have replied by then.
+	 * @return True if the call succeeded.
+	 */
+	bool CallTrainer(const communicator_objects::UnrealMessageProto& Request,
+		communicator_objects::UnrealMessageProto& Response, FStepClock::time_point Deadline);
+
+	/** The configuration of the gateway. */
+	FCommunicatorGatewayParameters Parameters;
+
+	/** The channel to the trainer. */
+	std::shared_ptr<grpc::Channel> Channel;
+
+	/** The stub calling the trainer. */
+	std::unique_ptr<communicator_objects::UnrealToExternalProto::Stub> Stub;
+
+	/** The server the environments connect to. */
+	std::unique_ptr<grpc::Server> Server;
+
+	/** Guards the state of the current step. */
+	std::mutex Mutex;
+
+	/** Wakes the environments waiting for the reply of the trainer, and Run once the session ends. */
+	std::condition_variable StepDone;
+
+	/** The last peer address of each environment, by index, empty until it connects. */
+	TArray<std::string> Peers;
+
+	/** The message of each environment for the current step. */
+	TArray<communicator_objects::UnrealMessageProto> Requests;
+
+	/** Whether each environment sent its message for the current step. */
+	TArray<bool> HasRequest;
+
+	/** The number of environments that sent their message for the current step. */
+	int32 NumRequests;
+
+	/** The end of the current step, set when its first message arrives. */
+	FStepClock::time_point StepDeadline;
+
+	/** The reply of each environment for the last step. */
+	TArray<communicator_objects::UnrealMessageProto> Responses;
+
+	/** The number of agents of each behavior and environment that wait for actions, in the merged order. */
+	TArray<std::unordered_map<std::string, int32>> NumDecisions;
+
+	/** The merged message sent to the trainer. */
+	communicator_objects::UnrealMessageProto MergedRequest;
+
+	/** The reply of the trainer. */
+	communicator_objects::UnrealMessageProto MergedResponse;
+
+	/** The number of steps exchanged with the trainer, the environments wait for it to change. */
+	int64 StepCount;
+
+	/** The largest message the trainer accepts, 0 until the handshake or when it cannot reassemble chunks. */
+	int32 MaxUpstreamMessageSize;
+
+	/** Whether the session ended, because of the trainer or an environment. */
+	bool bSessionEnded;
+
+	/** Whether the session ended because of a failure. */
+	bool bFailed;
+};
@@ -0,0 +1,41 @@
+// Copyright © 2025 Stephane Capponi and individual contributors. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "CommunicatorGatewayCommandlet.generated.h"
+
+/**
+ * @class UCommunicatorGatewayCommandlet
+ * @brief Runs a communicator gateway, so the environments of a node reach the trainer over one connection.
+ *
+ * Started with `-run=CommunicatorGateway`, it accepts the following arguments:
+ * - `-mlAgentGatewayEnvs=N` the number of environments that connect to the gateway, 1 by default.
+ * - `-mlAgentPort=P` the port the environments connect to, 5004 by default.
+ * - `-mlAgentTrainer=host:port` the address of the trainer, localhost:5005 by default.
+ * - `-mlAgentMaxMessageSize=B` the largest message sent or received, in bytes.
+ * - `-mlAgentGatewayTimeout=S` the longest a step may take before the session ends, 120 seconds by default.
+ *
+ * The environments are started with `-mlAgentPort` set to the port of the gateway, and each with its own
+ * `-mlAgentGatewayIndex` from 0 to N - 1.
+ */
+UCLASS()
+class UNREALMLAGENTS_API UCommunicatorGatewayCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * @brief Sets the commandlet up to run without client, server or editor.
+	 */
+	UCommunicatorGatewayCommandlet();
+
+	/**
+	 * @brief Serves the environments until the trainer or an environment ends the session.
+	 *
+	 * @param Params The command line of the commandlet.
+	 * @return 0 if the session ended normally, 1 otherwise.
+	 */
+	virtual int32 Main(const FString& Params) override;
+};
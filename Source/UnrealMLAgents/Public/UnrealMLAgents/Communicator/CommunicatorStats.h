@@ -0,0 +1,226 @@
+// Copyright © 2025 Stephane Capponi and individual contributors. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+
+/**
+ * @enum ECommunicatorPhase
+ * @brief The phases of a communicator step that are timed.
+ */
+enum class ECommunicatorPhase : uint8
+{
+	/** Building the step message from the observations of the agents. */
+	Build,
+
+	/** Encoding the step message for the transport. */
+	Serialize,
+
+	/** Sending the step message and waiting for the reply of the trainer, decoding the reply included. */
+	Exchange,
+
+	/** Scattering the actions of the reply to the agents. */
+	Apply,
+
+	Count
+};
+
+/**
+ * @struct FCommunicatorStepTimings
+ * @brief The time spent in each phase of one communicator step and the bytes it exchanged.
+ */
+struct FCommunicatorStepTimings
+{
+	/** @brief The seconds spent in each phase, indexed by ECommunicatorPhase. */
+	double Seconds[static_cast<int32>(ECommunicatorPhase::Count)] = {};
+
+	/** @brief The size of the step message sent to the trainer. */
+	int64 BytesOut = 0;
+
+	/** @brief The size of the reply received from the trainer. */
+	int64 BytesIn = 0;
+
+	/**
+	 * @brief Returns the seconds spent in a phase.
+	 *
+	 * @param Phase The phase.
+	 * @return A reference to the seconds spent in the phase.
+	 */
+	double& operator[](ECommunicatorPhase Phase) { return Seconds[static_cast<int32>(Phase)]; }
+
+	/**
+	 * @brief Adds the times and bytes of other timings to these ones.
+	 *
+	 * @param Other The timings to add.
+	 */
+	void Accumulate(const FCommunicatorStepTimings& Other)
+	{
+		for (int32 i = 0; i < static_cast<int32>(ECommunicatorPhase::Count); ++i)
+		{
+			Seconds[i] += Other.Seconds[i];
+		}
+		BytesOut += Other.BytesOut;
+		BytesIn += Other.BytesIn;
+	}
+};
+
+/**
+ * @struct FScopedCommunicatorTimer
+ * @brief Adds the time spent in its scope to a phase of step timings.
+ */
+struct FScopedCommunicatorTimer
+{
+	/**
+	 * @brief Starts timing the phase.
+	 *
+	 * @param InTimings The timings the elapsed time is added to.
+	 * @param InPhase The phase being timed.
+	 */
+	FScopedCommunicatorTimer(FCommunicatorStepTimings& InTimings, ECommunicatorPhase InPhase)
+		: Timings(InTimings), Phase(InPhase), StartCycles(FPlatformTime::Cycles64())
+	{
+	}
+
+	/** @brief Adds the elapsed time to the phase. */
+	~FScopedCommunicatorTimer()
+	{
+		Timings[Phase] += FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles);
+	}
+
+private:
+	FCommunicatorStepTimings& Timings;
+	ECommunicatorPhase		  Phase;
+	uint64					  StartCycles;
+};
+
+/**
+ * @struct FCommunicatorStatSummary
+ * @brief Statistics of a value over the recent communicator steps.
+ */
+struct FCommunicatorStatSummary
+{
+	/** @brief The mean of the value. */
+	double Mean = 0.0;
+
+	/** @brief The median of the value. */
+	double P50 = 0.0;
+
+	/** @brief The 90th percentile of the value. */
+	double P90 = 0.0;
+
+	/** @brief The 99th percentile of the value. */
+	double P99 = 0.0;
+
+	/** @brief The largest value. */
+	double Max = 0.0;
+};
+
+/**
+ * @class FCommunicatorStats
+ * @brief Keeps the timings of the recent communicator steps and optionally appends them to a CSV file.
+ *
+ * The statistics cover a rolling window of steps. Recording a step only copies its timings, the percentiles are
+ * computed when they are queried.
+ */
+class UNREALMLAGENTS_API FCommunicatorStats
+{
+public:
+	/** @brief The number of steps the statistics cover by default. */
+	static constexpr int32 DefaultWindowSize = 1000;
+
+	/** @brief The number of steps recorded between two writes of the CSV file. */
+	static constexpr int32 CsvFlushInterval = 500;
+
+	/**
+	 * @brief Creates empty statistics.
+	 *
+	 * @param InWindowSize The number of recent steps the statistics cover.
+	 */
+	explicit FCommunicatorStats(int32 InWindowSize = DefaultWindowSize);
+
+	/**
+	 * @brief Records the timings of a completed step.
+	 *
+	 * @param Step The timings of the step.
+	 */
+	void RecordStep(const FCommunicatorStepTimings& Step);
+
+	/**
+	 * @brief Returns the statistics of the time spent in a phase, in milliseconds.
+	 *
+	 * @param Phase The phase.
+	 * @return The statistics of the phase over the recent steps.
+	 */
+	FCommunicatorStatSummary GetPhaseSummary(ECommunicatorPhase Phase) const;
+
+	/**
+	 * @brief Returns the statistics of the total time of the steps, in milliseconds.
+	 *
+	 * @return The statistics of the step time over the recent steps.
+	 */
+	FCommunicatorStatSummary GetStepSummary() const;
+
+	/**
+	 * @brief Returns the statistics of the bytes sent to the trainer per step.
+	 *
+	 * @return The statistics of the bytes sent over the recent steps.
+	 */
+	FCommunicatorStatSummary GetBytesOutSummary() const;
+
+	/**
+	 * @brief Returns the statistics of the bytes received from the trainer per step.
+	 *
+	 * @return The statistics of the bytes received over the recent steps.
+	 */
+	FCommunicatorStatSummary GetBytesInSummary() const;
+
+	/**
+	 * @brief Returns the number of steps recorded since the statistics were created.
+	 *
+	 * @return The number of steps recorded.
+	 */
+	int64 GetNumSteps() const { return NumSteps; }
+
+	/**
+	 * @brief Appends every recorded step to a CSV file, written every CsvFlushInterval steps.
+	 *
+	 * @param InCsvPath The path of the CSV file, empty to stop writing it.
+	 */
+	void SetCsvPath(const FString& InCsvPath);
+
+	/**
+	 * @brief Writes the steps recorded since the last write to the CSV file.
+	 */
+	void Flush();
+
+private:
+	/**
+	 * @brief Computes the statistics of a value of the steps in the window.
+	 *
+	 * @param Value Returns the value of a step.
+	 * @return The statistics of the value.
+	 */
+	FCommunicatorStatSummary Summarize(TFunctionRef<double(const FCommunicatorStepTimings&)> Value) const;
+
+	/** The number of steps the statistics cover. */
+	int32 WindowSize;
+
+	/** The timings of the recent steps, used as a ring buffer once full. */
+	TArray<FCommunicatorStepTimings> Window;
+
+	/** The index of the oldest step once the window is full. */
+	int32 NextIndex;
+
+	/** The number of steps recorded. */
+	int64 NumSteps;
+
+	/** The path of the CSV file, empty when it is not written. */
+	FString CsvPath;
+
+	/** The rows recorded since the last write of the CSV file. */
+	FString PendingRows;
+
+	/** The number of rows recorded since the last write of the CSV file. */
+	int32 NumPendingRows;
+};
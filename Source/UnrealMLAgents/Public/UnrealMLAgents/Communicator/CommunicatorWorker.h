@@ -0,0 +1,134 @@
+// Copyright © 2025 Stephane Capponi and individual contributors. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "HAL/Runnable.h"
+#include <atomic>
+#include "UnrealMLAgents/Communicator/CommunicatorStats.h"
+#include "ueagents_envs/communicator_objects/unreal_message.pb.h"
+#include <string>
+
+/**
+ * @struct FExchangeResult
+ * @brief The outcome of an exchange performed by the communicator thread.
+ */
+struct FExchangeResult
+{
+	/** Whether the transport call succeeded. */
+	bool bSucceeded = false;
+
+	/** The transport error message when the call failed. */
+	std::string ErrorMessage;
+
+	/** The time spent serializing and exchanging the messages, and their sizes. */
+	FCommunicatorStepTimings Timings;
+};
+
+/**
+ * @class FCommunicatorWorker
+ * @brief Runs the blocking exchanges of the communicator on a dedicated thread.
+ *
+ * The game thread submits a request and the message its response is received into, and picks the result up later,
+ * so the simulation keeps running while the trainer computes the actions. Requests and results go through lock-free
+ * single-producer single-consumer queues. The trainer answers requests in order, so at most one exchange is expected
+ * to be in flight at a time, unless the worker only writes the micro-batches of a step whose replies are read by the
+ * game thread.
+ */
+class UNREALMLAGENTS_API FCommunicatorWorker : public FRunnable
+{
+public:
+	/**
+	 * @brief Sends a request and receives its reply, returning false with an error message if the transport fails.
+	 * The timings of the exchange are recorded along the way.
+	 */
+	using FExchangeFunction = TFunction<bool(const communicator_objects::UnrealMessageProto&,
+		communicator_objects::UnrealMessageProto&, std::string&, FCommunicatorStepTimings&)>;
+
+	/**
+	 * @brief Creates the worker for the given transport. Whatever the function uses must outlive the worker.
+	 *
+	 * @param InExchangeFunction The function performing a blocking exchange over the transport.
+	 */
+	explicit FCommunicatorWorker(FExchangeFunction InExchangeFunction);
+
+	virtual ~FCommunicatorWorker() override;
+
+	/**
+	 * @brief Starts the communicator thread.
+	 */
+	void Start();
+
+	/**
+	 * @brief Stops the communicator thread, waiting for the exchange in flight to complete.
+	 */
+	virtual void Stop() override;
+
+	/**
+	 * @brief Queues an exchange on the communicator thread.
+	 *
+	 * Neither message may be touched by the caller until the result has been retrieved.
+	 *
+	 * @param Request The message to send to the external system.
+	 * @param Response The message the reply is received into.
+	 */
+	void Submit(
+		const communicator_objects::UnrealMessageProto* Request, communicator_objects::UnrealMessageProto* Response);
+
+	/**
+	 * @brief Retrieves the result of a completed exchange without blocking.
+	 *
+	 * @param OutResult The result of the exchange.
+	 * @return True if an exchange had completed, false otherwise.
+	 */
+	bool TryGetResult(FExchangeResult& OutResult);
+
+	/**
+	 * @brief Blocks until the exchange in flight completes and retrieves its result.
+	 *
+	 * @return The result of the exchange.
+	 */
+	FExchangeResult WaitForResult();
+
+	/**
+	 * @brief Blocks until the exchange in flight completes or the timeout passes, and retrieves its result.
+	 *
+	 * @param OutResult The result of the exchange.
+	 * @param TimeoutSeconds The longest to wait, in seconds.
+	 * @return True if the exchange completed in time, false if it is still in flight.
+	 */
+	bool WaitForResult(FExchangeResult& OutResult, double TimeoutSeconds);
+
+	/** Thread entry point. */
+	virtual uint32 Run() override;
+
+private:
+	/** A request waiting to be sent by the communicator thread. */
+	struct FExchangeJob
+	{
+		const communicator_objects::UnrealMessageProto* Request = nullptr;
+		communicator_objects::UnrealMessageProto*		Response = nullptr;
+	};
+
+	/** The function performing a blocking exchange over the transport. */
+	FExchangeFunction ExchangeFunction;
+
+	/** Requests submitted by the game thread. */
+	TQueue<FExchangeJob, EQueueMode::Spsc> Jobs;
+
+	/** Results produced by the communicator thread. */
+	TQueue<FExchangeResult, EQueueMode::Spsc> Results;
+
+	/** Signaled when a job is submitted or the worker is stopping. */
+	FEvent* WorkEvent;
+
+	/** Signaled when a result is available. */
+	FEvent* ResultEvent;
+
+	/** The communicator thread. */
+	FRunnableThread* Thread;
+
+	/** Whether the worker has been asked to stop. */
+	std::atomic<bool> bStopping;
+};
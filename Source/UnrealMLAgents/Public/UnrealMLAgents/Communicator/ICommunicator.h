@@ -28,6 +28,9 @@ struct FCommunicatorInitParameters
 	/** @brief The port number used for communication. */
 	int32 Port;
 
+	/** @brief Path of a Unix domain socket to connect to instead of the TCP port, empty to use the port. */
+	FString SocketPath;
+
 	/** @brief The name of the Unreal environment. */
 	FString Name;
 
@@ -39,6 +42,55 @@ struct FCommunicatorInitParameters
 
 	/** @brief Capabilities of the C# codebase used in the RL framework. */
 	FString CSharpCapabilities;
+
+	/** @brief Whether the per-step messages are built on reusable protobuf arenas. */
+	bool bUseArenaMessages = false;
+
+	/** @brief Whether exchanges run on a dedicated communicator thread, overlapping with the simulation. */
+	bool bOverlapExchange = false;
+
+	/** @brief Whether the timings of every step are appended to a CSV file next to the log. */
+	bool bWriteStatsCsv = false;
+
+	/** @brief Whether the communicator is one of several shards whose exchanges run concurrently. */
+	bool bSharded = false;
+
+	/** @brief Whether the side channel messages are sent to this trainer, only one shard sends them. */
+	bool bSendSideChannels = true;
+
+	/** @brief Whether a lost trainer is waited for on the same endpoint instead of quitting the environment. */
+	bool bReconnect = false;
+
+	/** @brief The default largest message, the default limit of gRPC. */
+	static constexpr int32 DefaultMaxMessageSize = 4 * 1024 * 1024;
+
+	/** @brief The smallest accepted message size, below it the chunks would be mostly overhead. */
+	static constexpr int32 MinMaxMessageSize = 64 * 1024;
+
+	/** @brief The largest message sent to or received from the trainer, in bytes. */
+	int32 MaxMessageSize = DefaultMaxMessageSize;
+
+	/**
+	 * @brief The longest a step waits for the reply of the trainer, in seconds, 0 to always wait. Past it the agents
+	 * keep their last actions and the reply is applied when it arrives. Ignored when bOverlapExchange is set.
+	 */
+	float ExchangeDeadline = 0.0f;
+
+	/**
+	 * @brief The number of micro-batches the agents of a step are split into, 1 to send them in one message. The
+	 * micro-batches are sent one after the other on the exchange stream, so the trainer decides for one while the
+	 * next is built and sent.
+	 */
+	int32 MicroBatches = 1;
+
+	/** @brief The metadata key carrying the index of an environment to a communicator gateway. */
+	static constexpr const char* GatewayIndexMetadataKey = "mlagent-gateway-index";
+
+	/**
+	 * @brief The index of the environment behind a communicator gateway, sent with every message so the gateway
+	 * tells the environments apart, INDEX_NONE when the trainer is reached directly.
+	 */
+	int32 GatewayIndex = INDEX_NONE;
 };
 
 /**
@@ -158,8 +210,12 @@ public:
 	 *
 	 * @param Name A unique identifier for the brain.
 	 * @param ActionSpec The specification of the actions the brain can take.
+	 * @param ActionBuffers The action storage of the agent, the actions decided for it are written straight into it.
+	 * @param OutAgentSlot Receives the slot identifying the agent within the brain in the other calls.
+	 * @return A compact handle identifying the brain in the other calls.
 	 */
-	virtual void SubscribeBrain(const FString& Name, FActionSpec ActionSpec) = 0;
+	virtual int32 SubscribeBrain(const FString& Name, FActionSpec ActionSpec, const FActionBuffers& ActionBuffers,
+		int32& OutAgentSlot) = 0;
 
 	/**
 	 * @brief Sends observations from an agent to the external trainer.
@@ -167,12 +223,13 @@ public:
 	 * This method is used to send agent observations to the external trainer, allowing it to process these observations
 	 * and return actions.
 	 *
-	 * @param BrainKey The key identifying the brain to which the agent belongs.
+	 * @param BehaviorHandle The handle returned by SubscribeBrain for the brain to which the agent belongs.
+	 * @param AgentSlot The slot of the agent returned by SubscribeBrain.
 	 * @param Info The agent's current state and observations.
 	 * @param Sensors A list of the sensors attached to the agent.
 	 */
-	virtual void PutObservations(
-		const FString& BrainKey, const FAgentInfo& Info, TArray<TScriptInterface<IISensor>>& Sensors) = 0;
+	virtual void PutObservations(int32 BehaviorHandle, int32 AgentSlot, const FAgentInfo& Info,
+		TArray<TScriptInterface<IISensor>>& Sensors) = 0;
 
 	/**
 	 * @brief Requests a decision from the external trainer for all agents.
@@ -188,9 +245,9 @@ public:
 	 * This method fetches the actions that the external trainer has determined for a specific agent based on the
 	 * observations sent.
 	 *
-	 * @param Key The key identifying the brain (agent) whose actions are requested.
-	 * @param AgentId The ID of the agent within that brain whose actions are requested.
+	 * @param BehaviorHandle The handle of the brain whose actions are requested.
+	 * @param AgentSlot The slot of the agent within that brain whose actions are requested.
 	 * @return The action buffers containing the actions for the agent.
 	 */
-	virtual const FActionBuffers GetActions(const FString& Key, int32 AgentId) = 0;
+	virtual const FActionBuffers GetActions(int32 BehaviorHandle, int32 AgentSlot) = 0;
 };
@@ -0,0 +1,53 @@
+// Copyright © 2025 Stephane Capponi and individual contributors. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "google/protobuf/arena.h"
+
+/**
+ * @class FReusableArena
+ * @brief A protobuf arena whose memory is kept between resets.
+ *
+ * The arena is seeded with an initial block owned by this class. Resetting the arena keeps that block, and the block
+ * grows to the high-water mark of the previous resets, so messages rebuilt on it every step stop touching the heap
+ * once the step size has stabilized.
+ */
+class UNREALMLAGENTS_API FReusableArena
+{
+public:
+	/**
+	 * @brief Creates the arena with an initial block of the given size.
+	 *
+	 * @param InitialBlockSize The size in bytes of the first retained block.
+	 */
+	explicit FReusableArena(int32 InitialBlockSize);
+
+	/**
+	 * @brief Returns the underlying protobuf arena used to allocate messages.
+	 *
+	 * @return The protobuf arena.
+	 */
+	google::protobuf::Arena* Get() const { return Arena.Get(); }
+
+	/**
+	 * @brief Releases every message allocated on the arena while keeping its memory.
+	 *
+	 * Messages allocated before the reset must not be used afterwards.
+	 */
+	void Reset();
+
+private:
+	/**
+	 * @brief Recreates the arena on top of a retained block of the given size.
+	 *
+	 * @param BlockSize The size in bytes of the retained block.
+	 */
+	void Allocate(int32 BlockSize);
+
+	/** Memory handed to the arena as its initial block. */
+	TArray<uint8> Block;
+
+	/** The protobuf arena built on top of the retained block. */
+	TUniquePtr<google::protobuf::Arena> Arena;
+};
@@ -3,10 +3,15 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
 #include "UnrealMLAgents/Actuators/ActionSpec.h"
+#include "UnrealMLAgents/Actuators/ActionSequence.h"
 #include "UnrealMLAgents/Grpc/CommunicatorObjects/AgentInfo.h"
 #include "grpc++/grpc++.h"
 #include "UnrealMLAgents/Communicator/ICommunicator.h"
+#include "UnrealMLAgents/Communicator/StepMessageBuffer.h"
+#include "UnrealMLAgents/Communicator/CommunicatorWorker.h"
+#include "UnrealMLAgents/Communicator/CommunicatorStats.h"
 #include "UnrealMLAgents/Sensors/ObservationWriter.h"
 #include "google/protobuf/repeated_field.h"
 #include "ueagents_envs/communicator_objects/unreal_to_external.grpc.pb.h"
@@ -22,6 +27,168 @@
 
 #include "RpcCommunicator.generated.h"
 
+/**
+ * @struct FPackedSensorObservations
+ * @brief The observations of one sensor for every agent of a behavior, gathered during a step to be packed together.
+ */
+struct FPackedSensorObservations
+{
+	/** @brief The observation spec shared by the sensor of every agent of the behavior. */
+	FObservationSpec ObsSpec;
+
+	/** @brief Whether the sensor asked for its observations to be compressed. */
+	bool bCompress = false;
+
+	/** @brief The agents sharing the observations of the sensor, none when the trainer cannot broadcast them. */
+	ESensorSharing Sharing = ESensorSharing::None;
+
+	/** @brief The number of observations in the data, one per agent unless the sensor is shared. */
+	int32 NumRows = 0;
+
+	/** @brief The observations of the agents, one after the other in the order the agents were added. */
+	google::protobuf::RepeatedField<float> Data;
+};
+
+/**
+ * @struct FOrderedAgent
+ * @brief An agent whose observations were sent, identified by its slot and the episode the observations belong to.
+ */
+struct FOrderedAgent
+{
+	/** @brief The slot of the agent in its behavior. */
+	int32 Slot;
+
+	/** @brief The episode of the agent when its observations were sent. */
+	int32 EpisodeId;
+};
+
+/**
+ * @struct FObservationScratch
+ * @brief The buffers an observation is written and encoded through, one set per thread serializing observations.
+ */
+struct FObservationScratch
+{
+	/** @brief Writer for capturing agent observations. */
+	ObservationWriter Writer;
+
+	/** @brief Buffer the sensors write into before their observations are encoded or compressed. */
+	google::protobuf::RepeatedField<float> Floats;
+
+	/** @brief Buffer the observations are encoded into before being compressed. */
+	std::string Encoded;
+};
+
+/**
+ * @struct FPendingObservation
+ * @brief An observation of a thread-safe sensor, its place in the step message is taken when the agent's
+ * observations are put and the sensor writes it when the step message is sent.
+ */
+struct FPendingObservation
+{
+	/** @brief The sensor writing the observation. */
+	TScriptInterface<IISensor> Sensor;
+
+	/** @brief The observation in the step message, null when the observations of the behavior are packed. */
+	communicator_objects::ObservationProto* ObservationProto = nullptr;
+
+	/** @brief The handle of the behavior of the agent. */
+	int32 BehaviorHandle = 0;
+
+	/** @brief The slot of the agent in its behavior. */
+	int32 Slot = 0;
+
+	/** @brief The index of the sensor among the sensors of the agent. */
+	int32 SensorIndex = 0;
+
+	/** @brief The row of the packed observations of the sensor the observation is written to. */
+	int32 PackedRow = 0;
+
+	/** @brief Whether the observation is sent as a delta against the last one sent for the slot. */
+	bool bDelta = false;
+};
+
+/**
+ * @struct FBehaviorState
+ * @brief The bookkeeping of a behavior subscribed to the communicator, found by its handle.
+ *
+ * The agents of the behavior are given slots, so the per-agent state lives in flat arrays and the hot path never
+ * converts or hashes the behavior name.
+ */
+struct FBehaviorState
+{
+	/** @brief The name of the behavior. */
+	FString Name;
+
+	/** @brief The name of the behavior as the UTF-8 key of the message maps. */
+	std::string Key;
+
+	/** @brief The number of discrete action mask entries of each agent. */
+	int32 ActionMaskSize = 0;
+
+	/** The action specification of the behavior, sent again to a new trainer after a reconnection. */
+	FActionSpec ActionSpec;
+
+	/** @brief The agents of the behavior in the current step message. */
+	communicator_objects::UnrealRLOutputProto_ListAgentInfoProto* AgentInfos = nullptr;
+
+	/** @brief The packed agents of the behavior in the current step message, added with the first packed agent. */
+	communicator_objects::UnrealRLOutputProto_PackedAgentInfoProto* PackedAgentInfos = nullptr;
+
+	/** @brief The agents requesting a decision in the current step, in the order their observations were added. */
+	TArray<FOrderedAgent> OrderedAgents;
+
+	/** @brief The agents whose observations are in flight, in order. */
+	TArray<FOrderedAgent> InFlightAgents;
+
+	/** @brief The agents sent in each micro-batch of the current step, in order. */
+	TArray<TArray<FOrderedAgent>> MicroBatchAgents;
+
+	/** @brief The episode of the agent in each slot, INDEX_NONE between episodes. */
+	TArray<int32> SlotEpisodeIds;
+
+	/** @brief The action storage registered by the agent of each slot, the actions are decoded straight into it. */
+	TArray<FActionBuffers> Actions;
+
+	/** @brief Whether actions were received for the current decision of the agent in each slot. */
+	TArray<bool> HasActions;
+
+	/** @brief The action sequence registered by the agent of each slot, null if the agent plays single steps. */
+	TArray<TSharedPtr<FActionSequence>> ActionSequences;
+
+	/**
+	 * @brief Whether the agent in each slot acted on stale actions since its last observations were sent, because
+	 * the reply of the trainer was late. The flag goes out with its next observations.
+	 */
+	TArray<bool> StaleActions;
+
+	/** @brief The rewards of the agent in each slot for the steps skipped while the reply of the trainer was late. */
+	TArray<float> SkippedRewards;
+
+	/** @brief The group rewards of the agent in each slot for the steps skipped while the reply was late. */
+	TArray<float> SkippedGroupRewards;
+
+	/** @brief The observations last sent for the agent in each slot and each sensor, the base of delta observations. */
+	TArray<TArray<TArray<float>>> DeltaBases;
+
+	/** @brief The observations of each sensor gathered for the packed step message. */
+	TArray<FPackedSensorObservations> PackedObservations;
+
+	/**
+	 * @brief The observations of shared sensors already in the current step message, by sensor index and group id
+	 * (0 for the whole behavior). Holds the index of the agent that sent them, or their row when packed.
+	 */
+	TMap<FIntPoint, int32> SharedObservations;
+
+	/**
+	 * @brief The observation spec of each sensor registered with the trainer in the brain parameters, taken from the
+	 * first agent that puts its observations. Empty when the trainer reads the specs from the observations.
+	 */
+	TArray<FObservationSpec> ObservationSpecs;
+
+	/** @brief The name of each sensor registered with the trainer. */
+	TArray<FString> ObservationNames;
+};
+
 /**
  * @class URpcCommunicator
  * @brief A communicator class that manages gRPC-based communication between Unreal Engine and external systems.
@@ -68,22 +235,29 @@ public:
 		const FCommunicatorInitParameters& InitParameters, FUnrealRLInitParameters& InitParametersOut) override;
 
 	/**
-	 * @brief Subscribes a brain to the communicator by registering the brain's name and action specification.
+	 * @brief Subscribes an agent of a brain to the communicator by registering the brain's name and action
+	 * specification, and the storage the agent's actions are decoded into.
 	 *
 	 * @param Name The name of the brain (behavior).
 	 * @param ActionSpec The specification of the brain's action space.
+	 * @param ActionBuffers The action storage of the agent, replaced by storage owned by the communicator when its
+	 * size does not match the action specification.
+	 * @param OutAgentSlot Receives the slot of the agent within the behavior.
+	 * @return The handle of the behavior, the same for every subscription with the same name.
 	 */
-	virtual void SubscribeBrain(const FString& Name, FActionSpec ActionSpec) override;
+	virtual int32 SubscribeBrain(const FString& Name, FActionSpec ActionSpec, const FActionBuffers& ActionBuffers,
+		int32& OutAgentSlot) override;
 
 	/**
 	 * @brief Sends agent observations to the external system for decision-making.
 	 *
-	 * @param BrainKey The key of the brain to which the observations belong.
+	 * @param BehaviorHandle The handle of the behavior to which the observations belong.
+	 * @param AgentSlot The slot of the agent within the behavior.
 	 * @param Info Information about the agent's current state.
 	 * @param Sensors A list of sensors that generate the observations.
 	 */
-	virtual void PutObservations(
-		const FString& BrainKey, const FAgentInfo& Info, TArray<TScriptInterface<IISensor>>& Sensors) override;
+	virtual void PutObservations(int32 BehaviorHandle, int32 AgentSlot, const FAgentInfo& Info,
+		TArray<TScriptInterface<IISensor>>& Sensors) override;
 
 	/**
 	 * @brief Requests the external system to decide actions for the current batch of agents.
@@ -93,11 +267,21 @@ public:
 	/**
 	 * @brief Retrieves the actions decided by the external system for a specific agent.
 	 *
-	 * @param Key The key of the brain for which actions are requested.
-	 * @param AgentId The ID of the agent for which actions are requested.
+	 * @param BehaviorHandle The handle of the behavior for which actions are requested.
+	 * @param AgentSlot The slot of the agent for which actions are requested.
 	 * @return A constant reference to the action buffers containing the agent's actions.
 	 */
-	virtual const FActionBuffers GetActions(const FString& Key, int32 AgentId) override;
+	virtual const FActionBuffers GetActions(int32 BehaviorHandle, int32 AgentSlot) override;
+
+	/**
+	 * @brief Registers the action sequence of an agent, the sequences of actions the trainer replies with are
+	 * decoded straight into it.
+	 *
+	 * @param BehaviorHandle The handle of the behavior of the agent.
+	 * @param AgentSlot The slot of the agent within the behavior.
+	 * @param Sequence The action sequence played back by the agent.
+	 */
+	void SetActionSequence(int32 BehaviorHandle, int32 AgentSlot, const TSharedPtr<FActionSequence>& Sequence);
 
 	/**
 	 * @brief Initializes properties after the object is constructed.
@@ -106,9 +290,65 @@ public:
 
 	/**
 	 * @brief Closes the communication channel gracefully.
+	 *
+	 * The exchange the communicator thread waits on is cancelled and the quit message is bounded by
+	 * QuitTimeoutSeconds, so a trainer that stopped answering cannot block the game thread.
 	 */
 	void Dispose();
 
+	/**
+	 * @brief Returns the timings of the recent steps, split by phase, and the bytes they exchanged.
+	 *
+	 * @return The statistics of the communicator.
+	 */
+	const FCommunicatorStats& GetStats() const { return Stats; }
+
+	/**
+	 * @brief Sets the shards whose exchanges run together with the ones of this communicator.
+	 *
+	 * When the exchange is not overlapped, the first decision of a step sends the step messages of every shard at
+	 * once and waits for all the replies, so the trainers work concurrently.
+	 *
+	 * @param InShardGroup Every shard of the group, this communicator included.
+	 */
+	void SetShardGroup(const TArray<URpcCommunicator*>& InShardGroup);
+
+protected:
+	/**
+	 * @brief Tells whether the exchange in progress should be given up.
+	 *
+	 * @return True once the exchanges were cancelled or the quit message ran out of time.
+	 */
+	bool ShouldAbandonExchange() const;
+
+	/**
+	 * @brief Establishes the communication channel with the external system using the specified port.
+	 *
+	 * The channel connects to the Unix domain socket given at initialization instead when there is one.
+	 *
+	 * @param Port The port number to use for communication.
+	 * @return True if the connection was established successfully, false otherwise.
+	 */
+	virtual bool EstablishConnection(int32 Port);
+
+	/**
+	 * @brief Sends a message to the external system and receives its reply over the transport.
+	 *
+	 * This is the only transport-specific part of the exchange, it may be called from the communicator thread.
+	 * gRPC serializes the request inside the call, so only sizing it is counted as serialization, the rest of the
+	 * encoding being part of the exchange. A request larger than the trainer accepts is serialized once and sent in
+	 * chunks the trainer reassembles.
+	 *
+	 * @param Request The message to send to the external system.
+	 * @param Response The message the reply is received into.
+	 * @param OutErrorMessage The reason of the failure when the transport fails.
+	 * @param OutTimings Receives the time spent serializing the request and the sizes of both messages.
+	 * @return True if a reply was received, false if the transport failed.
+	 */
+	virtual bool TransportExchange(const communicator_objects::UnrealMessageProto& Request,
+		communicator_objects::UnrealMessageProto& Response, std::string& OutErrorMessage,
+		FCommunicatorStepTimings& OutTimings);
+
 private:
 	/** Indicates whether the communication channel is open. */
 	bool bIsOpen;
@@ -119,12 +359,154 @@ private:
 	/** The gRPC communication channel used for client-server communication. */
 	std::shared_ptr<grpc::Channel> Channel;
 
+	/** The context of the exchange stream, it outlives the stream. */
+	std::unique_ptr<grpc::ClientContext> StreamContext;
+
+	/** The context of the unary exchange in progress, null between exchanges. */
+	grpc::ClientContext* ExchangeContext;
+
+	/** Whether the exchanges were cancelled, no new call starts until Dispose has stopped the thread. */
+	std::atomic<bool> bExchangesCancelled;
+
+	/** The stream the steps are exchanged over when the trainer serves ExchangeStream, opened by the first step. */
+	std::unique_ptr<grpc::ClientReaderWriter<communicator_objects::UnrealMessageProto,
+		communicator_objects::UnrealMessageProto>>
+		Stream;
+
+	/** Guards the stream and the exchange contexts, which the game thread may cancel during an exchange. */
+	FCriticalSection StreamLock;
+
+	/** The seconds the quit message waits for the trainer when the communicator is disposed. */
+	static constexpr double QuitTimeoutSeconds = 5.0;
+
+	/** The time after which the quit message is given up, zero until the communicator is disposed. */
+	std::atomic<double> QuitDeadline;
+
+	/**
+	 * @brief Cancels the exchange the communicator thread waits on and keeps new ones from starting.
+	 */
+	void CancelExchanges();
+
+	/**
+	 * @brief Bounds a call by the deadline of the quit message, if the communicator is being disposed.
+	 *
+	 * @param Context The context of the call.
+	 */
+	void ApplyQuitDeadline(grpc::ClientContext& Context) const;
+
+	/**
+	 * @brief Exchanges a message over the long-lived stream, opening it first if needed.
+	 *
+	 * The stream is closed when the exchange fails, the next exchange opens a new one.
+	 *
+	 * @param Request The message to send to the external system.
+	 * @param Response The message the reply is received into, null to only send a chunk the trainer does not answer.
+	 * @param OutErrorMessage The reason of the failure when the stream fails.
+	 * @return True if the message was sent and its reply received, false if the stream failed.
+	 */
+	bool StreamExchange(const communicator_objects::UnrealMessageProto& Request,
+		communicator_objects::UnrealMessageProto* Response, std::string& OutErrorMessage);
+
+	/**
+	 * @brief Opens the exchange stream if it is not open yet.
+	 *
+	 * @param OutErrorMessage The reason of the failure when the channel is shut down.
+	 * @return True if the stream is open.
+	 */
+	bool OpenStream(std::string& OutErrorMessage);
+
+	/**
+	 * @brief Sizes a request and serializes it for chunking when it is over the limit of the trainer.
+	 *
+	 * @param Request The message to send to the external system.
+	 * @param OutTimings Receives the time spent serializing the request and its size.
+	 * @return True if the request must be sent in chunks, from ChunkedRequest.
+	 */
+	bool PrepareRequest(const communicator_objects::UnrealMessageProto& Request, FCommunicatorStepTimings& OutTimings);
+
+	/**
+	 * @brief Exchanges a message over the stream or in a unary call, whichever the trainer serves.
+	 *
+	 * @param Request The message to send to the external system.
+	 * @param Response The message the reply is received into, null for the chunks before the last one, which the
+	 * trainer only acknowledges in unary calls.
+	 * @param OutErrorMessage The reason of the failure when the transport fails.
+	 * @return True if the message was sent and its reply received, false if the transport failed.
+	 */
+	bool ExchangeMessage(const communicator_objects::UnrealMessageProto& Request,
+		communicator_objects::UnrealMessageProto* Response, std::string& OutErrorMessage);
+
+	/**
+	 * @brief Sends the serialized request in chunks and receives the reply to the whole message with the last one.
+	 *
+	 * @param Response The message the reply is received into.
+	 * @param OutErrorMessage The reason of the failure when the transport fails.
+	 * @return True if a reply was received, false if the transport failed.
+	 */
+	bool ExchangeChunks(communicator_objects::UnrealMessageProto& Response, std::string& OutErrorMessage);
+
+	/**
+	 * @brief Writes a micro-batch on the exchange stream without waiting for its reply, on the communicator thread.
+	 *
+	 * The stream is only cancelled when the write fails, the game thread reading the replies releases it.
+	 *
+	 * @param Request The micro-batch to send.
+	 * @param OutErrorMessage The reason of the failure when the stream fails.
+	 * @param OutTimings Receives the time spent serializing and writing the micro-batch, and its size.
+	 * @return True if the micro-batch was written.
+	 */
+	bool WriteMicroBatch(const communicator_objects::UnrealMessageProto& Request, std::string& OutErrorMessage,
+		FCommunicatorStepTimings& OutTimings);
+
+	/**
+	 * @brief Cancels and releases the exchange stream, if one is open.
+	 *
+	 * Must not be called while an exchange runs on the stream.
+	 *
+	 * @return The final status of the stream.
+	 */
+	grpc::Status CloseStream();
+
 	/**
 	 * @brief Notifies the system to quit and shuts down the gRPC communication channel.
 	 */
 	UFUNCTION()
 	void NotifyQuitAndShutDownChannel();
 
+	/**
+	 * @brief Shuts down the communication channel without notifying anyone.
+	 */
+	void ShutDownChannel();
+
+	/**
+	 * @brief Handles the loss of the trainer.
+	 *
+	 * Without reconnection the quit command is raised. Otherwise the communicator waits for a new trainer on the
+	 * same endpoint, leaving the environment running.
+	 */
+	void HandleDisconnect();
+
+	/**
+	 * @brief Runs the handshake with the trainer using the parameters given at initialization.
+	 *
+	 * @param InitParametersOut The initialization parameters received from the trainer.
+	 * @param OutRlInput The first input of the trainer, whose command and side channel data are left to apply.
+	 * @return True if the handshake succeeded, false otherwise.
+	 */
+	bool Handshake(FUnrealRLInitParameters& InitParametersOut, communicator_objects::UnrealRLInputProto& OutRlInput);
+
+	/**
+	 * @brief Tries to connect to a new trainer, at most once per ReconnectIntervalSeconds.
+	 *
+	 * Once connected, the behaviors are announced again and the environment resumes from a reset.
+	 */
+	void TryReconnect();
+
+	/**
+	 * @brief Forgets everything the previous trainer knew: agents in flight, delta bases and sent behaviors.
+	 */
+	void ResetConnectionState();
+
 	/**
 	 * @brief Initializes the communication with the external system, including port setup and message exchange.
 	 *
@@ -158,22 +540,63 @@ private:
 		const FString& unrealCommunicationVersion, const FString& pythonApiVersion);
 
 	/**
-	 * @brief Establishes the communication channel with the external system using the specified port.
+	 * @brief Sends and receives a message to/from the external system over gRPC.
 	 *
-	 * @param Port The port number to use for communication.
-	 * @return True if the connection was established successfully, false otherwise.
+	 * @param Request The message to send to the external system.
+	 * @param Response The response received from the external system.
+	 * @param OutTimings The timings the serialization and exchange times and the message sizes are added to.
+	 * @return True if the message exchange was successful, false otherwise.
 	 */
-	bool EstablishConnection(int32 Port);
+	bool SendAndReceiveMessage(const communicator_objects::UnrealMessageProto& Request,
+		communicator_objects::UnrealMessageProto& Response, FCommunicatorStepTimings& OutTimings);
 
 	/**
-	 * @brief Sends and receives a message to/from the external system over gRPC.
+	 * @brief Runs the transport exchange and records how long it took, excluding the serialization.
 	 *
 	 * @param Request The message to send to the external system.
-	 * @param Response The response received from the external system.
-	 * @return True if the message exchange was successful, false otherwise.
+	 * @param Response The message the reply is received into.
+	 * @param OutErrorMessage The reason of the failure when the transport fails.
+	 * @param OutTimings The timings the serialization and exchange times and the message sizes are added to.
+	 * @return True if a reply was received, false if the transport failed.
 	 */
-	bool SendAndReceiveMessage(
-		const communicator_objects::UnrealMessageProto& Request, communicator_objects::UnrealMessageProto& Response);
+	bool TimedTransportExchange(const communicator_objects::UnrealMessageProto& Request,
+		communicator_objects::UnrealMessageProto& Response, std::string& OutErrorMessage,
+		FCommunicatorStepTimings& OutTimings);
+
+	/**
+	 * @brief Allocates the persistent step message buffers.
+	 *
+	 * A second buffer is allocated when the exchange is overlapped, so the next step can be built while the previous
+	 * one is in flight.
+	 */
+	void CreateStepBuffers();
+
+	/**
+	 * @brief Points each behavior at its agent list in the current step message.
+	 *
+	 * Called whenever the current step message changes, the packed agents are added back by the first packed agent.
+	 */
+	void BindBehaviorMessages();
+
+	/**
+	 * @brief Adds a slot for an agent of a behavior.
+	 *
+	 * @param Behavior The behavior of the agent.
+	 * @param ActionSpec The specification of the behavior's action space.
+	 * @param ActionBuffers The action storage of the agent.
+	 * @return The slot of the agent.
+	 */
+	static int32 AddAgentSlot(
+		FBehaviorState& Behavior, const FActionSpec& ActionSpec, const FActionBuffers& ActionBuffers);
+
+	/**
+	 * @brief Starts a new episode in the slot of an agent, forgetting the actions and delta bases of the previous one.
+	 *
+	 * @param Behavior The behavior of the agent.
+	 * @param AgentSlot The slot of the agent.
+	 * @param EpisodeId The new episode of the agent, INDEX_NONE once its episode is done.
+	 */
+	static void ResetAgentSlot(FBehaviorState& Behavior, int32 AgentSlot, int32 EpisodeId);
 
 	/**
 	 * @brief Caches the action specification for a specific brain.
@@ -188,13 +611,110 @@ private:
 	 */
 	void SendBatchedMessageHelper();
 
+	/**
+	 * @brief Completes the current step message before it is sent.
+	 *
+	 * The observations of the thread-safe sensors are written, the packed observations and the brain parameters of
+	 * the new behaviors are added, as well as the side channel messages when asked.
+	 *
+	 * @param Buffer The step buffer holding the current step message.
+	 * @param bWithSideChannels Whether the side channel messages go with this message.
+	 * @return The brain parameters added to the message, null if there were none.
+	 */
+	TSharedPtr<communicator_objects::UnrealRLInitializationOutputProto> FinishStepMessage(
+		FStepMessageBuffer& Buffer, bool bWithSideChannels);
+
+	/**
+	 * @brief Hands the current micro-batch to the communicator thread and starts the next one on the next buffer.
+	 *
+	 * @param bLastOfStep Whether the micro-batch is the last one of the step, it carries the side channel messages.
+	 * @param OutErrorMessage The reason of the failure when the stream cannot be opened.
+	 * @return True if the micro-batch was handed to the communicator thread.
+	 */
+	bool SubmitMicroBatch(bool bLastOfStep, std::string& OutErrorMessage);
+
+	/**
+	 * @brief Sends the last micro-batch of the step and applies the reply of every micro-batch as it arrives.
+	 *
+	 * The micro-batches were written in order by the communicator thread, the trainer answers them in the same
+	 * order, so each reply is decoded while the trainer works on the next micro-batch.
+	 */
+	void DecideMicroBatches();
+
+	/**
+	 * @brief Runs the overlapped exchange for the current step.
+	 *
+	 * The reply of the exchange in flight is applied if it has arrived, and the observations of the step are handed
+	 * to the communicator thread without waiting for the trainer.
+	 */
+	void DecideBatchOverlapped();
+
+	/**
+	 * @brief Runs the exchanges of every shard of the group concurrently and applies their replies.
+	 */
+	void DecideShardBatches();
+
+	/**
+	 * @brief Runs the exchange for the current step, waiting for the reply at most ExchangeDeadline seconds.
+	 *
+	 * When the reply is late the agents in flight keep their last actions and are flagged as stale. Later steps
+	 * apply the reply once it arrives, until then the decisions of the agents are skipped.
+	 */
+	void DecideBatchWithDeadline();
+
+	/**
+	 * @brief Whether the steps wait for the trainer at most ExchangeDeadline seconds. The overlapped exchange takes
+	 * precedence, its steps never wait for the trainer.
+	 *
+	 * @return True if the exchange has a deadline.
+	 */
+	bool UsesDeadline() const { return ExchangeDeadline > 0.0f && !bOverlapExchange; }
+
+	/**
+	 * @brief Whether the exchanges run on the communicator thread, either overlapped, bounded by a deadline or
+	 * alongside other shards.
+	 *
+	 * @return True if the communicator uses a worker thread.
+	 */
+	bool UsesWorker() const { return bOverlapExchange || bSharded || UsesDeadline(); }
+
+	/**
+	 * @brief Hands the current step message to the communicator thread and starts the next step on the other buffer.
+	 */
+	void SubmitBatchedMessage();
+
+	/**
+	 * @brief Applies the reply of the exchange in flight.
+	 *
+	 * @param bWait Whether to block until the reply arrives.
+	 */
+	void CollectBatchedMessage(bool bWait);
+
+	/**
+	 * @brief Applies the result of the exchange in flight, disconnecting when it failed.
+	 *
+	 * @param Result The result of the exchange retrieved from the communicator thread.
+	 */
+	void ApplyExchangeResult(const FExchangeResult& Result);
+
+	/**
+	 * @brief Applies the commands and actions received from the external system.
+	 *
+	 * @param RlInput The RL input received from the external system.
+	 * @param bInFlight Whether the input answers the agents in flight rather than the ones of the current step. The
+	 * answered agents are emptied once applied.
+	 */
+	void ApplyRlInput(const communicator_objects::UnrealRLInputProto& RlInput, bool bInFlight);
+
 	/**
 	 * @brief Exchanges data between Unreal Engine and the external system during communication.
 	 *
-	 * @param UnrealOutput The output data from Unreal Engine.
+	 * The returned input lives in the response of the buffer and stays valid until its next exchange.
+	 *
+	 * @param Buffer The step buffer holding the wrapped output data from Unreal Engine.
 	 * @return The input data received from the external system.
 	 */
-	communicator_objects::UnrealInputProto Exchange(const communicator_objects::UnrealOutputProto* UnrealOutput);
+	const communicator_objects::UnrealInputProto& Exchange(FStepMessageBuffer& Buffer);
 
 	/**
 	 * @brief Retrieves temporary initialization output data for Unreal's RL environment.
@@ -221,23 +741,155 @@ private:
 	/**
 	 * @brief Converts an Unreal Engine sensor's observation into a gRPC ObservationProto message.
 	 *
+	 * The float buffer of the message is sized once and the sensor writes straight into it, so the message can be
+	 * the one that goes out on the wire.
+	 *
+	 * It only touches the given scratch buffers, so observations of thread-safe sensors are written concurrently.
+	 *
 	 * @param Sensor The Unreal Engine sensor interface that gathers observations.
-	 * @param ObsWriter The writer used to record the sensor's observations into the ObservationProto.
-	 * @return The generated gRPC `ObservationProto` message for communication with external systems.
+	 * @param Scratch The writer and buffers the observation goes through.
+	 * @param ObservationProto The gRPC `ObservationProto` message to fill.
+	 * @param DeltaBase The observation last sent for this sensor and episode, updated with the new one. When set,
+	 * only the elements that changed are sent if they are few enough.
+	 * @param RegisteredSpec The spec registered with the trainer for this sensor, if any. The shape, dimension
+	 * properties and name are left out of the message while the spec of the sensor still matches it.
+	 */
+	void GetObservationProto(TScriptInterface<IISensor> Sensor, FObservationScratch& Scratch,
+		communicator_objects::ObservationProto& ObservationProto, TArray<float>* DeltaBase = nullptr,
+		const FObservationSpec* RegisteredSpec = nullptr) const;
+
+	/**
+	 * @brief Fills the shape, dimension properties and name of an ObservationProto from a sensor.
+	 *
+	 * @param Sensor The sensor the observation comes from.
+	 * @param ObsSpec The observation spec of the sensor.
+	 * @param ObservationProto The gRPC `ObservationProto` message to fill.
+	 */
+	static void SetObservationMetadata(TScriptInterface<IISensor> Sensor, const FObservationSpec& ObsSpec,
+		communicator_objects::ObservationProto& ObservationProto);
+
+	/**
+	 * @brief Fills the shape, dimension properties and name of an ObservationProto.
+	 *
+	 * @param ObsSpec The observation spec of the sensor.
+	 * @param SensorName The name of the sensor, left out when empty.
+	 * @param ObservationProto The gRPC `ObservationProto` message to fill.
+	 */
+	static void SetObservationMetadata(const FObservationSpec& ObsSpec, const FString& SensorName,
+		communicator_objects::ObservationProto& ObservationProto);
+
+	/**
+	 * @brief Registers the observation specs of a behavior from the sensors of one of its agents, once.
+	 *
+	 * @param Behavior The behavior of the agent.
+	 * @param Sensors The sensors of the agent.
+	 */
+	static void RegisterObservationSpecs(FBehaviorState& Behavior, const TArray<TScriptInterface<IISensor>>& Sensors);
+
+	/**
+	 * @brief Returns the key the observations of a shared sensor are found by in the current step message.
+	 *
+	 * @param Sharing The agents sharing the observations of the sensor.
+	 * @param SensorIndex The index of the sensor among the sensors of the agent.
+	 * @param Info The agent putting its observations.
+	 * @param OutKey Receives the sensor index and the group id, 0 when the whole behavior shares the observations.
+	 * @return True if the agent shares the observations of the sensor with other agents.
+	 */
+	static bool GetSharedObservationKey(
+		ESensorSharing Sharing, int32 SensorIndex, const FAgentInfo& Info, FIntPoint& OutKey);
+
+	/**
+	 * @brief Returns the spec registered with the trainer for a sensor of a behavior.
+	 *
+	 * @param Behavior The behavior of the agent.
+	 * @param SensorIndex The index of the sensor among the sensors of the agent.
+	 * @return The registered spec, null when the specs are not registered or the agent has more sensors.
+	 */
+	const FObservationSpec* GetRegisteredSpec(const FBehaviorState& Behavior, int32 SensorIndex) const;
+
+	/**
+	 * @brief Encodes the data written by the ObservationWriter as `Float16` or `UInt8` into an ObservationProto.
+	 *
+	 * @param Writer The writer targeting the observation data.
+	 * @param ObsSpec The observation spec declaring the encoding, scale and offset.
+	 * @param bCompress Whether the encoded data is compressed with zlib when it pays off.
+	 * @param EncodedScratch The buffer the data is encoded into before being compressed.
+	 * @param ObservationProto The gRPC `ObservationProto` message to fill.
+	 */
+	static void EncodeObservation(const ObservationWriter& Writer, const FObservationSpec& ObsSpec, bool bCompress,
+		std::string& EncodedScratch, communicator_objects::ObservationProto& ObservationProto);
+
+	/**
+	 * @brief Adds the state and observations of an agent to the packed arrays of its behavior.
+	 *
+	 * The sensors are described once per behavior and step, the observations of every agent being appended to the
+	 * same buffer until PackObservations writes them into the message.
+	 *
+	 * @param Behavior The behavior of the agent.
+	 * @param BehaviorHandle The handle of the behavior.
+	 * @param Info Information about the agent's current state.
+	 * @param Sensors The sensors of the agent, the same for every agent of the behavior.
+	 * @return True if the agent was packed, false if its sensors differ from the ones of the behavior.
+	 */
+	bool PutPackedObservations(FBehaviorState& Behavior, int32 BehaviorHandle, const FAgentInfo& Info,
+		TArray<TScriptInterface<IISensor>>& Sensors);
+
+	/**
+	 * @brief Writes the observations gathered by PutPackedObservations into the current step message.
+	 *
+	 * Each sensor of a behavior becomes a single little-endian blob shaped [num_agents, *shape], encoded and
+	 * compressed as the sensor asks.
+	 */
+	void PackObservations();
+
+	/**
+	 * @brief Writes the observations of the thread-safe sensors put during the step into the step message.
+	 *
+	 * The observations are split into contiguous ranges written in parallel, each with its own scratch buffers.
+	 * Their places in the message were taken in agent order when they were put, so the order is unchanged.
+	 */
+	void WritePendingObservations();
+
+	/**
+	 * @brief Writes one deferred observation into the step message.
+	 *
+	 * @param Pending The observation to write.
+	 * @param TaskScratch The scratch buffers of the thread writing it.
+	 */
+	void WritePendingObservation(const FPendingObservation& Pending, FObservationScratch& TaskScratch);
+
+	/**
+	 * @brief Compresses observation data with zlib into the `compressed_data` payload of an ObservationProto.
+	 *
+	 * The data is sent in memory order, every platform Unreal ships on is little-endian.
+	 *
+	 * @param Data The observation data, as floats or encoded by the ObservationWriter.
+	 * @param UncompressedSize The size of the data in bytes.
+	 * @param ObservationProto The gRPC `ObservationProto` message to fill.
+	 * @return True if the data was compressed, false if it should be sent uncompressed instead.
 	 */
-	communicator_objects::ObservationProto GetObservationProto(
-		TScriptInterface<IISensor> Sensor, ObservationWriter& ObsWriter);
+	static bool CompressObservation(
+		const void* Data, int32 UncompressedSize, communicator_objects::ObservationProto& ObservationProto);
 
 	/**
-	 * @brief Converts gRPC `AgentActionProto` messages into Unreal Engine's action buffers.
+	 * @brief Delivers the side channel messages of a reply to the registered side channels.
 	 *
-	 * This method is responsible for translating the actions provided by the external system
-	 * into Unreal Engine's `FActionBuffers` format for use by agents.
+	 * @param RlInput The reply of the trainer.
+	 */
+	static void ProcessSideChannelData(const communicator_objects::UnrealRLInputProto& RlInput);
+
+	/**
+	 * @brief Decodes a gRPC `AgentActionProto` message straight into an agent's action storage.
+	 *
+	 * Missing actions are set to zero and extra ones are dropped. The first step of a sequence of actions goes to the
+	 * action storage like a single step, the whole sequence to the action sequence of the agent.
 	 *
 	 * @param Proto The gRPC `AgentActionProto` received from the external system.
-	 * @return Unreal Engine `FActionBuffers` containing the actions to be performed by the agent.
+	 * @param ActionBuffers The action storage of the agent.
+	 * @param Sequence The action sequence of the agent, null if the agent plays single steps.
 	 */
-	FActionBuffers ToActionBuffers(const communicator_objects::AgentActionProto& Proto);
+	static void ScatterActions(const communicator_objects::AgentActionProto& Proto, FActionBuffers& ActionBuffers,
+		FActionSequence* Sequence);
 
 	/**
 	 * @brief Converts Unreal Engine's action specification into a gRPC `ActionSpecProto`.
@@ -250,17 +902,6 @@ private:
 	 */
 	communicator_objects::ActionSpecProto ToActionSpecProto(const FActionSpec& ActionSpec);
 
-	/**
-	 * @brief Converts a list of gRPC agent actions to Unreal Engine action buffers.
-	 *
-	 * This method processes a list of gRPC agent actions and converts them into a format that can be
-	 * interpreted by Unreal Engine agents.
-	 *
-	 * @param Proto The list of `UnrealRLInputProto_ListAgentActionProto` actions from the external system.
-	 * @return A list of Unreal Engine `FActionBuffers` corresponding to the actions.
-	 */
-	TArray<FActionBuffers> ToAgentActionList(const communicator_objects::UnrealRLInputProto_ListAgentActionProto Proto);
-
 	/**
 	 * @brief Converts Unreal Engine's `FActionSpec` and training status into a gRPC `BrainParametersProto`.
 	 *
@@ -279,12 +920,13 @@ private:
 	 * @brief Converts Unreal Engine's `FAgentInfo` into a gRPC `AgentInfoProto` message.
 	 *
 	 * This method translates the information about an agent's state into a format (`AgentInfoProto`)
-	 * that can be understood by external systems.
+	 * that can be understood by external systems. The message is filled in place so it can be built directly
+	 * inside the outgoing step message.
 	 *
 	 * @param Info The Unreal Engine `FAgentInfo` struct containing the agent's state and details.
-	 * @return A `AgentInfoProto` message for communication with external systems.
+	 * @param AgentInfoProto The `AgentInfoProto` message to fill.
 	 */
-	communicator_objects::AgentInfoProto ToAgentInfoProto(const FAgentInfo& Info);
+	void ToAgentInfoProto(const FAgentInfo& Info, communicator_objects::AgentInfoProto& AgentInfoProto);
 
 	/** Event handler for quit commands. */
 	FQuitCommandHandler QuitCommandReceived;
@@ -298,17 +940,155 @@ private:
 	/** Indicates whether communication is needed in the current step. */
 	bool bNeedCommunicateThisStep;
 
-	/** Writer for capturing agent observations. */
-	ObservationWriter ObsWriter;
+	/** The scratch buffers of the observations written on the game thread. */
+	FObservationScratch Scratch;
+
+	/** The observations of thread-safe sensors waiting for the step message to be sent, in agent order. */
+	TArray<FPendingObservation> PendingObservations;
+
+	/** The scratch buffers of the tasks writing the pending observations, kept to reuse their memory. */
+	TArray<FObservationScratch> TaskScratches;
+
+	/** The fewest pending observations worth a task of their own. */
+	static constexpr int32 MinObservationsPerTask = 64;
+
+	/** Whether the step messages are allocated on reusable arenas. */
+	bool bUseArena;
+
+	/** Whether exchanges run on the communicator thread, overlapping with the simulation. */
+	bool bOverlapExchange;
+
+	/** Whether the communicator is one of several shards whose exchanges run concurrently. */
+	bool bSharded;
+
+	/** The longest a step waits for the reply of the trainer in seconds, 0 to always wait. */
+	float ExchangeDeadline;
+
+	/** The number of micro-batches the agents of a step are split into, as asked at initialization. */
+	int32 NumMicroBatches;
+
+	/** Whether the steps are sent in micro-batches, which needs the trainer to serve the exchange stream. */
+	bool bMicroBatching;
+
+	/** The agents in each micro-batch but the last, sized from the previous step. 0 sends the step in one message. */
+	int32 MicroBatchSize;
 
-	/** A map storing agent decision requests for each brain. */
-	TMap<FString, TArray<int32>> OrderedAgentsRequestingDecisions;
+	/** The agents put in the micro-batch being built. */
+	int32 NumMicroBatchAgents;
 
-	/** A pointer to the current UnrealRLOutput being sent to the external system. */
-	TUniquePtr<communicator_objects::UnrealRLOutputProto> CurrentUnrealRlOutput;
+	/** The agents put during the current step, the next step is split from it. */
+	int32 NumStepAgents;
 
-	/** A map storing the last actions received for each brain and agent. */
-	TMap<FString, TMap<int32, FActionBuffers>> LastActionsReceived;
+	/** Whether the side channel messages are sent with the step messages of this communicator. */
+	bool bSendSideChannels;
+
+	/** The shards whose exchanges run together, empty when the communicator is not sharded. */
+	TArray<TWeakObjectPtr<URpcCommunicator>> ShardGroup;
+
+	/** Path of the Unix domain socket the channel connects to, empty to connect over TCP. */
+	FString SocketPath;
+
+	/** Whether the trainer can decode compressed observations, as announced during the handshake. */
+	bool bCompressObservations;
+
+	/** Observations smaller than this many bytes are never compressed, the saving would not pay for the CPU time. */
+	static constexpr int32 MinCompressedObservationBytes = 1024;
+
+	/** Whether the trainer can decode quantized observations, as announced during the handshake. */
+	bool bQuantizeObservations;
+
+	/** Whether the trainer can reconstruct delta-encoded observations, as announced during the handshake. */
+	bool bDeltaObservations;
+
+	/**
+	 * Whether the trainer can read the agents of a behavior packed into contiguous arrays, as announced during the
+	 * handshake. Delta observations are not used when the agents are packed.
+	 */
+	bool bPackObservations;
+
+	/** Whether the trainer may reply with actions for several steps, as announced during the handshake. */
+	bool bActionSequences;
+
+	/**
+	 * Whether the trainer can broadcast the observations of shared sensors to the agents sharing them, as announced
+	 * during the handshake.
+	 */
+	bool bSharedObservations;
+
+	/**
+	 * Whether the trainer serves ExchangeStream, as announced during the handshake. The steps then share one stream
+	 * instead of paying for a new call each.
+	 */
+	bool bStreamExchange;
+
+	/**
+	 * Whether the trainer reads the observation specs from the brain parameters, as announced during the handshake.
+	 * The observations whose spec matches the registered one are then sent without their shape and name.
+	 */
+	bool bRegisterObservationSpecs;
+
+	/**
+	 * The largest message both the trainer and this communicator accept, negotiated during the handshake. Larger step
+	 * messages are sent in chunks, 0 when the trainer cannot reassemble them.
+	 */
+	int32 MaxStepMessageSize;
+
+	/** The bytes a chunk message adds around its slice of the step message. */
+	static constexpr int32 ChunkOverheadBytes = 64;
+
+	/** The step message being sent in chunks, serialized once and kept to reuse its memory. */
+	std::string ChunkedRequest;
+
+	/** The message carrying each chunk, kept to reuse its memory. */
+	communicator_objects::UnrealMessageProto ChunkMessage;
+
+	/** Receives the acknowledgements of the chunks sent in unary calls. */
+	communicator_objects::UnrealMessageProto ChunkAck;
+
+	/** The timings of the recent steps. */
+	FCommunicatorStats Stats;
+
+	/** The timings of the step being built. */
+	FCommunicatorStepTimings StepTimings;
+
+	/** The timings of the step in flight when the exchange is overlapped. */
+	FCommunicatorStepTimings InFlightTimings;
+
+	/**
+	 * The step message buffers. The second one is used when the exchanges run on the communicator thread, one per
+	 * micro-batch when the steps are split.
+	 */
+	TArray<FStepMessageBuffer> StepBuffers;
+
+	/** Index of the buffer the current step, or micro-batch, is built into. */
+	int32 CurrentStepBuffer;
+
+	/** A pointer to the current UnrealRLOutput being sent to the external system, owned by the step buffer. */
+	communicator_objects::UnrealRLOutputProto* CurrentUnrealRlOutput;
+
+	/** The thread running the exchanges when the exchange is overlapped or sharded, or writing the micro-batches. */
+	TUniquePtr<FCommunicatorWorker> Worker;
+
+	/** Whether an exchange has been handed to the communicator thread and its reply not applied yet. */
+	bool bExchangeInFlight;
+
+	/** The Academy step during which the overlapped or deadline-bounded exchange last ran. */
+	int32 LastOverlappedStep;
+
+	/** The seconds between two attempts to connect to a new trainer. */
+	static constexpr double ReconnectIntervalSeconds = 2.0;
+
+	/** The parameters given at initialization, used again to connect to a new trainer. */
+	FCommunicatorInitParameters ConnectionParameters;
+
+	/** Whether the communicator waits for a new trainer when the current one is lost. */
+	bool bReconnect;
+
+	/** Whether the trainer was lost and the communicator waits for a new one. */
+	bool bAwaitingTrainer;
+
+	/** The time of the next attempt to connect to a new trainer. */
+	double NextReconnectTime;
 
 	/** A set of brain keys that have been sent to the external system. */
 	TSet<FString> SentBrainKeys;
@@ -318,4 +1098,7 @@ private:
 
 	/** A list of behavior names corresponding to the agent brains. */
 	TArray<FString> BehaviorNames;
+
+	/** The state of each subscribed behavior, indexed by its handle. */
+	TArray<FBehaviorState> BehaviorStates;
 };
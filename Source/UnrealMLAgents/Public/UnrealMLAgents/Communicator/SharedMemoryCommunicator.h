@@ -0,0 +1,144 @@
+// Copyright © 2025 Stephane Capponi and individual contributors. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformMemory.h"
+#include "UnrealMLAgents/Communicator/RpcCommunicator.h"
+#include "SharedMemoryCommunicator.generated.h"
+
+/**
+ * @struct FSharedMemoryHeader
+ * @brief Layout of the header at the start of the shared memory region.
+ *
+ * The layout is mirrored by `SharedMemoryCommunicator` in `ueagents_envs/communicator.py`. Every field is little-endian
+ * and each direction's counters sit on their own cache line. The header is followed by the request area and then the
+ * response area, each of `Capacity` bytes.
+ */
+struct FSharedMemoryHeader
+{
+	/** Identifies a region created by the trainer, see `SharedMemoryMagic`. */
+	uint32 Magic;
+
+	/** Version of the layout. */
+	uint32 Version;
+
+	/** Size in bytes of each of the request and response areas. */
+	uint64 Capacity;
+
+	/** Process id of the trainer that created the region. */
+	uint32 OwnerProcessId;
+
+	uint8 Padding0[44];
+
+	/** Incremented by Unreal each time a request has been written. */
+	volatile int64 RequestSequence;
+
+	/** Size in bytes of the last request. */
+	volatile int64 RequestSize;
+
+	uint8 Padding1[48];
+
+	/** Incremented by the trainer each time a response has been written. */
+	volatile int64 ResponseSequence;
+
+	/** Size in bytes of the last response. */
+	volatile int64 ResponseSize;
+
+	uint8 Padding2[48];
+};
+
+static_assert(sizeof(FSharedMemoryHeader) == 192, "The shared memory header layout is shared with Python");
+
+/**
+ * @class USharedMemoryCommunicator
+ * @brief A communicator exchanging messages with a trainer on the same host through shared memory.
+ *
+ * The trainer creates a named shared memory region for the port of the environment, and each step message is
+ * serialized straight into it instead of going through gRPC over TCP. Each side signals a new message by bumping a
+ * sequence counter in the region header, which the other side polls with a spin-then-sleep backoff. Everything else,
+ * from building the step messages to applying the actions, is shared with URpcCommunicator.
+ */
+UCLASS()
+class UNREALMLAGENTS_API USharedMemoryCommunicator : public URpcCommunicator
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * @brief Unmaps the shared memory region before the object is destroyed.
+	 */
+	virtual void BeginDestroy() override;
+
+	/**
+	 * @brief Builds the name of the shared memory region used for a port.
+	 *
+	 * @param Port The port of the environment.
+	 * @return The name of the region, identical to the one computed by the trainer.
+	 */
+	static FString GetRegionName(int32 Port);
+
+protected:
+	/**
+	 * @brief Maps the shared memory region the trainer created for the port.
+	 *
+	 * @param Port The port of the environment.
+	 * @return True if the region exists and has a valid header, false otherwise.
+	 */
+	virtual bool EstablishConnection(int32 Port) override;
+
+	/**
+	 * @brief Writes the request into the shared memory region and waits for the trainer's response.
+	 *
+	 * @param Request The message to send to the trainer.
+	 * @param Response The message the reply is parsed into.
+	 * @param OutErrorMessage The reason of the failure when the exchange fails.
+	 * @param OutTimings Receives the time spent serializing the request and the sizes of both messages.
+	 * @return True if a reply was received, false otherwise.
+	 */
+	virtual bool TransportExchange(const communicator_objects::UnrealMessageProto& Request,
+		communicator_objects::UnrealMessageProto& Response, std::string& OutErrorMessage,
+		FCommunicatorStepTimings& OutTimings) override;
+
+private:
+	/** Value of the header magic, the bytes "UEAS" read as a little-endian integer. */
+	static constexpr uint32 SharedMemoryMagic = 0x53414555;
+
+	/** Version of the header layout. */
+	static constexpr uint32 SharedMemoryVersion = 1;
+
+	/** Number of polls spent yielding before the wait for a response starts sleeping. */
+	static constexpr int32 SpinCount = 4096;
+
+	/**
+	 * @brief Waits until the trainer has written the response with the given sequence number.
+	 *
+	 * @param Sequence The sequence number to wait for.
+	 * @return True once the response is available, false if the trainer process is gone or the exchange is given
+	 * up.
+	 */
+	bool WaitForResponse(int64 Sequence) const;
+
+	/**
+	 * @brief Unmaps the shared memory region.
+	 */
+	void UnmapRegion();
+
+	/** The mapped shared memory region. */
+	FPlatformMemory::FSharedMemoryRegion* Region = nullptr;
+
+	/** The header at the start of the region. */
+	FSharedMemoryHeader* Header = nullptr;
+
+	/** Start of the area requests are written into. */
+	uint8* RequestData = nullptr;
+
+	/** Start of the area responses are read from. */
+	uint8* ResponseData = nullptr;
+
+	/** Size in bytes of each of the request and response areas. */
+	uint64 Capacity = 0;
+
+	/** Sequence number of the last response read. */
+	int64 LastResponseSequence = 0;
+};
@@ -0,0 +1,73 @@
+// Copyright © 2025 Stephane Capponi and individual contributors. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UnrealMLAgents/Communicator/ReusableArena.h"
+#include "ueagents_envs/communicator_objects/unreal_message.pb.h"
+
+/**
+ * @class FStepMessageBuffer
+ * @brief Owns the persistent request and response messages of one communicator step.
+ *
+ * The request is built in place during the step and sent as is, the response is received into a message that is
+ * reused every step. Both are allocated on reusable arenas when arena mode is enabled and on the heap otherwise.
+ */
+class UNREALMLAGENTS_API FStepMessageBuffer
+{
+public:
+	/**
+	 * @brief Allocates the request and response messages.
+	 *
+	 * @param bInUseArena Whether the messages are allocated on reusable arenas.
+	 * @param BehaviorNames The subscribed behaviors, each one gets an empty agent list in the request.
+	 */
+	void Create(bool bInUseArena, const TArray<FString>& BehaviorNames);
+
+	/**
+	 * @brief Resets the request once it has been sent, keeping its memory for the next step.
+	 *
+	 * @param BehaviorNames The subscribed behaviors, each one gets an empty agent list in the request.
+	 */
+	void ResetRequest(const TArray<FString>& BehaviorNames);
+
+	/**
+	 * @brief Resets the response before a new message is received into it.
+	 */
+	void ResetResponse();
+
+	/** The message sent to the external system, built in place during the step. */
+	communicator_objects::UnrealMessageProto* Request = nullptr;
+
+	/** The message received from the external system. */
+	communicator_objects::UnrealMessageProto* Response = nullptr;
+
+	/** The RL output of the request, owned by the request. */
+	communicator_objects::UnrealRLOutputProto* RlOutput = nullptr;
+
+private:
+	/**
+	 * @brief Prepares the request for a new step.
+	 *
+	 * @param BehaviorNames The subscribed behaviors, each one gets an empty agent list in the request.
+	 */
+	void InitRequest(const TArray<FString>& BehaviorNames);
+
+	/** Size in bytes of the initial block of the step arenas. */
+	static constexpr int32 InitialArenaBlockSize = 1 << 20;
+
+	/** Whether the messages are allocated on reusable arenas. */
+	bool bUseArena = false;
+
+	/** Arena owning the request when arena mode is enabled. */
+	TUniquePtr<FReusableArena> OutputArena;
+
+	/** Arena owning the response when arena mode is enabled. */
+	TUniquePtr<FReusableArena> InputArena;
+
+	/** Heap storage for the request when arena mode is disabled. */
+	TUniquePtr<communicator_objects::UnrealMessageProto> HeapRequest;
+
+	/** Heap storage for the response when arena mode is disabled. */
+	TUniquePtr<communicator_objects::UnrealMessageProto> HeapResponse;
+};
@@ -36,6 +36,9 @@ struct UNREALMLAGENTS_API FAgentInfo
 	/** @brief The MultiAgentGroup identifier for the agent. */
 	int32 GroupId;
 
+	/** @brief The number of steps of its last action sequence the agent played, 0 after single step actions. */
+	int32 ConsumedSteps = 0;
+
 	/** @brief The action buffers containing the most recent actions taken by the agent. */
 	FActionBuffers StoredActions;
 
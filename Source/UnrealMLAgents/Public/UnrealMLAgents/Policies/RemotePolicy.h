@@ -26,8 +26,11 @@ class UNREALMLAGENTS_API URemotePolicy : public UObject, public IIPolicy
 	GENERATED_BODY()
 
 private:
-	/** The ID of the agent requesting the decision. */
-	int32 AgentId;
+	/** The handle of the behavior in the communicator. */
+	int32 BehaviorHandle = INDEX_NONE;
+
+	/** The slot of the agent in its behavior. */
+	int32 AgentSlot = INDEX_NONE;
 
 	/** The fully qualified name of the behavior used for training and communication. */
 	FString FullyQualifiedBehaviorName;
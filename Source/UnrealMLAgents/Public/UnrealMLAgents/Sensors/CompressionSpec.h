@@ -0,0 +1,91 @@
+// Copyright © 2025 Stephane Capponi and individual contributors. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CompressionSpec.generated.h"
+
+/**
+ * @enum ESensorCompressionType
+ * @brief Enum representing how the observations of a sensor are compressed before being sent to the trainer.
+ */
+UENUM(BlueprintType)
+enum class ESensorCompressionType : uint8
+{
+	/**
+	 * @brief The observations are sent as uncompressed floats.
+	 */
+	None = 0 UMETA(DisplayName = "None"),
+
+	/**
+	 * @brief The observations are sent as a zlib stream of little-endian floats.
+	 */
+	Zlib = 1 UMETA(DisplayName = "Zlib"),
+
+	/**
+	 * @brief Only the elements that changed since the previous step of the episode are sent.
+	 *
+	 * Suited to sensors whose observations change little from one step to the next, such as grid or occupancy
+	 * sensors. A full observation is sent whenever most of the elements changed.
+	 */
+	Delta = 2 UMETA(DisplayName = "Delta")
+};
+
+/**
+ * @struct FCompressionSpec
+ * @brief Describes how the observations of a sensor are compressed before being sent to the trainer.
+ *
+ * Compression is only applied when the trainer announced during the handshake that it can decode compressed
+ * observations, and only to observations large enough to benefit from it. Otherwise the observations are sent as
+ * plain floats.
+ */
+USTRUCT(BlueprintType)
+struct UNREALMLAGENTS_API FCompressionSpec
+{
+	GENERATED_BODY()
+
+private:
+	/** The compression applied to the observations. */
+	ESensorCompressionType CompressionType = ESensorCompressionType::None;
+
+public:
+	/**
+	 * @brief Default constructor, the observations are not compressed.
+	 */
+	FCompressionSpec() {}
+
+	/**
+	 * @brief Constructs a compression spec with the provided compression type.
+	 *
+	 * @param InCompressionType The compression applied to the observations.
+	 */
+	explicit FCompressionSpec(ESensorCompressionType InCompressionType) : CompressionType(InCompressionType) {}
+
+	/**
+	 * @brief Gets the compression applied to the observations.
+	 *
+	 * @return The compression type.
+	 */
+	ESensorCompressionType GetCompressionType() const { return CompressionType; }
+
+	/**
+	 * @brief Constructs a compression spec for observations sent as uncompressed floats.
+	 *
+	 * @return A compression spec without compression.
+	 */
+	static FCompressionSpec Default() { return FCompressionSpec(); }
+
+	/**
+	 * @brief Constructs a compression spec for observations compressed with zlib.
+	 *
+	 * @return A zlib compression spec.
+	 */
+	static FCompressionSpec Zlib() { return FCompressionSpec(ESensorCompressionType::Zlib); }
+
+	/**
+	 * @brief Constructs a compression spec for observations sent as changes from the previous step.
+	 *
+	 * @return A delta compression spec.
+	 */
+	static FCompressionSpec Delta() { return FCompressionSpec(ESensorCompressionType::Delta); }
+};
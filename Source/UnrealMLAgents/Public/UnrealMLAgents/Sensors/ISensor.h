@@ -4,8 +4,10 @@
 
 #include "CoreMinimal.h"
 #include "UObject/Interface.h"
+#include "UnrealMLAgents/Sensors/CompressionSpec.h"
 #include "UnrealMLAgents/Sensors/ObservationSpec.h"
 #include "UnrealMLAgents/Sensors/ObservationType.h"
+#include "UnrealMLAgents/Sensors/SensorSharing.h"
 #include "UnrealMLAgents/DimensionProperty.h"
 #include "UnrealMLAgents/Sensors/ObservationWriter.h"
 #include "ISensor.generated.h"
@@ -46,6 +48,30 @@ public:
 	 */
 	virtual FObservationSpec GetObservationSpec() = 0;
 
+	/**
+	 * @brief Returns how the sensor's observations should be compressed before being sent to the trainer.
+	 *
+	 * By default multi-dimensional observations, such as images, are compressed with zlib and the others are sent
+	 * as plain floats. Sensors producing large vector observations can override this to opt in.
+	 *
+	 * @return An `FCompressionSpec` object describing the compression of the sensor's observations.
+	 */
+	virtual FCompressionSpec GetCompressionSpec()
+	{
+		return GetObservationSpec().GetRank() >= 3 ? FCompressionSpec::Zlib() : FCompressionSpec::Default();
+	}
+
+	/**
+	 * @brief Returns which agents observe the same values through the sensor.
+	 *
+	 * The observations of a shared sensor are written and sent for the first agent sharing them in a step only, the
+	 * sensors of the other agents are not written. Sharing is only used when the trainer announced during the
+	 * handshake that it can broadcast shared observations.
+	 *
+	 * @return The agents sharing the observations of the sensor, none by default.
+	 */
+	virtual ESensorSharing GetSharing() { return ESensorSharing::None; }
+
 	/**
 	 * @brief Writes the sensor's observation data to the provided `ObservationWriter`.
 	 *
@@ -57,6 +83,18 @@ public:
 	 */
 	virtual int32 Write(ObservationWriter& Writer) = 0;
 
+	/**
+	 * @brief Returns whether the sensor can write its observations from a worker thread.
+	 *
+	 * The observations of thread-safe sensors are written when the step message is sent, in parallel with the other
+	 * agents', instead of when the agent requests a decision. `Write`, `GetObservationSpec`, `GetCompressionSpec`
+	 * and `GetName` are then called off the game thread while it waits, so they must only touch the sensor's own
+	 * state, and `Write` must not write more than the observation spec declares.
+	 *
+	 * @return True if the sensor can write its observations from a worker thread.
+	 */
+	virtual bool IsThreadSafe() { return false; }
+
 	/**
 	 * @brief Updates the internal state of the sensor.
 	 *
@@ -110,8 +148,18 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Sensor")
 	static int32 ObservationSize(TScriptInterface<IISensor> Sensor)
 	{
-		FObservationSpec ObsSpec = Sensor->GetObservationSpec();
-		int32			 Count = 1;
+		return ObservationSize(Sensor->GetObservationSpec());
+	}
+
+	/**
+	 * @brief Calculates the total number of elements described by an observation spec.
+	 *
+	 * @param ObsSpec The observation spec whose size is to be calculated.
+	 * @return The total number of elements in the observation.
+	 */
+	static int32 ObservationSize(const FObservationSpec& ObsSpec)
+	{
+		int32 Count = 1;
 		for (int32 i = 0; i < ObsSpec.GetRank(); ++i)
 		{
 			Count *= ObsSpec.GetShape()[i];
@@ -0,0 +1,37 @@
+// Copyright © 2025 Stephane Capponi and individual contributors. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ObservationEncoding.generated.h"
+
+/**
+ * @enum EObservationEncoding
+ * @brief Enum representing how each element of an observation is encoded when sent to the trainer.
+ *
+ * Observations are collected as 32-bit floats. Lower precision encodings reduce the size of the step messages for
+ * observations that do not need the full precision, such as distances, tags or one-hot features. The trainer decodes
+ * them back to 32-bit floats.
+ */
+UENUM(BlueprintType)
+enum class EObservationEncoding : uint8
+{
+	/**
+	 * @brief Each element is sent as a 32-bit float.
+	 */
+	Float32 = 0 UMETA(DisplayName = "Float32"),
+
+	/**
+	 * @brief Each element is sent as an IEEE 754 half-precision float.
+	 *
+	 * Values keep about three significant decimal digits, and values above 65504 saturate.
+	 */
+	Float16 = 1 UMETA(DisplayName = "Float16"),
+
+	/**
+	 * @brief Each element is sent as a byte holding round((Value - Offset) / Scale), clamped to [0, 255].
+	 *
+	 * Suited to values with a known range, such as normalized distances or one-hot features.
+	 */
+	UInt8 = 2 UMETA(DisplayName = "UInt8")
+};
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "UnrealMLAgents/InplaceArray.h"
 #include "UnrealMLAgents/DimensionProperty.h"
+#include "UnrealMLAgents/Sensors/ObservationEncoding.h"
 #include "UnrealMLAgents/Sensors/ObservationType.h"
 #include "ObservationSpec.generated.h"
 
@@ -31,6 +32,15 @@ private:
 	/** The type of the observation, such as whether it's generic or related to a goal. */
 	EObservationType ObservationType;
 
+	/** How each element of the observation is encoded when sent to the trainer. */
+	EObservationEncoding Encoding = EObservationEncoding::Float32;
+
+	/** The step between two quantized values when the observation is encoded as bytes. */
+	float QuantizationScale = 1.0f;
+
+	/** The value represented by a quantized zero when the observation is encoded as bytes. */
+	float QuantizationOffset = 0.0f;
+
 public:
 	/**
 	 * @brief Default constructor.
@@ -79,6 +89,69 @@ public:
 	 */
 	int32 GetRank() const { return Shape.GetLength(); }
 
+	/**
+	 * @brief Checks whether another observation spec has the same shape and dimension properties.
+	 *
+	 * @param Other The observation spec to compare with.
+	 * @return True if the observations of both specs are laid out the same way.
+	 */
+	bool HasSameLayout(const FObservationSpec& Other) const
+	{
+		if (Shape.GetLength() != Other.Shape.GetLength())
+		{
+			return false;
+		}
+		for (int32 i = 0; i < Shape.GetLength(); i++)
+		{
+			if (Shape[i] != Other.Shape[i] || DimensionProperties[i] != Other.DimensionProperties[i])
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/**
+	 * @brief Gets how each element of the observation is encoded when sent to the trainer.
+	 *
+	 * @return The encoding of the observation as an `EObservationEncoding`.
+	 */
+	EObservationEncoding GetEncoding() const { return Encoding; }
+
+	/**
+	 * @brief Gets the step between two quantized values, used by the `UInt8` encoding.
+	 *
+	 * @return The quantization scale.
+	 */
+	float GetQuantizationScale() const { return QuantizationScale; }
+
+	/**
+	 * @brief Gets the value represented by a quantized zero, used by the `UInt8` encoding.
+	 *
+	 * @return The quantization offset.
+	 */
+	float GetQuantizationOffset() const { return QuantizationOffset; }
+
+	/**
+	 * @brief Sets how each element of the observation is encoded when sent to the trainer.
+	 *
+	 * Encodings other than `Float32` are lossy and only used when the trainer supports them. With the `UInt8`
+	 * encoding, the values from `InOffset` to `InOffset + 255 * InScale` can be represented.
+	 *
+	 * @param InEncoding The encoding of the observation.
+	 * @param InScale The step between two quantized values, used by the `UInt8` encoding.
+	 * @param InOffset The value represented by a quantized zero, used by the `UInt8` encoding.
+	 * @return A reference to this observation spec.
+	 */
+	FObservationSpec& SetEncoding(EObservationEncoding InEncoding, float InScale = 1.0f, float InOffset = 0.0f)
+	{
+		check(InEncoding != EObservationEncoding::UInt8 || InScale > 0.0f);
+		Encoding = InEncoding;
+		QuantizationScale = InScale;
+		QuantizationOffset = InOffset;
+		return *this;
+	}
+
 	/**
 	 * @brief Constructs an observation spec for 1-D vector observations.
 	 *
@@ -3,8 +3,11 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Math/Float16.h"
 #include "google/protobuf/repeated_field.h"
 #include "UObject/ObjectMacros.h"
+#include "UnrealMLAgents/Sensors/ObservationSpec.h"
+#include <string>
 
 /**
  * @class ObservationWriter
@@ -12,7 +15,8 @@
  *
  * The `ObservationWriter` class allows sensors and other data sources to write observations
  * into a Protobuf RepeatedField or float arrays. It provides methods for writing individual elements,
- * vectors, and quaternions. The class also supports reshaping multi-dimensional observation data.
+ * vectors, and quaternions. The class also supports reshaping multi-dimensional observation data, and
+ * quantizing the written data to the encoding declared by the observation spec.
  */
 class ObservationWriter
 {
@@ -142,10 +146,8 @@ public:
 			Data->Resize(TotalSize, 0.0f); // Ensure Data has enough capacity
 		}
 
-		for (int Index = 0; Index < InData.Num(); Index++)
-		{
-			Data->Set(Index + Offset + WriteOffset, InData[Index]);
-		}
+		// The target is usually sized up front, so this is a single copy into the outgoing buffer
+		FMemory::Memcpy(Data->mutable_data() + Offset + WriteOffset, InData.GetData(), InData.Num() * sizeof(float));
 	}
 
 	/**
@@ -218,4 +220,50 @@ public:
 		Data->Set(Offset + WriteOffset + 2, Quat.Z);
 		Data->Set(Offset + WriteOffset + 3, Quat.W);
 	}
+
+	/**
+	 * @brief Encodes the data written into the target buffer with the encoding of an observation spec.
+	 *
+	 * The elements from the write offset to the end of the buffer are converted to little-endian `Float16` or
+	 * `UInt8` values. `UInt8` values are rounded to the nearest step and clamped to the representable range.
+	 *
+	 * @param ObsSpec The observation spec declaring the encoding, scale and offset.
+	 * @param OutBytes The buffer receiving the encoded elements, resized to fit them.
+	 */
+	void Encode(const FObservationSpec& ObsSpec, std::string& OutBytes) const
+	{
+		check(Data != nullptr);
+
+		const int32	 Count = Data->size() - Offset;
+		const float* Values = Data->data() + Offset;
+		switch (ObsSpec.GetEncoding())
+		{
+			case EObservationEncoding::Float16:
+			{
+				OutBytes.resize(Count * sizeof(uint16));
+				uint16* Halves = reinterpret_cast<uint16*>(OutBytes.data());
+				for (int32 i = 0; i < Count; ++i)
+				{
+					Halves[i] = FFloat16(Values[i]).Encoded;
+				}
+				break;
+			}
+			case EObservationEncoding::UInt8:
+			{
+				const float InvScale = 1.0f / ObsSpec.GetQuantizationScale();
+				const float QuantizationOffset = ObsSpec.GetQuantizationOffset();
+				OutBytes.resize(Count);
+				uint8* Bytes = reinterpret_cast<uint8*>(OutBytes.data());
+				for (int32 i = 0; i < Count; ++i)
+				{
+					const int32 Quantized = FMath::RoundToInt((Values[i] - QuantizationOffset) * InvScale);
+					Bytes[i] = static_cast<uint8>(FMath::Clamp(Quantized, 0, 255));
+				}
+				break;
+			}
+			default:
+				OutBytes.assign(reinterpret_cast<const char*>(Values), Count * sizeof(float));
+				break;
+		}
+	}
 };
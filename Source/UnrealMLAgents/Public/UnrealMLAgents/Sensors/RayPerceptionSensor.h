@@ -60,6 +60,22 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ray Perception")
 	float PitchAngle;
 
+	// Compression of the observations sent to the trainer
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ray Perception")
+	ESensorCompressionType CompressionType = ESensorCompressionType::None;
+
+	// Encoding of the observations sent to the trainer
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ray Perception")
+	EObservationEncoding Encoding = EObservationEncoding::Float32;
+
+	// Step between two quantized values with the UInt8 encoding
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ray Perception")
+	float QuantizationScale = 1.0f / 255.0f;
+
+	// Value represented by a quantized zero with the UInt8 encoding
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ray Perception")
+	float QuantizationOffset = 0.0f;
+
 	// Get the number of observations
 	int32 OutputSize() { return Angles.Num() * 2; }
 };
@@ -75,6 +91,7 @@ public:
 	// IISensor
 
 	virtual FObservationSpec GetObservationSpec() override;
+	virtual FCompressionSpec GetCompressionSpec() override;
 	virtual int32			 Write(ObservationWriter& Writer) override;
 	virtual void			 Update() override;
 	virtual void			 Reset() override;
@@ -114,6 +114,40 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ray Perception")
 	bool bDebugLine;
 
+	/**
+	 * @brief The compression applied to the observations sent to the trainer.
+	 *
+	 * Large ray fans can be compressed with zlib to reduce the size of the step messages, at the cost of some CPU
+	 * time on the game thread. Rays that rarely change, such as those of a static agent, can instead send only the
+	 * hits that changed since the previous step, as 32-bit floats. Compression is skipped when the trainer does not
+	 * support it.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ray Perception")
+	ESensorCompressionType CompressionType = ESensorCompressionType::None;
+
+	/**
+	 * @brief How the ray distances and tags are encoded when sent to the trainer.
+	 *
+	 * `Float16` halves the size of the observations and keeps about three significant digits. `UInt8` quarters it
+	 * but only represents the values from `QuantizationOffset` to `QuantizationOffset + 255 * QuantizationScale`.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ray Perception")
+	EObservationEncoding Encoding = EObservationEncoding::Float32;
+
+	/**
+	 * @brief The step between two quantized values when the observations are encoded as `UInt8`.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ray Perception",
+		meta = (EditCondition = "Encoding == EObservationEncoding::UInt8", ClampMin = "0.000001"))
+	float QuantizationScale = 1.0f / 255.0f;
+
+	/**
+	 * @brief The value represented by a quantized zero when the observations are encoded as `UInt8`.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ray Perception",
+		meta = (EditCondition = "Encoding == EObservationEncoding::UInt8"))
+	float QuantizationOffset = 0.0f;
+
 private:
 	/**
 	 * @brief Generates the input data for casting the rays.
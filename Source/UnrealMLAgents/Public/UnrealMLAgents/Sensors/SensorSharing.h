@@ -0,0 +1,33 @@
+// Copyright © 2025 Stephane Capponi and individual contributors. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SensorSharing.generated.h"
+
+/**
+ * @enum ESensorSharing
+ * @brief Enum representing which agents observe the same values through a sensor.
+ *
+ * The observations of a shared sensor are sent once per step for all the agents sharing them, the trainer hands
+ * every agent its copy. Only sensors observing a state common to those agents, such as the score or the position of
+ * a ball, should be shared.
+ */
+UENUM(BlueprintType)
+enum class ESensorSharing : uint8
+{
+	/**
+	 * @brief Every agent sends the observations of its own sensor.
+	 */
+	None = 0 UMETA(DisplayName = "None"),
+
+	/**
+	 * @brief The agents of the same group observe the same values, agents without a group send their own.
+	 */
+	Group = 1 UMETA(DisplayName = "Group"),
+
+	/**
+	 * @brief Every agent of the behavior observes the same values.
+	 */
+	Behavior = 2 UMETA(DisplayName = "Behavior")
+};
@@ -49,6 +49,29 @@ public:
 	 */
 	virtual int32 Write(ObservationWriter& Writer) override;
 
+	/**
+	 * @brief The sensor only copies the observations collected by its agent, it can write from a worker thread.
+	 *
+	 * @return Always true.
+	 */
+	virtual bool IsThreadSafe() override { return true; }
+
+	/**
+	 * @brief Returns which agents observe the same values through the sensor, as set with SetSharing.
+	 *
+	 * @return The agents sharing the observations of the sensor.
+	 */
+	virtual ESensorSharing GetSharing() override { return Sharing; }
+
+	/**
+	 * @brief Sets which agents observe the same values through the sensor, such as the state of a match seen by a
+	 * whole team.
+	 *
+	 * @param InSharing The agents sharing the observations of the sensor.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Observations")
+	void SetSharing(ESensorSharing InSharing) { Sharing = InSharing; }
+
 	/**
 	 * @brief Updates the sensor state (clears observations).
 	 *
@@ -170,4 +193,7 @@ private:
 
 	/** The observation specification (shape and dimension properties). */
 	FObservationSpec ObservationSpec;
+
+	/** The agents sharing the observations of the sensor. */
+	ESensorSharing Sharing = ESensorSharing::None;
 };
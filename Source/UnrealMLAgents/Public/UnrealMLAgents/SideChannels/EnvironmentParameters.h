@@ -0,0 +1,118 @@
+// Copyright © 2025 Stephane Capponi and individual contributors. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/RandomStream.h"
+#include "UnrealMLAgents/SideChannels/SideChannel.h"
+
+/**
+ * @class FEnvironmentParameters
+ * @brief Receives the environment parameters set by the trainer, such as curriculum lessons and randomized values.
+ *
+ * The trainer sends a parameter again whenever its value or sampler changes, the new value is applied right away
+ * without resetting the environment. Agents read the parameters when their episode begins, a parameter with a
+ * sampler draws a new value at every read. Parameters are only read and updated from the game thread.
+ */
+class UNREALMLAGENTS_API FEnvironmentParameters : public FSideChannel
+{
+public:
+	/**
+	 * @brief Creates the channel on the identifier of the Python EnvironmentParametersChannel.
+	 */
+	FEnvironmentParameters();
+
+	/**
+	 * @brief Returns the current value of a parameter.
+	 *
+	 * @param Key The name of the parameter, as set in the trainer configuration.
+	 * @param DefaultValue The value returned when the trainer did not set the parameter.
+	 * @return The value of the parameter, drawn from its sampler if it has one.
+	 */
+	float GetWithDefault(const FString& Key, float DefaultValue);
+
+	/**
+	 * @brief Registers a function called whenever the trainer sets a fixed value for a parameter.
+	 *
+	 * Parameters with a sampler do not call it, they are drawn when read.
+	 *
+	 * @param Key The name of the parameter.
+	 * @param Callback The function called with the new value, replaces the previous one.
+	 */
+	void RegisterCallback(const FString& Key, TFunction<void(float)> Callback);
+
+	/**
+	 * @brief Returns the names of the parameters the trainer set.
+	 *
+	 * @return The names of the parameters.
+	 */
+	TArray<FString> ListParameters() const;
+
+	/**
+	 * @brief Applies a parameter sent by the trainer.
+	 *
+	 * @param Message The message received.
+	 */
+	virtual void OnMessageReceived(FIncomingMessage& Message) override;
+
+private:
+	/**
+	 * @enum EParameterType
+	 * @brief How the value of a parameter is obtained, the values match the Python EnvironmentDataTypes.
+	 */
+	enum class EParameterType : int32
+	{
+		Float = 0,
+		Sampler = 1
+	};
+
+	/**
+	 * @enum ESamplerType
+	 * @brief The distribution of a sampled parameter, the values match the Python SamplerTypes.
+	 */
+	enum class ESamplerType : int32
+	{
+		Uniform = 0,
+		Gaussian = 1,
+		MultiRangeUniform = 2
+	};
+
+	/**
+	 * @struct FParameter
+	 * @brief The value or the sampler of a parameter.
+	 */
+	struct FParameter
+	{
+		/** Whether the parameter is sampled. */
+		bool bSampled = false;
+
+		/** The distribution of a sampled parameter. */
+		ESamplerType Sampler = ESamplerType::Uniform;
+
+		/** The fixed value, or the minimum or mean of the distribution. */
+		float Value = 0.0f;
+
+		/** The maximum or standard deviation of the distribution. */
+		float Spread = 0.0f;
+
+		/** The minimum and maximum of each range of a multi-range uniform distribution, one after the other. */
+		TArray<float> Intervals;
+
+		/** The random stream of a sampled parameter, seeded by the trainer. */
+		FRandomStream Random;
+	};
+
+	/**
+	 * @brief Draws a value of a sampled parameter.
+	 *
+	 * @param Parameter The parameter to draw.
+	 * @return The drawn value.
+	 */
+	static float Sample(FParameter& Parameter);
+
+	/** The parameters set by the trainer, by name. */
+	TMap<FString, FParameter> Parameters;
+
+	/** The functions called when the value of a parameter is set, by name. */
+	TMap<FString, TFunction<void(float)>> Callbacks;
+};
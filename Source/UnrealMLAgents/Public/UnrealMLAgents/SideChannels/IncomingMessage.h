@@ -0,0 +1,92 @@
+// Copyright © 2025 Stephane Capponi and individual contributors. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @class FIncomingMessage
+ * @brief Reads the values of a message received by a side channel.
+ *
+ * Values must be read in the order they were written by the trainer. Reading past the end of the message returns
+ * the default value passed to the read method.
+ */
+class UNREALMLAGENTS_API FIncomingMessage
+{
+public:
+	/**
+	 * @brief Creates a reader over the bytes of a message, the bytes must outlive the reader.
+	 *
+	 * @param InData The bytes of the message.
+	 */
+	explicit FIncomingMessage(TArrayView<const uint8> InData);
+
+	/**
+	 * @brief Reads a boolean.
+	 *
+	 * @param DefaultValue The value returned when the end of the message was reached.
+	 * @return The value read.
+	 */
+	bool ReadBoolean(bool DefaultValue = false);
+
+	/**
+	 * @brief Reads a 32-bit integer.
+	 *
+	 * @param DefaultValue The value returned when the end of the message was reached.
+	 * @return The value read.
+	 */
+	int32 ReadInt32(int32 DefaultValue = 0);
+
+	/**
+	 * @brief Reads a 32-bit float.
+	 *
+	 * @param DefaultValue The value returned when the end of the message was reached.
+	 * @return The value read.
+	 */
+	float ReadFloat32(float DefaultValue = 0.0f);
+
+	/**
+	 * @brief Reads a length-prefixed ASCII string.
+	 *
+	 * @param DefaultValue The value returned when the end of the message was reached.
+	 * @return The value read.
+	 */
+	FString ReadString(const FString& DefaultValue = FString());
+
+	/**
+	 * @brief Reads a length-prefixed list of 32-bit floats.
+	 *
+	 * @return The values read, empty when the end of the message was reached.
+	 */
+	TArray<float> ReadFloatList();
+
+	/**
+	 * @brief Returns the whole message, for channels that do their own decoding.
+	 *
+	 * @return The bytes of the message.
+	 */
+	TArrayView<const uint8> GetRawBytes() const { return Data; }
+
+	/**
+	 * @brief Whether every value of the message was read.
+	 *
+	 * @return True if the end of the message was reached.
+	 */
+	bool IsAtEnd() const { return Offset >= Data.Num(); }
+
+private:
+	/**
+	 * @brief Copies the next bytes of the message, if there are enough of them.
+	 *
+	 * @param OutValue Receives the bytes.
+	 * @param Size The number of bytes to read.
+	 * @return True if the bytes were read.
+	 */
+	bool ReadBytes(void* OutValue, int32 Size);
+
+	/** The bytes of the message. */
+	TArrayView<const uint8> Data;
+
+	/** The position of the next value to read. */
+	int32 Offset;
+};
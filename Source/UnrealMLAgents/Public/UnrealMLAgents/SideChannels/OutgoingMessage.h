@@ -0,0 +1,81 @@
+// Copyright © 2025 Stephane Capponi and individual contributors. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @class FOutgoingMessage
+ * @brief Writes the values of a message a side channel sends to the trainer.
+ *
+ * Values are appended in the order the trainer reads them back.
+ */
+class UNREALMLAGENTS_API FOutgoingMessage
+{
+public:
+	/**
+	 * @brief Appends a boolean.
+	 *
+	 * @param Value The value to write.
+	 */
+	void WriteBoolean(bool Value);
+
+	/**
+	 * @brief Appends a 32-bit integer.
+	 *
+	 * @param Value The value to write.
+	 */
+	void WriteInt32(int32 Value);
+
+	/**
+	 * @brief Appends a 32-bit float.
+	 *
+	 * @param Value The value to write.
+	 */
+	void WriteFloat32(float Value);
+
+	/**
+	 * @brief Appends a length-prefixed ASCII string.
+	 *
+	 * @param Value The value to write.
+	 */
+	void WriteString(const FString& Value);
+
+	/**
+	 * @brief Appends a length-prefixed list of 32-bit floats.
+	 *
+	 * @param Values The values to write.
+	 */
+	void WriteFloatList(TArrayView<const float> Values);
+
+	/**
+	 * @brief Replaces the message with raw bytes, for channels that do their own encoding.
+	 *
+	 * @param Data The bytes of the message.
+	 */
+	void SetRawBytes(TArrayView<const uint8> Data);
+
+	/**
+	 * @brief Returns the bytes written so far.
+	 *
+	 * @return The bytes of the message.
+	 */
+	const TArray<uint8>& GetBuffer() const { return Buffer; }
+
+	/**
+	 * @brief Removes every value written, keeping the memory of the message.
+	 */
+	void Reset() { Buffer.Reset(); }
+
+private:
+	/**
+	 * @brief Appends raw bytes to the message.
+	 *
+	 * @param Value The bytes to append.
+	 * @param Size The number of bytes to append.
+	 */
+	void WriteBytes(const void* Value, int32 Size);
+
+	/** The bytes of the message. */
+	TArray<uint8> Buffer;
+};
@@ -0,0 +1,67 @@
+// Copyright © 2025 Stephane Capponi and individual contributors. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/Guid.h"
+#include "UnrealMLAgents/SideChannels/IncomingMessage.h"
+#include "UnrealMLAgents/SideChannels/OutgoingMessage.h"
+
+/**
+ * @class FSideChannel
+ * @brief Exchanges data with the trainer outside of the observations and actions of the agents.
+ *
+ * Each side channel is identified by a GUID shared with its Python counterpart. Its queued messages travel with the
+ * next step message, and the messages the trainer sends to it are delivered when the reply is applied. Side
+ * channels are registered with FSideChannelManager and are only used from the game thread.
+ */
+class UNREALMLAGENTS_API FSideChannel
+{
+public:
+	/**
+	 * @brief Creates a side channel.
+	 *
+	 * @param InChannelId The identifier shared with the Python side channel.
+	 */
+	explicit FSideChannel(const FGuid& InChannelId) : ChannelId(InChannelId) {}
+
+	virtual ~FSideChannel() = default;
+
+	/**
+	 * @brief Returns the identifier shared with the Python side channel.
+	 *
+	 * @return The identifier of the channel.
+	 */
+	const FGuid& GetChannelId() const { return ChannelId; }
+
+	/**
+	 * @brief Called for every message the trainer sent to this channel.
+	 *
+	 * @param Message The message received.
+	 */
+	virtual void OnMessageReceived(FIncomingMessage& Message) = 0;
+
+	/**
+	 * @brief Called right before the queued messages are gathered into a step message.
+	 *
+	 * Channels that aggregate data queue their message here.
+	 */
+	virtual void OnCollectMessages() {}
+
+protected:
+	/**
+	 * @brief Queues a message to send with the next step message.
+	 *
+	 * @param Message The message to send.
+	 */
+	void QueueMessageToSend(const FOutgoingMessage& Message) { MessageQueue.Add(Message.GetBuffer()); }
+
+private:
+	friend class FSideChannelManager;
+
+	/** The identifier shared with the Python side channel. */
+	FGuid ChannelId;
+
+	/** The messages waiting for the next step message. */
+	TArray<TArray<uint8>> MessageQueue;
+};
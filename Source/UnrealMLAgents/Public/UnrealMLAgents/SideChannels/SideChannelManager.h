@@ -0,0 +1,64 @@
+// Copyright © 2025 Stephane Capponi and individual contributors. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UnrealMLAgents/SideChannels/SideChannel.h"
+#include <string>
+
+/**
+ * @class FSideChannelManager
+ * @brief Keeps the registered side channels and moves their messages in and out of the step messages.
+ *
+ * The messages of every channel are packed together in the side channel field of the step message. Each message
+ * is prefixed by the GUID of its channel, in the little-endian layout of Python's `uuid.bytes_le`, and by its
+ * length as a 32-bit integer.
+ */
+class UNREALMLAGENTS_API FSideChannelManager
+{
+public:
+	/**
+	 * @brief Registers a side channel, only one channel can be registered per identifier.
+	 *
+	 * @param SideChannel The side channel to register.
+	 */
+	static void RegisterSideChannel(const TSharedRef<FSideChannel>& SideChannel);
+
+	/**
+	 * @brief Unregisters a side channel, its queued messages are dropped.
+	 *
+	 * @param SideChannel The side channel to unregister.
+	 */
+	static void UnregisterSideChannel(const TSharedRef<FSideChannel>& SideChannel);
+
+	/**
+	 * @brief Unregisters every side channel.
+	 */
+	static void UnregisterAllSideChannels();
+
+	/**
+	 * @brief Returns the side channel registered for an identifier.
+	 *
+	 * @param ChannelId The identifier of the channel.
+	 * @return The side channel, null if none is registered for the identifier.
+	 */
+	static TSharedPtr<FSideChannel> GetSideChannel(const FGuid& ChannelId);
+
+	/**
+	 * @brief Delivers the messages the trainer sent to the registered side channels.
+	 *
+	 * @param Data The side channel field of the reply.
+	 */
+	static void ProcessSideChannelData(TArrayView<const uint8> Data);
+
+	/**
+	 * @brief Appends the queued messages of every side channel to the side channel field of a step message.
+	 *
+	 * @param OutData The side channel field of the step message.
+	 */
+	static void GetSideChannelMessage(std::string& OutData);
+
+private:
+	/** The registered side channels by identifier. */
+	static TMap<FGuid, TSharedRef<FSideChannel>> SideChannels;
+};
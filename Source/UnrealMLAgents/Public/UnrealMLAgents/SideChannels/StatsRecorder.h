@@ -0,0 +1,146 @@
+// Copyright © 2025 Stephane Capponi and individual contributors. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UnrealMLAgents/SideChannels/SideChannel.h"
+#include "StatsRecorder.generated.h"
+
+/**
+ * @enum EStatAggregationMethod
+ * @brief How the values of a statistic recorded during a summary period are combined.
+ */
+UENUM(BlueprintType)
+enum class EStatAggregationMethod : uint8
+{
+	/**
+	 * @brief The values are averaged.
+	 */
+	Average = 0 UMETA(DisplayName = "Average"),
+
+	/**
+	 * @brief Only the most recent value is reported.
+	 */
+	MostRecent = 1 UMETA(DisplayName = "Most Recent"),
+
+	/**
+	 * @brief The values are summed up.
+	 */
+	Sum = 2 UMETA(DisplayName = "Sum"),
+
+	/**
+	 * @brief Every value is reported, the trainer shows them as a histogram.
+	 */
+	Histogram = 3 UMETA(DisplayName = "Histogram")
+};
+
+/**
+ * @class FStatsRecorder
+ * @brief Aggregates custom statistics in the engine and sends them to the trainer once per summary period.
+ *
+ * Recording a value only updates its running aggregate. Every summary period, one message carrying an entry per
+ * statistic is queued on the stats side channel, instead of one message per recorded value. Each entry holds the
+ * key, the aggregated value, the aggregation method and the number of values it covers, so the trainer weighs the
+ * averages of several environments correctly.
+ */
+class UNREALMLAGENTS_API FStatsRecorder : public FSideChannel
+{
+public:
+	/** @brief The number of step messages between two summaries by default. */
+	static constexpr int32 DefaultSummaryPeriod = 100;
+
+	/**
+	 * @brief Creates the recorder on the identifier of the Python StatsSideChannel.
+	 */
+	FStatsRecorder();
+
+	/**
+	 * @brief Records a value of a statistic.
+	 *
+	 * A statistic keeps the aggregation method of its first value in a summary period.
+	 *
+	 * @param Key The name of the statistic, as shown by the trainer.
+	 * @param Value The value to record.
+	 * @param Method How the values recorded during a summary period are combined.
+	 */
+	void Add(const FString& Key, float Value, EStatAggregationMethod Method = EStatAggregationMethod::Average);
+
+	/**
+	 * @brief Sets how many step messages separate two summaries.
+	 *
+	 * @param NumSteps The number of step messages, 1 to send the statistics with every step message.
+	 */
+	void SetSummaryPeriod(int32 NumSteps) { SummaryPeriod = FMath::Max(NumSteps, 1); }
+
+	/**
+	 * @brief Sets whether values are recorded, they are dropped when no trainer is connected.
+	 *
+	 * @param bInEnabled Whether values are recorded.
+	 */
+	void SetEnabled(bool bInEnabled) { bEnabled = bInEnabled; }
+
+	/**
+	 * @brief Queues the statistics recorded so far, without waiting for the end of the summary period.
+	 */
+	void Flush();
+
+	/**
+	 * @brief The trainer never sends statistics, the messages are ignored.
+	 *
+	 * @param Message The message received.
+	 */
+	virtual void OnMessageReceived(FIncomingMessage& Message) override;
+
+	/**
+	 * @brief Queues the statistics when the summary period is over.
+	 */
+	virtual void OnCollectMessages() override;
+
+private:
+	/**
+	 * @struct FAggregatedStat
+	 * @brief The running aggregate of a statistic over the current summary period.
+	 */
+	struct FAggregatedStat
+	{
+		/** The aggregation method of the statistic. */
+		EStatAggregationMethod Method = EStatAggregationMethod::Average;
+
+		/** The sum of the values. */
+		double Sum = 0.0;
+
+		/** The number of values. */
+		int32 Count = 0;
+
+		/** The last value. */
+		float MostRecent = 0.0f;
+
+		/** Every value, only kept for histograms. */
+		TArray<float> Values;
+	};
+
+	/**
+	 * @brief Appends an entry of the summary.
+	 *
+	 * @param Key The name of the statistic.
+	 * @param Value The aggregated value.
+	 * @param Method The aggregation method of the statistic.
+	 * @param Count The number of values the entry covers.
+	 */
+	void WriteEntry(const FString& Key, float Value, EStatAggregationMethod Method, int32 Count);
+
+	/** The statistics recorded during the current summary period. */
+	TMap<FString, FAggregatedStat> Stats;
+
+	/** The number of step messages between two summaries. */
+	int32 SummaryPeriod;
+
+	/** The number of step messages since the last summary. */
+	int32 NumStepsSinceSummary;
+
+	/** Whether values are recorded. */
+	bool bEnabled;
+
+	/** The summary message, kept to reuse its memory. */
+	FOutgoingMessage Summary;
+};